@@ -8,4 +8,6 @@
 #pragma once
 #include "../../source/many/TMany.inl"
 #include "../../source/many/Bytes.inl"
+#include "../../source/many/ByteStream.inl"
+#include "../../source/many/MappedFile.inl"
 #include "../../source/maps/TMap.inl"
\ No newline at end of file
@@ -8,9 +8,11 @@
 #pragma once
 #include "../../source/many/Many.inl"
 #include "../../source/many/TMany.inl"
+#include "../../source/many/TSmallMany.inl"
 #include "../../source/maps/TMap.inl"
 #include "../../source/text/Text.inl"
 #include "../../source/many/Neat.inl"
 #include "../../source/many/Construct.inl"
 #include "../../source/many/Bytes.inl"
+#include "../../source/many/THashed.inl"
 #include "../../source/verbs/Verb.inl"
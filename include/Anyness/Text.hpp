@@ -7,4 +7,8 @@
 ///                                                                           
 #pragma once
 #include "../../source/text/Text.inl"
+#include "../../source/text/SmallText.inl"
+#include "../../source/text/Symbol.inl"
+#include "../../source/text/Codepoints.inl"
+#include "../../source/text/TextBuilder.inl"
 #include "../../source/maps/TMap.inl"
\ No newline at end of file
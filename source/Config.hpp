@@ -23,6 +23,22 @@
    #include "memory/NoAllocator.hpp"
 #endif
 
+/// Keep a byte of each key's hash next to the info bytes in hashed containers
+/// Rejects most mismatching keys without comparing them, at the cost of one  
+/// additional byte per slot, and hashing twice on insertion                  
+#ifdef LANGULUS_ENABLE_FEATURE_HASH_FINGERPRINTS
+   #define LANGULUS_FEATURE_HASH_FINGERPRINTS() 1
+#else
+   #define LANGULUS_FEATURE_HASH_FINGERPRINTS() 0
+#endif
+
+/// Largest key or value (in bytes), that type-erased maps and sets keep on   
+/// the stack while inserting, and largest block Block::Swap swaps through    
+/// the stack. Bigger ones are heap-allocated, to keep stack usage in check   
+#ifndef LANGULUS_LOCAL_HANDLE_SIZE
+   #define LANGULUS_LOCAL_HANDLE_SIZE 256
+#endif
+
 /// Make the rest of the code aware, that Langulus::Anyness has been included 
 #define LANGULUS_LIBRARY_ANYNESS() 1
 
@@ -79,6 +95,18 @@ namespace Langulus
       template<class...T>
       concept NotContainer = ((not Container<T>) and ...);
 
+      /// Checks if all T are trivially relocatable, that is, they can be     
+      /// moved to a different place in memory bytewise, and their old place  
+      /// can be discarded without calling a destructor. Sparse and POD types 
+      /// always are. Other types opt in by naming themselves in a member     
+      /// alias T::CTTI_Relocatable - the concrete Anyness containers do,     
+      /// because they never point inside themselves. The tag names its type, 
+      /// so that it isn't inherited by types derived from a container        
+      template<class...T>
+      concept Relocatable = ((Sparse<T> or POD<T> or requires {
+            requires Exact<typename Decay<T>::CTTI_Relocatable, Decay<T>>;
+         }) and ...);
+
    } // namespace Langulus::CT
 
    namespace Anyness
@@ -113,12 +141,20 @@ namespace Langulus
       using UnorderedMap = Map<false>;
       using OrderedMap = Map<true>;
 
-      template<CT::Data, CT::Data, bool>
+      /// The way a hashmap walks its buckets when searching for a key        
+      ///   RobinHood - walks the probe sequence one info byte at a time      
+      ///   Swiss - matches 16 info bytes (and fingerprints) at a time        
+      /// Both engines share the exact same memory layout                     
+      enum class Engine {
+         RobinHood, Swiss
+      };
+
+      template<CT::Data, CT::Data, bool, Engine = Engine::RobinHood>
       struct TMap;
-      template<CT::Data K, CT::Data V>
-      using TOrderedMap = TMap<K, V, true>;
-      template<CT::Data K, CT::Data V>
-      using TUnorderedMap = TMap<K, V, false>;
+      template<CT::Data K, CT::Data V, Engine E = Engine::RobinHood>
+      using TOrderedMap = TMap<K, V, true, E>;
+      template<CT::Data K, CT::Data V, Engine E = Engine::RobinHood>
+      using TUnorderedMap = TMap<K, V, false, E>;
 
       struct BlockSet;
 
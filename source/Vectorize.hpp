@@ -0,0 +1,321 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Config.hpp"
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) or defined(_M_X64) or (defined(_M_IX86_FP) and _M_IX86_FP >= 2)
+   #include <emmintrin.h>
+   #define LANGULUS_ANYNESS_SSE2() 1
+#else
+   #define LANGULUS_ANYNESS_SSE2() 0
+#endif
+
+
+namespace Langulus::Anyness::Inner
+{
+
+   /// Types, whose equality is equivalent to equality of their bytes         
+   /// Floating point numbers are excluded, because -0 == +0, and NaN != NaN  
+   template<class...T>
+   concept BitwiseComparable = ((
+          CT::Sparse<T>
+      or  CT::BuiltinInteger<T>
+      or  CT::Character<T>
+      or  CT::Bool<T>
+      or  CT::Byte<T>
+      or ::std::is_enum_v<T>
+   ) and ...);
+
+   /// Load an unaligned word of SIZE bytes                                   
+   template<Offset SIZE> LANGULUS(ALWAYS_INLINED)
+   auto LoadWord(const Byte* ptr) noexcept {
+      using W = Conditional<SIZE == 1, ::std::uint8_t,
+                Conditional<SIZE == 2, ::std::uint16_t,
+                Conditional<SIZE == 4, ::std::uint32_t,
+                                       ::std::uint64_t>>>;
+      W result;
+      ::std::memcpy(&result, ptr, SIZE);
+      return result;
+   }
+
+   #if LANGULUS_ANYNESS_SSE2()
+      /// Compare 16 bytes for equality in lanes of SIZE bytes                
+      ///   @return a 16-bit mask, with all bits of a lane set, if it matches 
+      template<Offset SIZE> LANGULUS(ALWAYS_INLINED)
+      unsigned CompareLanes(__m128i a, __m128i b) noexcept {
+         if constexpr (SIZE == 1)
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+         else if constexpr (SIZE == 2)
+            return _mm_movemask_epi8(_mm_cmpeq_epi16(a, b));
+         else if constexpr (SIZE == 4)
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(a, b));
+         else {
+            // No 64-bit compare in SSE2 - both halves must match       
+            const auto eq = _mm_cmpeq_epi32(a, b);
+            const auto swapped = _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1));
+            return _mm_movemask_epi8(_mm_and_si128(eq, swapped));
+         }
+      }
+   #endif
+
+   /// Find an element of SIZE bytes inside an array, by comparing bytes      
+   ///   @tparam SIZE - size of each element: 1, 2, 4 or 8                    
+   ///   @tparam REVERSE - whether to search from the back                    
+   ///   @param data - the array to search in                                 
+   ///   @param count - number of elements in the array                       
+   ///   @param needle - the element to search for                            
+   ///   @return the index of the match, or count if not found                
+   template<Offset SIZE, bool REVERSE = false>
+   Offset FindBitwise(const Byte* data, const Count count, const Byte* needle) noexcept {
+      static_assert(SIZE == 1 or SIZE == 2 or SIZE == 4 or SIZE == 8,
+         "Unsupported element size");
+      const auto word = LoadWord<SIZE>(needle);
+
+      #if LANGULUS_ANYNESS_SSE2()
+         constexpr Count Lanes = 16 / SIZE;
+         __m128i pattern;
+         if constexpr (SIZE == 1)
+            pattern = _mm_set1_epi8(static_cast<char>(word));
+         else if constexpr (SIZE == 2)
+            pattern = _mm_set1_epi16(static_cast<short>(word));
+         else if constexpr (SIZE == 4)
+            pattern = _mm_set1_epi32(static_cast<int>(word));
+         else
+            pattern = _mm_set1_epi64x(static_cast<long long>(word));
+
+         if constexpr (not REVERSE) {
+            Offset i = 0;
+            for (; i + Lanes <= count; i += Lanes) {
+               const auto chunk = _mm_loadu_si128(
+                  reinterpret_cast<const __m128i*>(data + i * SIZE));
+               const auto mask = CompareLanes<SIZE>(chunk, pattern);
+               if (mask)
+                  return i + ::std::countr_zero(mask) / SIZE;
+            }
+
+            for (; i < count; ++i) {
+               if (LoadWord<SIZE>(data + i * SIZE) == word)
+                  return i;
+            }
+         }
+         else {
+            Offset i = count;
+            for (; i >= Lanes; i -= Lanes) {
+               const auto chunk = _mm_loadu_si128(
+                  reinterpret_cast<const __m128i*>(data + (i - Lanes) * SIZE));
+               const auto mask = CompareLanes<SIZE>(chunk, pattern);
+               if (mask)
+                  return i - Lanes + (31 - ::std::countl_zero(mask)) / SIZE;
+            }
+
+            while (i--) {
+               if (LoadWord<SIZE>(data + i * SIZE) == word)
+                  return i;
+            }
+         }
+      #else
+         if constexpr (not REVERSE) {
+            for (Offset i = 0; i < count; ++i) {
+               if (LoadWord<SIZE>(data + i * SIZE) == word)
+                  return i;
+            }
+         }
+         else {
+            for (Offset i = count; i--;) {
+               if (LoadWord<SIZE>(data + i * SIZE) == word)
+                  return i;
+            }
+         }
+      #endif
+
+      return count;
+   }
+
+   /// Find an element of any size inside an array, by comparing bytes        
+   /// Dispatches to the vectorized kernels for common sizes at runtime       
+   ///   @tparam REVERSE - whether to search from the back                    
+   ///   @param data - the array to search in                                 
+   ///   @param count - number of elements in the array                       
+   ///   @param needle - the element to search for                            
+   ///   @param size - the size of each element in bytes                      
+   ///   @return the index of the match, or count if not found                
+   template<bool REVERSE = false>
+   Offset FindBitwise(const Byte* data, const Count count, const Byte* needle, const Offset size) noexcept {
+      switch (size) {
+      case 1: return FindBitwise<1, REVERSE>(data, count, needle);
+      case 2: return FindBitwise<2, REVERSE>(data, count, needle);
+      case 4: return FindBitwise<4, REVERSE>(data, count, needle);
+      case 8: return FindBitwise<8, REVERSE>(data, count, needle);
+      }
+
+      if constexpr (not REVERSE) {
+         for (Offset i = 0; i < count; ++i) {
+            if (0 == ::std::memcmp(data + i * size, needle, size))
+               return i;
+         }
+      }
+      else {
+         for (Offset i = count; i--;) {
+            if (0 == ::std::memcmp(data + i * size, needle, size))
+               return i;
+         }
+      }
+
+      return count;
+   }
+
+   /// Count the number of leading bytes that are the same in two arrays      
+   ///   @param lhs - the first array                                         
+   ///   @param rhs - the second array                                        
+   ///   @param bytes - number of bytes to compare at most                    
+   ///   @return the number of matching leading bytes                         
+   inline Count MatchBytes(const Byte* lhs, const Byte* rhs, const Count bytes) noexcept {
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         for (; i + 16 <= bytes; i += 16) {
+            const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+            const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+            const auto mask = static_cast<unsigned>(
+               _mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) ^ 0xFFFFu;
+            if (mask)
+               return i + ::std::countr_zero(mask);
+         }
+      #endif
+
+      if constexpr (::std::endian::native == ::std::endian::little) {
+         // Compare a word at a time, the first differing bit tells the 
+         // first differing byte                                        
+         for (; i + 8 <= bytes; i += 8) {
+            const auto diff = LoadWord<8>(lhs + i) ^ LoadWord<8>(rhs + i);
+            if (diff)
+               return i + ::std::countr_zero(diff) / 8;
+         }
+      }
+
+      while (i < bytes and lhs[i] == rhs[i])
+         ++i;
+      return i;
+   }
+
+   /// Count the number of leading characters that are the same in two        
+   /// strings, ignoring the case of ASCII letters                            
+   ///   @param lhs - the first string                                        
+   ///   @param rhs - the second string                                       
+   ///   @param count - number of characters to compare at most               
+   ///   @return the number of matching leading characters                    
+   inline Count MatchLettersLoose(const char* lhs, const char* rhs, const Count count) noexcept {
+      constexpr auto lower = [](char c) noexcept -> char {
+         return (c >= 'A' and c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+      };
+
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         // Shift 'A'...'Z' to the bottom of the signed range, so that a
+         // single signed comparison tests for an upper case letter     
+         const auto shift = _mm_set1_epi8(static_cast<char>(-128 - 'A'));
+         const auto limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+         const auto flip = _mm_set1_epi8(0x20);
+         const auto toLower = [&](__m128i x) noexcept {
+            const auto upper = _mm_cmplt_epi8(_mm_add_epi8(x, shift), limit);
+            return _mm_or_si128(x, _mm_and_si128(upper, flip));
+         };
+
+         for (; i + 16 <= count; i += 16) {
+            const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+            const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+            const auto mask = static_cast<unsigned>(_mm_movemask_epi8(
+               _mm_cmpeq_epi8(toLower(a), toLower(b)))) ^ 0xFFFFu;
+            if (mask)
+               return i + ::std::countr_zero(mask);
+         }
+      #endif
+
+      while (i < count and lower(lhs[i]) == lower(rhs[i]))
+         ++i;
+      return i;
+   }
+
+   /// Number of info bytes, that are probed at once in hashmaps              
+   constexpr Offset GroupSize = 16;
+
+   /// Probe a group of info bytes of a robin-hood table at once              
+   ///   @param info - the first info byte in the group                       
+   ///   @param distance - the probe distance of the first byte in the group  
+   ///   @param candidates - [out] a bit for each byte in the group, whose    
+   ///      pair belongs to the probed bucket, up to the end of the sequence  
+   ///   @return the number of bytes in the group, that continue the probe    
+   ///      sequence - GroupSize if the sequence goes past the group          
+   inline Offset ProbeGroup(const ::std::uint8_t* info, const Offset distance, unsigned& candidates) noexcept {
+      unsigned same = 0, more = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(info));
+         const auto expected = _mm_add_epi8(
+            _mm_set1_epi8(static_cast<char>(distance)),
+            _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+         );
+
+         // Pairs exactly as far from their bucket are in the probed    
+         // bucket, pairs at least as far continue the probe sequence   
+         same = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, expected));
+         more = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(bytes, expected), bytes));
+      #else
+         for (Offset i = 0; i < GroupSize; ++i) {
+            same |= unsigned(info[i] == distance + i) << i;
+            more |= unsigned(info[i] >= distance + i) << i;
+         }
+      #endif
+
+      const auto run = static_cast<Offset>(::std::countr_one(more));
+      candidates = same & ((1u << run) - 1);
+      return run;
+   }
+
+   /// Find all bytes in a group, that are equal to a value                   
+   ///   @param bytes - the first byte in the group                           
+   ///   @param value - the value to search for                               
+   ///   @return a bit for each matching byte in the group                    
+   inline unsigned MatchGroup(const ::std::uint8_t* bytes, const ::std::uint8_t value) noexcept {
+      #if LANGULUS_ANYNESS_SSE2()
+         return _mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes)),
+            _mm_set1_epi8(static_cast<char>(value))
+         ));
+      #else
+         unsigned result = 0;
+         for (Offset i = 0; i < GroupSize; ++i)
+            result |= unsigned(bytes[i] == value) << i;
+         return result;
+      #endif
+   }
+
+   /// Number of elements, whose hashes are computed in one pass, when        
+   /// inserting many elements into hashmaps and sets at once                 
+   constexpr Count InsertBatchSize = 64;
+
+   /// How many elements ahead of placement their buckets are prefetched      
+   constexpr Offset PrefetchDistance = 8;
+
+   /// Hint the CPU to start loading a cache line, that is about to be        
+   /// written to - does nothing, if the platform has no such hints           
+   ///   @param ptr - an address inside the cache line to load                
+   inline void Prefetch(const void* ptr) noexcept {
+      #if LANGULUS_ANYNESS_SSE2()
+         _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+      #elif defined(__GNUC__) or defined(__clang__)
+         __builtin_prefetch(ptr, 1);
+      #else
+         (void) ptr;
+      #endif
+   }
+
+} // namespace Langulus::Anyness::Inner
@@ -13,6 +13,8 @@
 #include "../one/Handle.hpp"
 #include "../one/Own.hpp"
 #include <Core/Sequences.hpp>
+#include <vector>
+#include <unordered_map>
 
 
 namespace Langulus
@@ -150,11 +152,11 @@ namespace Langulus
       template<class...T>
       concept NotConstruct = ((not Construct<T>) and ...);
 
-      /// A serializer is any Block type, that has an inner type called       
+      /// A serializer is any type, that has an inner type called             
       /// SerializationRules, which holds settings on how data is assembled   
       template<class...T>
-      concept Serial = Block<T...> and ((requires {
-         typename T::SerializationRules; }) and ...);
+      concept Serial = ((requires {
+         typename Decay<T>::SerializationRules; }) and ...);
 
       
       namespace Inner
@@ -187,6 +189,18 @@ namespace Langulus
                return (Deref<Deint<T>>*) nullptr;
          }
 
+         /// Get the type, that a serializer converts elements to, before     
+         /// appending them - see CT::SerialItem                              
+         ///   @tparam T - the serializer                                     
+         ///   @return a nullptr pointer of the element type                  
+         template<class T>
+         consteval auto SerialItem() {
+            if constexpr (requires { typename T::Flat; })
+               return (typename T::Flat*) nullptr;
+            else
+               return (T*) nullptr;
+         }
+
       } // namespace Langulus::CT::Inner
       
       /// Nest-unfold any bounded array or std::range, and get most inner type
@@ -197,6 +211,12 @@ namespace Langulus
       template<class T, class UNLESS = void>
       using Unfold = Deptr<decltype(Inner::Unfold<T, UNLESS>())>;
 
+      /// Serializers, that accumulate data in parts, like TextBuilder, can   
+      /// define the contiguous container they produce as Flat, so that       
+      /// elements are converted to it, instead of to the serializer itself   
+      template<class T>
+      using SerialItem = Deptr<decltype(Inner::SerialItem<T>())>;
+
       /// Check if T is constructible with each of the provided arguments,    
       /// either directly, or by unfolding that argument                      
       template<class T, class...A>
@@ -310,6 +330,10 @@ namespace Langulus::Anyness
    template<class>
    struct TBlockIterator;
 
+   /// Check if memory is inside a MappedFile - blocks, that view such        
+   /// memory, take authority over it before they are changed                 
+   NOD() LANGULUS_API(ANYNESS) bool IsMapped(const void*) noexcept;
+
    #if LANGULUS_FEATURE(COMPRESSION)
       /// Compression types, analogous to zlib's                              
       enum class Compression {
@@ -374,6 +398,8 @@ namespace Langulus::Anyness
       friend class Own;
       template<class>
       friend class Ref;
+      template<class>
+      friend class LocalBlock;
 
       friend class Neat;
       friend class Construct;
@@ -460,6 +486,7 @@ namespace Langulus::Anyness
       NOD() constexpr bool IsDense() const noexcept;
       NOD() constexpr bool IsSparse() const noexcept;
       NOD() constexpr bool IsPOD() const noexcept;
+      NOD() constexpr bool IsRelocatable() const noexcept;
       NOD() constexpr bool IsResolvable() const noexcept;
       NOD() constexpr bool IsDeep() const noexcept;
       NOD() constexpr bool IsBlock() const noexcept;
@@ -602,6 +629,7 @@ namespace Langulus::Anyness
       void SwapIndices(CT::Index auto, CT::Index auto);
       template<class T> requires CT::Block<Deint<T>>
       void Swap(T&&);
+      void RelocateFrom(CT::Block auto&);
 
       template<bool REVERSE = false>
       Count GatherFrom(const CT::Block auto&);
@@ -796,9 +824,6 @@ namespace Langulus::Anyness
       template<bool REVERSE = false>
       NOD() Index FindBlock(const CT::Block auto&, CT::Index auto) const noexcept;
 
-      template<bool ASCEND = false>
-      void Sort() requires (TypeErased or CT::Sortable<TYPE, TYPE>);
-
       NOD() bool  CompareLoose(const CT::Block auto&) const noexcept;
       NOD() Count Matches(const CT::Block auto&) const noexcept;
       NOD() Count MatchesLoose(const CT::Block auto&) const noexcept;
@@ -816,6 +841,36 @@ namespace Langulus::Anyness
       Count GatherPolarInner(DMeta, CT::Block auto&, DataState) const;
 
    public:
+      ///                                                                     
+      ///   Sorting                                                           
+      ///                                                                     
+      template<bool ASCEND = false, bool STABLE = false>
+      void Sort() requires (TypeErased or CT::Sortable<TYPE, TYPE>);
+
+      template<bool STABLE = false>
+      void SortWith(auto&&);
+
+   protected:
+      void PermuteInner(Offset*);
+
+   public:
+      ///                                                                     
+      ///   Parallel algorithms                                               
+      ///                                                                     
+      template<bool MUTABLE = false>
+      Count ParallelForEach(auto&&) const;
+      Count ParallelForEach(auto&&);
+
+      template<bool ASCEND = false>
+      void ParallelSort() requires (TypeErased or CT::Sortable<TYPE, TYPE>);
+
+      template<CT::NoIntent T1>
+      NOD() Index ParallelFind(const T1&) const
+      requires (TypeErased or CT::Comparable<TYPE, T1>);
+
+      NOD() auto Reduce(auto&&, auto&&) const requires (not TypeErased);
+      void TransformInto(CT::Block auto&, auto&&) const requires (not TypeErased);
+
       ///                                                                     
       ///   Memory management                                                 
       ///                                                                     
@@ -834,6 +889,8 @@ namespace Langulus::Anyness
       template<bool CREATE = false>
       void AllocateInner(Count);
       void AllocateFresh(const AllocationRequest&);
+      template<Offset SIZE>
+      bool AllocateLocal(LocalAllocation<SIZE>&, Count) noexcept;
 
       template<bool DEEP = false>
       void Keep() const noexcept;
@@ -841,6 +898,8 @@ namespace Langulus::Anyness
       void KeepInner(MASK = {}) const noexcept;
 
       void Free();
+      template<class MASK = std::nullptr_t>
+      void FreeShared(MASK = {});
       template<bool DESTROY = true, class MASK = std::nullptr_t>
       void FreeInner(MASK = {});
       template<class MASK>
@@ -954,8 +1013,8 @@ namespace Langulus::Anyness
       ///   Compression                                                       
       ///                                                                     
       #if LANGULUS_FEATURE(COMPRESSION)
-         Size Compress(Block&, Compression = Compression::Default) const;
-         Size Decompress(Block&) const;
+         Count Compress(Bytes&, Compression = Compression::Default) const;
+         Count Decompress(Bytes&) const;
       #endif
 
       ///                                                                     
@@ -971,33 +1030,73 @@ namespace Langulus::Anyness
       Count Serialize(CT::Serial auto&) const;
 
    protected:
+      /// Written at the start of each binary stream                          
       #pragma pack(push, 1)
       struct Header {
          enum { Default, BigEndian };
 
+         /// Version 1 writes each meta once per stream, and then refers      
+         /// to it by a varint index in a per-stream dictionary               
+         /// Version 2 pads dense POD to its alignment, relative to the       
+         /// header, so that it can be referenced in place                    
+         static constexpr ::std::uint16_t Version = 2;
+
          ::std::uint8_t  mAtomSize = sizeof(Offset);
          ::std::uint8_t  mFlags    = BigEndianMachine ? BigEndian : Default;
-         ::std::uint16_t mVersion  = 0;
+         ::std::uint16_t mVersion  = Version;
          ::std::uint32_t mDefinitionCount = 0;
       };
       #pragma pack(pop)
 
-      using Loader = void(*)(Block&, Count);
+      /// The state of a binary stream, while it is being (de)serialized      
+      struct Environment {
+         Header mHeader;
+         // Metas in order of appearance, one list per kind of meta     
+         ::std::vector<AMeta> mDefinitions[4];
+         // Index of each written meta in its list, so that serializing 
+         // doesn't search the lists                                    
+         ::std::unordered_map<AMeta, Offset> mIndices;
+         // Offset of the header, that padding is relative to           
+         Offset mOrigin = 0;
+         // Reference dense POD and texts in the deserialized bytes,    
+         // instead of copying them                                     
+         bool mView = false;
+
+         NOD() constexpr Offset PaddingAt(Offset, Size) const noexcept;
+
+         template<CT::Meta META>
+         NOD() static constexpr Offset KindOf() noexcept;
+         template<CT::Meta META>
+         NOD() auto& DefinitionsOf() noexcept;
+      };
+
+      /// Provides the bytes in [offset, offset + count) of a stream, when    
+      /// they aren't all in the deserialized container - see ByteStream      
+      using Loader = const Byte*(*)(Block&, Offset, Count);
+
+      /// Large POD payloads are read in pieces of this size, so that a       
+      /// stream never has to hold more than that at once                     
+      static constexpr Count StreamPiece = 64 * 1024;
 
       template<class>
       Count SerializeToText(CT::Serial auto&) const;
       template<class>
-      Count SerializeToBinary(CT::Serial auto&) const;
+      Count SerializeToBinary(CT::Serial auto&, Environment&) const;
+      static void SerializeVarint(CT::Serial auto&, Offset);
+      static void SerializeMeta(CT::Serial auto&, Environment&, const CT::Meta auto&);
       template<class, class...RULES>
       Count SerializeByRules(CT::Serial auto&, Types<RULES...>) const;
       template<class, class RULE>
       Count SerializeApplyRule(CT::Serial auto&) const;
 
       template<class>
-      Offset DeserializeBinary(CT::Block auto&, const Header&, Offset = 0, Loader = nullptr) const;
-      void ReadInner(Offset, Count, Loader) const;
-      NOD() Offset DeserializeAtom(Offset&, Offset, const Header&, Loader) const;
-      NOD() Offset DeserializeMeta(CT::Meta auto&, Offset, const Header&, Loader) const;
+      Offset DeserializeBinary(CT::Block auto&, Environment&, Offset = 0, Loader = nullptr) const;
+      NOD() const Byte* ReadInner(Offset, Count, Loader) const;
+      NOD() Offset DeserializeRaw(void*, Count, Offset, Loader) const;
+      void DeserializeView(CT::Block auto&, Count, Offset) const;
+      NOD() Offset DeserializeAtom(Offset&, Offset, const Environment&, Loader) const;
+      NOD() Offset DeserializeVarint(Offset&, Offset, Loader) const;
+      NOD() Offset DeserializeMeta(CT::Meta auto&, Offset, Environment&, Loader) const;
    };
 
    template<class BLOCK = void>
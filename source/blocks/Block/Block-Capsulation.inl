@@ -427,6 +427,22 @@ namespace Langulus::Anyness
          return CT::POD<Decay<TYPE>>;
    }
 
+   /// Check if block contains trivially relocatable data, that can be moved  
+   /// in memory bytewise, without invoking constructors and destructors      
+   /// Type-erased blocks can't see the CTTI_Relocatable tag, so besides POD  
+   /// and sparse data, they rely on reflection - types reflected as binary   
+   /// compatible with Block are relocatable, while derived types that add    
+   /// members (and could point inside themselves) are not                    
+   ///   @return true if contained data is trivially relocatable              
+   template<class TYPE> LANGULUS(INLINED)
+   constexpr bool Block<TYPE>::IsRelocatable() const noexcept {
+      if constexpr (TypeErased)
+         return mType and (mType->mIsSparse or mType->mIsPOD
+             or mType->template CastsTo<A::Block, true>());
+      else
+         return CT::Relocatable<TYPE>;
+   }
+
    /// Check if block contains resolvable items, that is, items that have a   
    /// reflected GetBlock() function, that can be used to represent           
    /// themselves as their most concretely typed block                        
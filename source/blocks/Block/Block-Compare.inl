@@ -8,6 +8,7 @@
 #pragma once
 #include "../Block.hpp"
 #include "../../text/Text.hpp"
+#include "../../Vectorize.hpp"
 
 #if 0
    #define VERBOSE(...)     Logger::Verbose(__VA_ARGS__)
@@ -476,7 +477,24 @@ namespace Langulus::Anyness
    template<class TYPE> template<bool REVERSE, CT::NoIntent T1>
    Index Block<TYPE>::Find(const T1& item, Offset cookie) const noexcept
    requires (TypeErased or CT::Comparable<TYPE, T1>) {
+      if (cookie >= mCount)
+         return IndexNone;
+
       if constexpr (not TypeErased) {
+         if constexpr (CT::Similar<TYPE, T1> and Inner::BitwiseComparable<TYPE>) {
+            // Search by comparing bytes, many elements at a time       
+            const auto found = REVERSE
+               ? Inner::FindBitwise<sizeof(TYPE), true>(
+                  mRaw, mCount - cookie, reinterpret_cast<const Byte*>(&item))
+               : Inner::FindBitwise<sizeof(TYPE), false>(
+                  mRaw + cookie * sizeof(TYPE), mCount - cookie,
+                  reinterpret_cast<const Byte*>(&item));
+
+            if (found == mCount - cookie)
+               return IndexNone;
+            return REVERSE ? found : found + cookie;
+         }
+
          auto start = REVERSE
             ? GetRawEnd() - 1 - cookie
             : GetRaw() + cookie;
@@ -519,6 +537,25 @@ namespace Langulus::Anyness
             }
          }*/
 
+         if constexpr (CT::POD<T1> and CT::Dense<T1>) {
+            // POD elements are compared by their bytes anyway, so      
+            // search many elements at a time, when types match         
+            if (mType->mIsPOD and not mType->mIsSparse
+            and mType->mSize == sizeof(T1) and IsSimilar<T1>()) {
+               const auto found = REVERSE
+                  ? Inner::FindBitwise<true>(
+                     mRaw, mCount - cookie,
+                     reinterpret_cast<const Byte*>(&item), sizeof(T1))
+                  : Inner::FindBitwise<false>(
+                     mRaw + cookie * sizeof(T1), mCount - cookie,
+                     reinterpret_cast<const Byte*>(&item), sizeof(T1));
+
+               if (found == mCount - cookie)
+                  return IndexNone;
+               return REVERSE ? found : found + cookie;
+            }
+         }
+
          // Item is not in this block's memory, so we start comparing by
          // values                                                      
          Offset i = REVERSE ? mCount - 1 - cookie : cookie;
@@ -871,7 +908,13 @@ namespace Langulus::Anyness
       if constexpr (not TypeErased and not OTHER::TypeErased) {
          using T2 = TypeOf<OTHER>;
 
-         if constexpr (CT::Comparable<TYPE, T2>) {
+         if constexpr (CT::Similar<TYPE, T2> and Inner::BitwiseComparable<TYPE>) {
+            // Compare bytes, many elements at a time                   
+            const auto count = ::std::min(mCount, other.mCount);
+            return Inner::MatchBytes(mRaw, other.mRaw,
+               count * sizeof(TYPE)) / sizeof(TYPE);
+         }
+         else if constexpr (CT::Comparable<TYPE, T2>) {
             auto t1 = GetRaw();
             auto t2 = other.GetRaw();
             const auto t1end = GetRawEnd();
@@ -884,7 +927,32 @@ namespace Langulus::Anyness
          }
          else return false;
       }
-      else TODO();
+      else {
+         // At least one of the blocks is type-erased                   
+         if (not IsSimilar(other))
+            return 0;
+
+         const auto type = GetType();
+         const auto count = ::std::min(mCount, other.mCount);
+         if (type->mIsPOD or type->mIsSparse) {
+            // Compare bytes, many elements at a time                   
+            return Inner::MatchBytes(mRaw, other.mRaw,
+               count * type->mSize) / type->mSize;
+         }
+         else if (type->mComparer) {
+            // Call compare operator for each element pair              
+            Offset i = 0;
+            auto lhs = mRaw;
+            auto rhs = other.mRaw;
+            while (i < count and type->mComparer(lhs, rhs)) {
+               lhs += type->mSize;
+               rhs += type->mSize;
+               ++i;
+            }
+            return i;
+         }
+         else return 0;
+      }
    }
 
    /// Compare loosely with another, ignoring upper-case if both blocks       
@@ -900,10 +968,19 @@ namespace Langulus::Anyness
       if constexpr (not TypeErased and not OTHER::TypeErased) {
          using T2 = TypeOf<OTHER>;
 
-         if constexpr (CT::Character<TYPE> and CT::Similar<TYPE, T2>) {
+         if constexpr (CT::Character<TYPE> and CT::Similar<TYPE, T2>
+         and sizeof(TYPE) == 1) {
+            // Compare letters, many at a time                          
+            return Inner::MatchLettersLoose(
+               reinterpret_cast<const char*>(mRaw),
+               reinterpret_cast<const char*>(other.mRaw),
+               ::std::min(mCount, other.mCount)
+            );
+         }
+         else if constexpr (CT::Character<TYPE> and CT::Similar<TYPE, T2>) {
             auto t1 = GetRaw();
             auto t2 = other.GetRaw();
-            const auto tend = GetRawEnd();
+            const auto tend = GetRaw() + ::std::min(mCount, other.mCount);
             while (t1 < tend and ::std::tolower(*t1) == ::std::tolower(*t2)) {
                ++t1;
                ++t2;
@@ -923,48 +1000,6 @@ namespace Langulus::Anyness
       return Find(what) != IndexNone;
    }
 
-   /// Sort the contents of this container using a static type                
-   ///   @attention assumes T is the type of the container                    
-   ///   @attention this is the most naive of sorting algorithms              
-   ///   @tparam ASCEND - whether to sort in ascending order (123)            
-   template<class TYPE> template<bool ASCEND>
-   void Block<TYPE>::Sort() requires (TypeErased or CT::Sortable<TYPE, TYPE>) {
-      auto lhs = GetRaw();
-      const auto lhsEnd = lhs + mCount;
-      while (lhs != lhsEnd) {
-         auto rhs = GetRaw();
-         while (rhs != lhs) {
-            if constexpr (ASCEND) {
-               if (*lhs < *rhs)
-                  ::std::swap(*lhs, *rhs);
-            }
-            else {
-               if (*lhs > *rhs)
-                  ::std::swap(*lhs, *rhs);
-            }
-
-            ++rhs;
-         }
-
-         ++rhs;
-
-         while (rhs != lhsEnd) {
-            if constexpr (ASCEND) {
-               if (*lhs < *rhs)
-                  ::std::swap(*lhs, *rhs);
-            }
-            else {
-               if (*lhs > *rhs)
-                  ::std::swap(*lhs, *rhs);
-            }
-
-            ++rhs;
-         }
-
-         ++lhs;
-      }
-   }
-
 } // namespace Langulus::Anyness
 
 #undef VERBOSE_TAB
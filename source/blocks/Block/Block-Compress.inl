@@ -0,0 +1,59 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Block.hpp"
+#include "../../many/Bytes.hpp"
+#include "../../verbs/Compress.hpp"
+
+#if LANGULUS_FEATURE(COMPRESSION)
+
+namespace Langulus::Anyness
+{
+
+   /// Compress the memory of the block                                       
+   /// Memory is compressed as it is, so sparse and non-POD blocks can be     
+   /// compressed, too, but pointers aren't followed - serialize the block    
+   /// first, if the result is going to be stored or sent elsewhere           
+   ///   @param result - [out] the compressed bytes are appended here - the   
+   ///      container is marked as compressed only if it was empty, because   
+   ///      otherwise it holds uncompressed bytes, too                        
+   ///   @param level - the compression level                                 
+   ///   @return the number of compressed bytes                               
+   template<class TYPE>
+   Count Block<TYPE>::Compress(Bytes& result, Compression level) const {
+      if (IsEmpty())
+         return 0;
+
+      // The thread's compressor is reused, so that its state isn't     
+      // allocated for every block                                      
+      auto& compressor = Compressor::GetLocal(level);
+      const bool fresh = result.IsEmpty();
+      const auto written = compressor.Update(mRaw, GetBytesize(), result, true);
+      if (fresh)
+         result.mState += DataState::Compressed;
+      return written;
+   }
+
+   /// Decompress the memory of the block                                     
+   ///   @param result - [out] the decompressed bytes are appended here       
+   ///   @return the number of decompressed bytes                             
+   template<class TYPE>
+   Count Block<TYPE>::Decompress(Bytes& result) const {
+      if (IsEmpty())
+         return 0;
+
+      auto& decompressor = Decompressor::GetLocal();
+      const auto written = decompressor.Update(mRaw, GetBytesize(), result);
+      LANGULUS_ASSERT(decompressor.IsFinished(), Convert,
+         "Compressed data is incomplete");
+      return written;
+   }
+
+} // namespace Langulus::Anyness
+
+#endif
\ No newline at end of file
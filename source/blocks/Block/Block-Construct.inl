@@ -394,18 +394,28 @@ namespace Langulus::Anyness
    }
 
    /// Branch the block, by doing a shallow copy                              
+   /// Views into mapped files take authority over their elements instead,    
+   /// before being changed - other static blocks, like disowned literals,    
+   /// are left as they are                                                   
    template<class TYPE>
    void Block<TYPE>::BranchOut() {
+      if (IsStatic() and IsMapped(mRaw)) {
+         TakeAuthority();
+         return;
+      }
+
       if (GetUses() <= 1)
          return;
       
       // Block is used from multiple locations, and we must branch out  
-      // before changing it - only this copy will be affected           
+      // before changing it - only this copy will be affected. The      
+      // original is released only after copying, because other owners  
+      // might release it in the meantime                               
       if constexpr (not TypeErased) {
          if constexpr (CT::ReferMakable<TYPE>) {
-            const auto backup = *this;
-            const_cast<Allocation*>(mEntry)->Free();
+            auto backup = *this;
             new (this) TMany<TYPE> {Copy(reinterpret_cast<const TMany<TYPE>&>(backup))};
+            backup.FreeShared();
          }
          else LANGULUS_THROW(Construct,
             "Block needs to branch out, but type doesn't support Intent::Copy"
@@ -413,9 +423,9 @@ namespace Langulus::Anyness
       }
       else {
          if (mType->mCopyConstructor) {
-            const auto backup = *this;
-            const_cast<Allocation*>(mEntry)->Free();
+            auto backup = *this;
             new (this) Many {Copy(reinterpret_cast<const Many&>(backup))};
+            backup.FreeShared();
          }
          else LANGULUS_THROW(Construct,
             "Block needs to branch out, but type doesn't support Intent::Copy"
@@ -10,8 +10,10 @@
 #include "../BlockMap.hpp"
 #include "../BlockSet.hpp"
 #include "../../text/Text.hpp"
+#include "../../text/Symbol.hpp"
 #include "../../many/Bytes.hpp"
 #include "../../many/Trait.hpp"
+#include <algorithm>
 
 
 namespace Langulus::Anyness
@@ -154,10 +156,22 @@ namespace Langulus::Anyness
    template<class TYPE>
    Count Block<TYPE>::Serialize(CT::Serial auto& out) const {
       using OUT = Deref<decltype(out)>;
-      if constexpr (CT::Bytes<OUT>)
-         return SerializeToBinary<void>(out);
-      else
-         return SerializeToText<void>(out);
+      if constexpr (CT::Bytes<OUT>) {
+         // Binary streams begin with a header, that is patched after   
+         // serialization, so that it knows the number of definitions   
+         const auto initial = out.GetCount();
+         Environment env;
+         env.mOrigin = initial;
+         out += Bytes::From(Disown(
+            reinterpret_cast<const Byte*>(&env.mHeader)), sizeof(Header));
+         SerializeToBinary<void>(out, env);
+
+         for (auto& definitions : env.mDefinitions)
+            env.mHeader.mDefinitionCount += static_cast<::std::uint32_t>(definitions.size());
+         ::std::memcpy(out.GetRaw() + initial, &env.mHeader, sizeof(Header));
+         return out.GetCount() - initial;
+      }
+      else return SerializeToText<void>(out);
    }
    
    /// Serialize block to any string serializer                               
@@ -264,7 +278,7 @@ namespace Langulus::Anyness
 
             // No rules defined, or didn't apply to data, so time to    
             // rely on the reflected converters instead                 
-            TMany<OUT> converted;
+            TMany<CT::SerialItem<OUT>> converted;
             if (not Convert(converted)) {
                if constexpr (OUT::SerializationRules::CriticalFailure) {
                   // Couldn't convert elements, and that is marked as   
@@ -277,7 +291,7 @@ namespace Langulus::Anyness
                else {
                   // Couldn't convert elements, but since that failure  
                   // isn't marked as critical, we can just inform about 
-                  to += OUT("/* Couldn't serialize ", mCount,
+                  to += CT::SerialItem<OUT>("/* Couldn't serialize ", mCount,
                      " item(s) of type `", GetToken(),
                      "` as `", converted.GetToken(), "` */");
                   return to.GetCount() - initial;
@@ -299,7 +313,7 @@ namespace Langulus::Anyness
                   if (not converted[i]) {
                      // This is reached only if non-critical failure    
                      // Just insert a comment to notify of the error    
-                     to += OUT(
+                     to += CT::SerialItem<OUT>(
                         "/* Item #", i, " of type `", GetToken(),
                         "` was serialized to an empty `", converted.GetToken(), "` */");
                   }
@@ -399,7 +413,7 @@ namespace Langulus::Anyness
 
             // No rules defined, or didn't apply to data, so time to    
             // rely on the reflected converters instead                 
-            TMany<OUT> converted;
+            TMany<CT::SerialItem<OUT>> converted;
             if (not Convert(converted)) {
                if constexpr (OUT::SerializationRules::CriticalFailure) {
                   // Couldn't convert elements, and that is marked as   
@@ -412,7 +426,7 @@ namespace Langulus::Anyness
                else {
                   // Couldn't convert elements, but since that failure  
                   // isn't marked as critical, we can just inform about 
-                  to += OUT("/* Couldn't serialize ", mCount,
+                  to += CT::SerialItem<OUT>("/* Couldn't serialize ", mCount,
                      " item(s) of type `", GetToken(),
                      "` as `", converted.GetToken(), "` */");
                   return to.GetCount() - initial;
@@ -434,7 +448,7 @@ namespace Langulus::Anyness
                   if (not converted[i]) {
                      // This is reached only if non-critical failure    
                      // Just insert a comment to notify of the error    
-                     to += OUT(
+                     to += CT::SerialItem<OUT>(
                         "/* Item #", i, " of type `", GetToken(),
                         "` was serialized to an empty `", converted.GetToken(), "` */");
                   }
@@ -493,7 +507,7 @@ namespace Langulus::Anyness
                if constexpr (RULE::sStart < Serial::Operator::OpCounter)
                   to += RULE::sStart;
 
-               to += static_cast<OUT>(As<Type>(i));
+               to += static_cast<CT::SerialItem<OUT>>(As<Type>(i));
 
                if constexpr (RULE::sEnd < Serial::Operator::OpCounter)
                   to += RULE::sEnd;
@@ -522,7 +536,7 @@ namespace Langulus::Anyness
                   if constexpr (RULE::sStart < Serial::Operator::OpCounter)
                      to += RULE::sStart;
 
-                  to += static_cast<OUT>(As<Type>(i));
+                  to += static_cast<CT::SerialItem<OUT>>(As<Type>(i));
 
                   if constexpr (RULE::sEnd < Serial::Operator::OpCounter)
                      to += RULE::sEnd;
@@ -544,9 +558,10 @@ namespace Langulus::Anyness
    ///   @tparam NEXT - the type we're serializing - void for type-erasure    
    ///      if both NEXT and THIS are type-erased, type will be serialized    
    ///   @param to - [out] the serialized data goes here                      
+   ///   @param env - the stream environment                                  
    ///   @return the number of written bytes                                  
    template<class TYPE> template<class NEXT>
-   Count Block<TYPE>::SerializeToBinary(CT::Serial auto& to1) const {
+   Count Block<TYPE>::SerializeToBinary(CT::Serial auto& to1, Environment& env) const {
       auto& to = to1; //Workaround: needed due to really weird clang error  
       //using OUT = Deref<decltype(to)>;
       const auto initial = to.GetCount();
@@ -554,7 +569,7 @@ namespace Langulus::Anyness
       if constexpr (CT::TypeErased<NEXT>) {
          to += Bytes {GetCount()};
          to += Bytes {GetUnconstrainedState()};
-         to += Bytes {GetType()};
+         SerializeMeta(to, env, GetType());
       }
 
       if (IsEmpty() or IsUntyped())
@@ -562,8 +577,8 @@ namespace Langulus::Anyness
 
       if (IsDeep()) {
          // If data is deep, nest-serialize each sub-block              
-         ForEach([&to](const Block<>& block) {
-            block.SerializeToBinary<void>(to);
+         ForEach([&to, &env](const Block<>& block) {
+            block.SerializeToBinary<void>(to, env);
          });
 
          return to.GetCount() - initial;
@@ -571,30 +586,40 @@ namespace Langulus::Anyness
       else if (CastsTo<AMeta>()) {
          // Serialize meta                                              
          ForEach(
-            [&to](DMeta meta) noexcept {to += Bytes {meta};},
-            [&to](VMeta meta) noexcept {to += Bytes {meta};},
-            [&to](TMeta meta) noexcept {to += Bytes {meta};},
-            [&to](CMeta meta) noexcept {to += Bytes {meta};}
+            [&to, &env](DMeta meta) {SerializeMeta(to, env, meta);},
+            [&to, &env](VMeta meta) {SerializeMeta(to, env, meta);},
+            [&to, &env](TMeta meta) {SerializeMeta(to, env, meta);},
+            [&to, &env](CMeta meta) {SerializeMeta(to, env, meta);}
          );
 
          return to.GetCount() - initial;
       }
       else if (IsPOD()) {
          // If data is POD, optimize by directly memcpying it           
-         const auto denseStride = GetStride();
-         const auto byteCount = denseStride * GetCount();
-         to.AllocateMore(to.GetCount() + byteCount);
-
          if (IsSparse()) {
-            // ... pointer by pointer if sparse                         
+            // ... by gathering the pointees into a region, that is     
+            // reserved only once, if sparse                            
+            const auto denseStride = GetType()->mDeptr->mSize;
+            auto region = to.Extend(denseStride * GetCount());
+            auto out = region.GetRaw();
             auto p = mRawSparse;
             const auto pEnd = p + GetCount();
-            while (p != pEnd)
-               to += Bytes::From(Disown(p++), denseStride);
+            while (p != pEnd) {
+               LANGULUS_ASSUME(DevAssumes, *p,
+                  "Can't serialize a null pointer as POD");
+               ::std::memcpy(out, *p++, denseStride);
+               out += denseStride;
+            }
          }
          else {
-            // ... at once if dense                                     
-            to += Bytes::From(Disown(mRaw), byteCount);
+            // ... at once if dense, after padding it to its alignment, 
+            // so that it can be referenced in place, when loaded       
+            const auto padding = env.PaddingAt(to.GetCount(), GetType()->mAlignment);
+            if (padding) {
+               auto region = to.Extend(padding);
+               ::std::memset(region.GetRaw(), 0, padding);
+            }
+            to += Bytes::From(Disown(mRaw), GetBytesize());
          }
 
          return to.GetCount() - initial;
@@ -607,13 +632,18 @@ namespace Langulus::Anyness
                to += Bytes {text.GetCount()};
                to += Bytes::From(Disown(text.mRaw), text.mCount);
             },
+            [&to](const Symbol& symbol) {
+               to += Bytes {symbol.GetCount()};
+               to += Bytes::From(Disown(reinterpret_cast<Byte*>(
+                  const_cast<Letter*>(symbol.GetRaw()))), symbol.GetCount());
+            },
             [&to](const Bytes& bytes) {
                to += Bytes {bytes.mCount};
                to += bytes;
             },
-            [&to](const Trait& trait) {
-               to += Bytes {trait.GetTrait()};
-               trait.SerializeToBinary<void>(to);
+            [&to, &env](const Trait& trait) {
+               SerializeMeta(to, env, trait.GetTrait());
+               trait.SerializeToBinary<void>(to, env);
             }
          );
 
@@ -626,7 +656,7 @@ namespace Langulus::Anyness
          for (Count i = 0; i < GetCount(); ++i) {
             auto element = GetElementResolved(i);
             if (IsResolvable())
-               to += Bytes {element.GetType()};
+               SerializeMeta(to, env, element.GetType());
 
             // Serialize all reflected bases                            
             for (auto& base : element.GetType()->mBases) {
@@ -635,13 +665,13 @@ namespace Langulus::Anyness
                   continue;
 
                const auto baseBlock = element.GetBaseMemory(base);
-               baseBlock.template SerializeToBinary<RTTI::Base>(to);
+               baseBlock.template SerializeToBinary<RTTI::Base>(to, env);
             }
 
             // Serialize all reflected members                          
             for (auto& member : element.GetType()->mMembers) {
                const auto memberBlock = element.GetMember(member, 0);
-               memberBlock.template SerializeToBinary<RTTI::Member>(to);
+               memberBlock.template SerializeToBinary<RTTI::Member>(to, env);
             }
          }
 
@@ -654,31 +684,174 @@ namespace Langulus::Anyness
       return 0;
    }
 
-   ///                                                                        
+   /// Get the index of the definition list for a kind of meta                
+   ///   @tparam META - the kind of meta                                      
+   ///   @return the index inside mDefinitions                                
+   template<class TYPE> template<CT::Meta META> LANGULUS(INLINED)
+   constexpr Offset Block<TYPE>::Environment::KindOf() noexcept {
+      if constexpr (CT::Same<META, DMeta>)
+         return 0;
+      else if constexpr (CT::Same<META, VMeta>)
+         return 1;
+      else if constexpr (CT::Same<META, TMeta>)
+         return 2;
+      else if constexpr (CT::Same<META, CMeta>)
+         return 3;
+      else
+         static_assert(false, "Unsupported meta");
+   }
+
+   /// Get the definitions of a kind of meta, that are in the stream so far   
+   ///   @tparam META - the kind of meta                                      
+   ///   @return the definitions, in order of appearance                      
+   template<class TYPE> template<CT::Meta META> LANGULUS(INLINED)
+   auto& Block<TYPE>::Environment::DefinitionsOf() noexcept {
+      return mDefinitions[KindOf<META>()];
+   }
+
+   /// Get the number of padding bytes, that align an offset, relative to     
+   /// the header of the stream                                               
+   ///   @param at - the offset to align                                      
+   ///   @param alignment - the required alignment                            
+   ///   @return the number of padding bytes                                  
+   template<class TYPE> LANGULUS(INLINED)
+   constexpr Offset Block<TYPE>::Environment::PaddingAt(
+      const Offset at, const Size alignment
+   ) const noexcept {
+      if (alignment <= 1)
+         return 0;
+      const auto misalignment = (at - mOrigin) % alignment;
+      return misalignment ? alignment - misalignment : 0;
+   }
+
+   /// Write an unsigned integer, using as few bytes as possible              
+   /// Each byte carries seven bits, and its highest bit marks, that more     
+   /// bytes follow (LEB128)                                                  
+   ///   @param to - [out] the serialized data goes here                      
+   ///   @param value - the number to write                                   
+   template<class TYPE> LANGULUS(INLINED)
+   void Block<TYPE>::SerializeVarint(CT::Serial auto& to, Offset value) {
+      Byte encoded[(sizeof(Offset) * 8 + 6) / 7];
+      Count size = 0;
+      do {
+         encoded[size++] = static_cast<Byte>((value & 0x7F) | (value > 0x7F ? 0x80 : 0));
+         value >>= 7;
+      }
+      while (value);
+
+      to += Bytes::From(Disown(static_cast<const Byte*>(encoded)), size);
+   }
+
+   /// Write a meta to a binary stream                                        
+   /// Only the first occurence of a meta writes its token - all following    
+   /// ones write only its index in the stream's dictionary                   
+   ///   @param to - [out] the serialized data goes here                      
+   ///   @param env - the stream environment, where the dictionary is         
+   ///   @param meta - the meta to write                                      
    template<class TYPE> LANGULUS(INLINED)
-   void Block<TYPE>::ReadInner(Offset start, Count count, Loader loader) const {
-      if (start >= mCount or mCount - start < count) {
-         LANGULUS_ASSERT(loader, Access, "Reader lacks loader");
-         loader(const_cast<Block&>(*this), count - (mCount - start));
+   void Block<TYPE>::SerializeMeta(
+      CT::Serial auto& to, Environment& env, const CT::Meta auto& meta
+   ) {
+      using META = Deref<decltype(meta)>;
+      if (not meta) {
+         // Zero is reserved for missing metas                          
+         SerializeVarint(to, 0);
+         return;
+      }
+
+      auto& definitions = env.template DefinitionsOf<META>();
+      const AMeta key = meta;
+      const auto [found, inserted] = env.mIndices.try_emplace(
+         key, static_cast<Offset>(definitions.size()));
+      SerializeVarint(to, found->second + 1);
+      if (not inserted)
+         return;
+
+      // The index is one past the last definition, so the token        
+      // follows, and the meta is added to the dictionary               
+      const auto token = meta->mToken;
+      SerializeVarint(to, static_cast<Offset>(token.size()));
+      to += Bytes::From(Disown(reinterpret_cast<const Byte*>(token.data())), token.size());
+      definitions.push_back(key);
+   }
+
+   /// Get a number of serialized bytes, pulling them from the loader, if    
+   /// any - the loader maps stream offsets to its own memory               
+   ///   @param start - offset of the first byte                              
+   ///   @param count - number of bytes, that must be available               
+   ///   @param loader - loader for streaming                                 
+   ///   @return a pointer to the bytes, valid until the next read            
+   template<class TYPE> LANGULUS(INLINED)
+   const Byte* Block<TYPE>::ReadInner(Offset start, Count count, Loader loader) const {
+      if (loader)
+         return loader(const_cast<Block&>(*this), start, count);
+
+      LANGULUS_ASSERT(start <= mCount and mCount - start >= count, Access,
+         "Reader lacks loader");
+      return mRaw + start;
+   }
+
+   /// Copy a number of serialized bytes, in pieces, so that a loader never   
+   /// has to provide more than StreamPiece bytes at once                     
+   ///   @param result - [out] where to copy the bytes                        
+   ///   @param count - number of bytes to copy                               
+   ///   @param read - offset to apply to serialized byte array               
+   ///   @param loader - loader for streaming                                 
+   ///   @return the number of read bytes from byte container                 
+   template<class TYPE>
+   Offset Block<TYPE>::DeserializeRaw(
+      void* result, Count count, Offset read, Loader loader
+   ) const {
+      auto to = static_cast<Byte*>(result);
+      while (count) {
+         const auto piece = loader ? ::std::min(count, StreamPiece) : count;
+         ::std::memcpy(to, ReadInner(read, piece, loader), piece);
+         to += piece;
+         read += piece;
+         count -= piece;
       }
+      return read;
+   }
+
+   /// Make a block reference serialized elements in place, instead of        
+   /// copying them. If this container owns its memory, the memory is         
+   /// referenced, and a mutation branches the block out. Otherwise, the      
+   /// memory is out of jurisdiction and must outlive the block - if it is    
+   /// a MappedFile, a mutation takes authority over the elements first       
+   ///   @param to - [out] the block to make a view, must have no memory      
+   ///   @param count - the number of elements                                
+   ///   @param read - offset of the first element                            
+   template<class TYPE>
+   void Block<TYPE>::DeserializeView(CT::Block auto& to, Count count, Offset read) const {
+      LANGULUS_ASSUME(DevAssumes, not to.mEntry and not to.mRaw,
+         "Block already has memory");
+      // Typed blocks get their type member when allocating, which a    
+      // view skips, so populate it here for type-erased access         
+      (void) to.GetType();
+      to.mRaw = mRaw + read;
+      to.mCount = to.mReserved = count;
+      to.mEntry = mEntry;
+      to.mState += DataState::Constant;
+      if (mEntry)
+         const_cast<Allocation*>(mEntry)->Keep();
    }
 
    /// Read an atom-sized unsigned integer, based on the provided header      
    ///   @param result - [out] the resulting deserialized number              
    ///   @param read - offset to apply to serialized byte array               
-   ///   @param header - environment header                                   
+   ///   @param env - the stream environment                                  
    ///   @param loader - loader for streaming                                 
    ///   @return the number of read bytes from byte container                 
    template<class TYPE>
    Offset Block<TYPE>::DeserializeAtom(
-      Offset& result, Offset read, const Header& header, Loader loader
+      Offset& result, Offset read, const Environment& env, Loader loader
    ) const {
+      const auto& header = env.mHeader;
       if (header.mAtomSize == 4) {
          // We're deserializing data, that was serialized on a 32-bit   
          // architecture                                                
          uint32_t count4 = 0;
-         ReadInner(read, 4, loader);
-         ::std::memcpy(&count4, At(read), 4);
+         ::std::memcpy(&count4, ReadInner(read, 4, loader), 4);
          read += 4;
          result = static_cast<Offset>(count4);
       }
@@ -686,8 +859,7 @@ namespace Langulus::Anyness
          // We're deserializing data, that was serialized on a 64-bit   
          // architecture                                                
          uint64_t count8 = 0;
-         ReadInner(read, 8, loader);
-         ::std::memcpy(&count8, At(read), 8);
+         ::std::memcpy(&count8, ReadInner(read, 8, loader), 8);
          read += 8;
          LANGULUS_ASSERT(
             count8 <= std::numeric_limits<Offset>::max(),
@@ -705,66 +877,101 @@ namespace Langulus::Anyness
       return read;
    }
 
+   /// Read an unsigned integer, written by SerializeVarint                   
+   ///   @param result - [out] the resulting deserialized number              
+   ///   @param read - offset to apply to serialized byte array               
+   ///   @param loader - loader for streaming                                 
+   ///   @return the number of read bytes from byte container                 
+   template<class TYPE>
+   Offset Block<TYPE>::DeserializeVarint(Offset& result, Offset read, Loader loader) const {
+      result = 0;
+      for (Offset shift = 0; ; shift += 7) {
+         LANGULUS_ASSERT(shift < sizeof(Offset) * 8, Convert,
+            "Deserialized varint is too powerful for your architecture "
+            "- is the source corrupted?");
+
+         const auto byte = *ReadInner(read++, 1, loader);
+         result |= static_cast<Offset>(byte & 0x7F) << shift;
+         if (not (byte & 0x80))
+            return read;
+      }
+   }
+
    /// A snippet for conveniently deserializing a meta from binary            
+   /// Metas are written once per stream, and referred to by index after      
    ///   @param result - [out] the deserialized meta goes here                
    ///   @param read - byte offset inside 'from'                              
-   ///   @param header - environment header                                   
+   ///   @param env - the stream environment, where the dictionary is         
    ///   @param loader - loader for streaming                                 
    ///   @return number of read bytes                                         
    template<class TYPE>
    Offset Block<TYPE>::DeserializeMeta(
-      CT::Meta auto& result, Offset read, const Header& header, Loader loader
+      CT::Meta auto& result, Offset read, Environment& env, Loader loader
    ) const {
-      Count count = 0;
-      read = DeserializeAtom(count, read, header, loader);
-      if (count) {
-         ReadInner(read, count, loader);
-         const Token token {GetRaw<Letter>() + read, count};
-
-      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
-         using META = Deref<decltype(result)>;
-
-         if constexpr (CT::Same<META, DMeta>)
-            result = RTTI::GetMetaData(token);
-         else if constexpr (CT::Same<META, VMeta>)
-            result = RTTI::GetMetaVerb(token);
-         else if constexpr (CT::Same<META, TMeta>)
-            result = RTTI::GetMetaTrait(token);
-         else if constexpr (CT::Same<META, CMeta>)
-            result = RTTI::GetMetaConstant(token);
-         else
-            static_assert(false, "Unsupported meta deserialization");
-
-         LANGULUS_ASSERT(result, Meta,
-            "Deserialized meta for token `", token, "` doesn't exist");
-         return read + count;
-      #else
-         LANGULUS_OOPS(Meta,
-            "The build doesn't include managed reflection, "
-            "so it can't deserialize meta from token: ", token,
-            " unless it's a built-in type"
-         );
+      using META = Deref<decltype(result)>;
+      Offset index = 0;
+      read = DeserializeVarint(index, read, loader);
+      if (not index) {
+         result = {};
+         return read;
+      }
+
+      auto& definitions = env.template DefinitionsOf<META>();
+      if (--index < definitions.size()) {
+         // Already defined, just look it up                            
+         result = static_cast<META>(definitions[index]);
          return read;
-      #endif
       }
 
-      result = {};
+      LANGULUS_ASSERT(index == definitions.size(), Convert,
+         "Deserialized meta index ", index, " is out of order "
+         "- is the source corrupted?");
+
+      // Defined for the first time, so the token follows               
+      Count count = 0;
+      read = DeserializeVarint(count, read, loader);
+      const Token token {reinterpret_cast<const Letter*>(
+         ReadInner(read, count, loader)), count};
+
+   #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+      if constexpr (CT::Same<META, DMeta>)
+         result = RTTI::GetMetaData(token);
+      else if constexpr (CT::Same<META, VMeta>)
+         result = RTTI::GetMetaVerb(token);
+      else if constexpr (CT::Same<META, TMeta>)
+         result = RTTI::GetMetaTrait(token);
+      else if constexpr (CT::Same<META, CMeta>)
+         result = RTTI::GetMetaConstant(token);
+      else
+         static_assert(false, "Unsupported meta deserialization");
+
+      LANGULUS_ASSERT(result, Meta,
+         "Deserialized meta for token `", token, "` doesn't exist");
+      definitions.push_back(result);
+      return read + count;
+   #else
+      LANGULUS_OOPS(Meta,
+         "The build doesn't include managed reflection, "
+         "so it can't deserialize meta from token: ", token,
+         " unless it's a built-in type"
+      );
       return read;
+   #endif
    }
 
    /// Inner deserialization routine from binary                              
    ///   @tparam NEXT - the type we're deserializing - void for type-erasure  
    ///      if both NEXT and 'to' are type-erased, type will be deserialized  
    ///   @param to - [out] the resulting deserialized data                    
-   ///   @param header - environment header                                   
+   ///   @param env - the stream environment                                  
    ///   @param readOffset - offset to apply to serialized byte array         
    ///   @param loader - loader for streaming                                 
    ///   @return the number of read/peek bytes from byte container            
    template<class TYPE> template<class NEXT>
    Offset Block<TYPE>::DeserializeBinary(
-      CT::Block auto& to, const Header& header1, Offset readOffset, Loader loader1
+      CT::Block auto& to, Environment& env1, Offset readOffset, Loader loader1
    ) const {
-      auto& header = header1; //Workaround: needed due to really weird clang error  
+      auto& env = env1; //Workaround: needed due to really weird clang error  
       auto& loader = loader1; //Workaround: needed due to really weird clang error  
       using OUT = Deref<decltype(to)>;
       using T   = Conditional<OUT::TypeErased, NEXT, TypeOf<OUT>>;
@@ -783,18 +990,16 @@ namespace Langulus::Anyness
          // We have unpredictable data, so the deserializer expects     
          // that next bytes contain instructions of what kind of data   
          // to deserialize                                              
-         read = DeserializeAtom(deserializedCount, read, header, loader);
+         read = DeserializeAtom(deserializedCount, read, env, loader);
 
          // First read the serialized data state                        
          DataState state {};
-         ReadInner(read, sizeof(DataState), loader);
-         memcpy(static_cast<void*>(&state), At(read), sizeof(DataState));
-         read += sizeof(DataState);
+         read = DeserializeRaw(&state, sizeof(DataState), read, loader);
          to.AddState(state);
 
          // Finally, read type                                          
          DMeta type;
-         read = DeserializeMeta(type, read, header, loader);
+         read = DeserializeMeta(type, read, env, loader);
          if (not type)
             return read;
 
@@ -829,7 +1034,7 @@ namespace Langulus::Anyness
             to.New(deserializedCount);
 
          to.ForEach([&](Block<>& block) {
-            read = DeserializeBinary<void>(block, header, read, loader);
+            read = DeserializeBinary<void>(block, env, read, loader);
          });
 
          return read;
@@ -841,17 +1046,17 @@ namespace Langulus::Anyness
             to.New(deserializedCount);
 
          to.ForEach(
-            [&](DMeta& meta) noexcept {
-               read = DeserializeMeta(meta, read, header, loader);
+            [&](DMeta& meta) {
+               read = DeserializeMeta(meta, read, env, loader);
             },
-            [&](VMeta& meta) noexcept {
-               read = DeserializeMeta(meta, read, header, loader);
+            [&](VMeta& meta) {
+               read = DeserializeMeta(meta, read, env, loader);
             },
-            [&](CMeta& meta) noexcept {
-               read = DeserializeMeta(meta, read, header, loader);
+            [&](CMeta& meta) {
+               read = DeserializeMeta(meta, read, env, loader);
             },
-            [&](TMeta& meta) noexcept {
-               read = DeserializeMeta(meta, read, header, loader);
+            [&](TMeta& meta) {
+               read = DeserializeMeta(meta, read, env, loader);
             }
          );
 
@@ -859,34 +1064,58 @@ namespace Langulus::Anyness
       }
       else if (to.IsPOD()) {
          // If data is POD, optimize by directly memcpying it           
-         if constexpr (CT::TypeErased<T>)
-            to.template AllocateMore<false, true>(deserializedCount);
+         if (to.IsDense()) {
+            // Skip the padding, that aligns the data                   
+            const auto alignment = to.GetType()->mAlignment;
+            const auto padding = env.PaddingAt(read, alignment);
+            if (padding) {
+               (void) ReadInner(read, padding, loader);
+               read += padding;
+            }
 
-         const auto byteSize = to.GetBytesize();
-         ReadInner(read, byteSize, loader);
-
-         if (to.IsSparse()) {
-            // Allocate a separate block for the elements               
-            const auto temporary = Allocator::Allocate(nullptr, byteSize);
-            auto start = temporary->GetBlockStart();
-            ::std::memcpy(start, At(read), byteSize);
-            read += byteSize;
-            temporary->Keep(deserializedCount - 1);
-
-            // Write a pointer to each element                          
-            auto p = to.template GetHandle<Byte*>(0);
-            const auto pEnd = p + to.GetCount();
-            const auto size = to.GetType()->mSize;
-            while (p != pEnd) {
-               p.Assign(start, temporary);
-               start += size;
+            if constexpr (CT::TypeErased<T>) {
+               const auto byteSize = deserializedCount * to.GetStride();
+               if (env.mView and not loader and not to.mEntry and not to.mRaw
+               and (alignment <= 1 or 0 == reinterpret_cast<::std::uintptr_t>(mRaw + read) % alignment)) {
+                  // Reference the data in place, instead of copying it 
+                  (void) ReadInner(read, byteSize, loader);
+                  DeserializeView(to, deserializedCount, read);
+                  return read + byteSize;
+               }
+
+               to.template AllocateMore<false, true>(deserializedCount);
             }
+
+            // Copy it all at once                                      
+            return DeserializeRaw(to.GetRaw(), to.GetBytesize(), read, loader);
          }
-         else {
-            // Data is dense, parse it all at once                      
-            ::std::memcpy(to.GetRaw(), At(read), byteSize);
-            read += byteSize;
+
+         // Data is sparse - pointees are serialized back to back, so   
+         // copy them all into a single separate allocation             
+         if constexpr (CT::TypeErased<T>)
+            to.template AllocateMore<false, true>(deserializedCount);
+
+         const auto size = to.GetType()->mDeptr->mSize;
+         const auto byteSize = size * to.GetCount();
+         if (not byteSize)
+            return read;
+
+         const auto temporary = Allocator::Allocate(nullptr, byteSize);
+         LANGULUS_ASSERT(temporary, Allocate,
+            "Out of memory while deserializing sparse POD");
+         auto start = temporary->GetBlockStart();
+         read = DeserializeRaw(start, byteSize, read, loader);
+         temporary->Keep(to.GetCount() - 1);
+
+         // Scatter pointers and entries directly - each element is     
+         // just a pointer into the new allocation                      
+         const auto pointers = to.mRawSparse;
+         const auto entries = to.GetEntries();
+         for (Offset i = 0; i < to.GetCount(); ++i) {
+            pointers[i] = start;
+            start += size;
          }
+         ::std::fill_n(entries, to.GetCount(), temporary);
 
          return read;
       }
@@ -899,11 +1128,35 @@ namespace Langulus::Anyness
 
             for (Count i = 0; i < deserializedCount; ++i) {
                Count count = 0;
-               read = DeserializeAtom(count, read, header, loader);
-               to.template InsertInner<void, false>(
-                  IndexBack, Text::From(Disown(
-                     reinterpret_cast<const Letter*>(mRaw + read)), count)
-               );
+               read = DeserializeAtom(count, read, env, loader);
+               Text text;
+               if (count and env.mView and not loader) {
+                  // Reference the letters in place                     
+                  (void) ReadInner(read, count * sizeof(Letter), loader);
+                  DeserializeView(text, count, read);
+                  read += count * sizeof(Letter);
+               }
+               else if (count) {
+                  auto letters = text.Extend(count);
+                  read = DeserializeRaw(letters.GetRaw(), count * sizeof(Letter), read, loader);
+               }
+               to.template InsertInner<void, false>(IndexBack, ::std::move(text));
+            }
+
+            return read;
+         }
+         else if (to.template CastsTo<Symbol>()) {
+            // Deserialize symbols - they're serialized as texts, so    
+            // just intern them again                                   
+            if constexpr (CT::TypeErased<T>)
+               to.AllocateMore(deserializedCount);
+
+            for (Count i = 0; i < deserializedCount; ++i) {
+               Count count = 0;
+               read = DeserializeAtom(count, read, env, loader);
+               const auto letters = ReadInner(read, count * sizeof(Letter), loader);
+               to.template InsertInner<void, false>(IndexBack, Symbol {Token {
+                  reinterpret_cast<const Letter*>(letters), count}});
                read += count * sizeof(Letter);
             }
 
@@ -916,11 +1169,19 @@ namespace Langulus::Anyness
 
             for (Count i = 0; i < deserializedCount; ++i) {
                Count count = 0;
-               read = DeserializeAtom(count, read, header, loader);
-               to.template InsertInner<void, false>(
-                  IndexBack, Bytes::From(Disown(mRaw + read), count)
-               );
-               read += count;
+               read = DeserializeAtom(count, read, env, loader);
+               Bytes bytes;
+               if (count and env.mView and not loader) {
+                  // Reference the bytes in place                       
+                  (void) ReadInner(read, count, loader);
+                  DeserializeView(bytes, count, read);
+                  read += count;
+               }
+               else if (count) {
+                  auto region = bytes.Extend(count);
+                  read = DeserializeRaw(region.GetRaw(), count, read, loader);
+               }
+               to.template InsertInner<void, false>(IndexBack, ::std::move(bytes));
             }
 
             return read;
@@ -934,18 +1195,18 @@ namespace Langulus::Anyness
                // Each trait can be different                           
                to.ForEach([&](Trait& trait) {
                   TMeta ttype;
-                  read = DeserializeMeta(ttype, read, header, loader);
+                  read = DeserializeMeta(ttype, read, env, loader);
                   trait.SetTrait(ttype);
 
                   auto& block = static_cast<Block<>&>(trait);
-                  read = DeserializeBinary<void>(block, header, read, loader);
+                  read = DeserializeBinary<void>(block, env, read, loader);
                });
             }
             else {
                // All traits are the same                               
                to.ForEach([&](Trait& trait) {
                   auto& block = static_cast<Block<>&>(trait);
-                  read = DeserializeBinary<void>(block, header, read, loader);
+                  read = DeserializeBinary<void>(block, env, read, loader);
                });
             }
 
@@ -966,7 +1227,7 @@ namespace Langulus::Anyness
                // the case that instances are resolvable                
                auto resolvedType = to.GetType();
                if (to.IsResolvable())
-                  read = DeserializeMeta(resolvedType, read, header, loader);
+                  read = DeserializeMeta(resolvedType, read, env, loader);
                element = Many::FromMeta(resolvedType);
                element.New(1);
             }
@@ -984,14 +1245,14 @@ namespace Langulus::Anyness
 
                auto baseBlock = element.GetBaseMemory(base);
                read = DeserializeBinary<RTTI::Base>(
-                  baseBlock, header, read, loader);
+                  baseBlock, env, read, loader);
             }
 
             // Deserialize all reflected members                        
             for (auto& member : element.GetType()->mMembers) {
                auto memberBlock = element.GetMember(member, 0);
                read = DeserializeBinary<RTTI::Member>(
-                  memberBlock, header, read, loader);
+                  memberBlock, env, read, loader);
             }
 
             if constexpr (CT::TypeErased<T>) {
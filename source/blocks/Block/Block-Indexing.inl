@@ -8,6 +8,7 @@
 #pragma once
 #include "../Block.hpp"
 #include "../../Index.inl"
+#include <algorithm>
 
 
 namespace Langulus::Anyness
@@ -565,7 +566,7 @@ namespace Langulus::Anyness
    }
    
    /// Swap contents of this block, with the contents of another, using       
-   /// a temporary block                                                      
+   /// a temporary block, that is kept on the stack if the elements fit       
    ///   @param rhs - the block to swap with                                  
    template<class TYPE> template<class T1> requires CT::Block<Deint<T1>>
    void Block<TYPE>::Swap(T1&& rhs) {
@@ -581,9 +582,20 @@ namespace Langulus::Anyness
       or (DeintCast(rhs).template IsSimilar<void*>() and IsSparse())
       ), "Type mismatch on swap", ": ", DeintCast(rhs).GetType(), " != ", GetType());
 
+      if constexpr (S::Move) {
+         if (IsDense() and IsRelocatable()) {
+            // Trivially relocatable elements are just swapped bytewise 
+            ::std::swap_ranges(mRaw, mRaw + GetBytesize(),
+               DeintCast(rhs).mRaw);
+            return;
+         }
+      }
+
       using B = Block<TypeOf<ST>>;
       B temporary {mState, mType};
-      temporary.AllocateFresh(temporary.RequestSize(mCount));
+      LocalAllocation<LANGULUS_LOCAL_HANDLE_SIZE> local;
+      if (not temporary.AllocateLocal(local, mCount))
+         temporary.AllocateFresh(temporary.RequestSize(mCount));
       temporary.mCount = mCount;
 
       // Move this to temporary                                         
@@ -594,7 +606,25 @@ namespace Langulus::Anyness
       reinterpret_cast<B*>(&DeintCast(rhs))->AssignWithIntent(Abandon(temporary));
       // Cleanup temporary                                              
       temporary.FreeInner();
-      Allocator::Deallocate(const_cast<Allocation*>(temporary.mEntry));
+      if (temporary.mEntry != local.GetEntry())
+         Allocator::Deallocate(const_cast<Allocation*>(temporary.mEntry));
+   }
+
+   /// Move all elements of another block in this one, and destroy them at    
+   /// the source. Trivially relocatable elements are copied bytewise,        
+   /// without invoking any constructors or destructors                       
+   ///   @attention never modifies any block state                            
+   ///   @attention assumes none of the elements here are constructed         
+   ///   @attention assumes blocks are similar, and source is not empty       
+   ///   @param source - the block to relocate elements from                  
+   template<class TYPE> LANGULUS(INLINED)
+   void Block<TYPE>::RelocateFrom(CT::Block auto& source) {
+      if (IsDense() and IsRelocatable())
+         CopyMemory(mRaw, source.mRaw, source.GetBytesize());
+      else {
+         CreateWithIntent(Abandon(source));
+         source.FreeInner();
+      }
    }
 
    /// Gather items from source container, and fill this one                  
@@ -1661,38 +1661,39 @@ namespace Langulus::Anyness
          // assignment signature, knowing what the contained type is    
          // at compile time                                             
          if constexpr (CT::AssignableFrom<TYPE, decltype(what)>) {
-            auto lhs = GetRaw();
-            const auto lhsEnd = lhs + mCount;
-            while (lhs != lhsEnd)
-               *(lhs++) = S::Nest(what);
-
             if constexpr (Sparse) {
-               // We just copied a pointer multiple times, make sure    
-               // we dereference the old entries, and reference the new 
-               // memory multiple times, if we own it                   
-               auto ent = GetEntries();
-               const auto entEnd = ent + mCount;
-               auto allocation = Allocator::Find(MetaDataOf<Deptr<TYPE>>(), *(--lhs));
-
-               if (allocation) {
-                  while (ent != entEnd) {
-                     if (*ent)
-                        const_cast<Allocation*>(*ent)->Free();
-                     *(ent++) = allocation;
-                  }
+               // We're copying a pointer multiple times, make sure we  
+               // reference the new memory multiple times, if we own    
+               // it, before dereferencing the old entries, in case the 
+               // new pointer is among the old ones                     
+               TYPE pointer {};
+               pointer = S::Nest(what);
+               const auto allocation = Allocator::Find(MetaDataOf<Deptr<TYPE>>(), pointer);
+               if (allocation)
                   const_cast<Allocation*>(allocation)->Keep(mCount);
-               }
-               else {
-                  // New pointer is out of jurisdiction, just reset     
-                  // the current entries                                
-                  while (ent != entEnd) {
-                     if (*ent) {
-                        const_cast<Allocation*>(*ent)->Free();
-                        *ent = nullptr;
-                     }
+
+               auto lhs = GetRaw();
+               auto ent = GetEntries();
+               const auto lhsEnd = lhs + mCount;
+               while (lhs != lhsEnd) {
+                  if constexpr (CT::Referencable<Deptr<TYPE>>) {
+                     if (allocation)
+                        DecvqCast(pointer)->Reference(1);
                   }
+
+                  if (*ent)
+                     Handle<TYPE>::FreeSparse(*lhs, *ent);
+
+                  *(lhs++) = pointer;
+                  *(ent++) = allocation;
                }
             }
+            else {
+               auto lhs = GetRaw();
+               const auto lhsEnd = lhs + mCount;
+               while (lhs != lhsEnd)
+                  *(lhs++) = S::Nest(what);
+            }
          }
          else static_assert(false, "Can't fill using that value "
             "- contained type is not assignable by it");
@@ -84,6 +84,34 @@ namespace Langulus::Anyness
                "BranchOut should've been called prior to AllocateMore"
             );
 
+            #if not LANGULUS_FEATURE(MANAGED_MEMORY)
+               if constexpr (CT::Dense<TYPE> and CT::Relocatable<TYPE>) {
+                  // Trivially relocatable elements are carried over by 
+                  // the system allocator - in place, if the chunk can  
+                  // be extended, so no element is moved one by one     
+                  // Views that start inside the allocation (selections,
+                  // crops, deserialized views) still take the move path
+                  if (mRaw == mEntry->GetBlockStart()) {
+                     const auto entry = Allocator::Relocate(
+                        request.mByteSize, const_cast<Allocation*>(mEntry));
+                     LANGULUS_ASSERT(entry, Allocate, "Out of memory");
+                     mEntry = entry;
+                     mRaw = const_cast<Byte*>(mEntry->GetBlockStart());
+                     mReserved = request.mElementCount;
+
+                     if constexpr (CREATE) {
+                        // Default-construct the rest                   
+                        const auto count = elements - mCount;
+                        CropInner(mCount, count).CreateDefault();
+                     }
+
+                     if constexpr (CREATE or SETSIZE)
+                        mCount = elements;
+                     return;
+                  }
+               }
+            #endif
+
             Block previousBlock {*this};
             mEntry = Allocator::Reallocate(
                request.mByteSize * (Sparse ? 2 : 1),
@@ -112,7 +140,16 @@ namespace Langulus::Anyness
                      // Sparse containers have additional memory        
                      // allocated for each pointer's entry, if managed  
                      // memory is enabled.                              
-                     if constexpr (CT::AbandonMakable<TYPE>
+                     if constexpr (CT::Dense<TYPE> and CT::Relocatable<TYPE>) {
+                        // Trivially relocatable elements are copied    
+                        // bytewise, and their old place is discarded   
+                        mRaw = const_cast<Byte*>(mEntry->GetBlockStart());
+                        CopyMemory(mRaw, previousBlock.mRaw,
+                           previousBlock.GetBytesize());
+                        Allocator::Deallocate(
+                           const_cast<Allocation*>(previousBlock.mEntry));
+                     }
+                     else if constexpr (CT::AbandonMakable<TYPE>
                      or CT::MoveMakable<TYPE>
                      or CT::ReferMakable<TYPE>
                      or CT::CopyMakable<TYPE>) {
@@ -307,6 +344,30 @@ namespace Langulus::Anyness
             "BranchOut should've been called prior to AllocateMore"
          );
 
+         #if not LANGULUS_FEATURE(MANAGED_MEMORY)
+            if (not mType->mIsSparse and IsRelocatable()
+            and mRaw == mEntry->GetBlockStart()) {
+               // Trivially relocatable elements are carried over by    
+               // the system allocator - in place, if the chunk can be  
+               // extended, so no element is moved one by one. Views    
+               // that start inside the allocation take the move path   
+               const auto entry = Allocator::Relocate(
+                  request.mByteSize, const_cast<Allocation*>(mEntry));
+               LANGULUS_ASSERT(entry, Allocate, "Out of memory");
+               mEntry = entry;
+               mRaw = const_cast<Byte*>(mEntry->GetBlockStart());
+               mReserved = request.mElementCount;
+
+               if constexpr (CREATE) {
+                  // Default-construct the rest                         
+                  const auto count = elements - mCount;
+                  CropInner(mCount, count).CreateDefault();
+                  mCount = elements;
+               }
+               return;
+            }
+         #endif
+
          Block previousBlock {*this};
          mEntry = Allocator::Reallocate(
             request.mByteSize * (mType->mIsSparse ? 2 : 1),
@@ -329,7 +390,15 @@ namespace Langulus::Anyness
                // Sparse containers have additional memory allocated for
                // each pointer's entry, if managed memory is enabled    
                mRaw = const_cast<Byte*>(mEntry->GetBlockStart());
-               CreateWithIntent(Abandon(previousBlock));
+               if (not mType->mIsSparse and IsRelocatable()) {
+                  // Trivially relocatable elements are copied bytewise,
+                  // and their old place is discarded                   
+                  CopyMemory(mRaw, previousBlock.mRaw,
+                     previousBlock.GetBytesize());
+                  Allocator::Deallocate(
+                     const_cast<Allocation*>(previousBlock.mEntry));
+               }
+               else CreateWithIntent(Abandon(previousBlock));
             /*}
             else {
                // Memory is used from multiple locations, and we must   
@@ -376,6 +445,29 @@ namespace Langulus::Anyness
       mReserved = request.mElementCount;
    }
 
+   /// Place a number of elements in a local allocation on the stack,         
+   /// instead of allocating them from the heap. Unlike AllocateFresh, this   
+   /// reserves exactly as many elements as requested                         
+   ///   @attention the block must not outlive the local allocation, and it   
+   ///      must never be deallocated - only its elements are destroyed       
+   ///   @param local - the local allocation to use                           
+   ///   @param count - the number of elements to reserve                     
+   ///   @return true if the elements fit in the local allocation             
+   template<class TYPE> template<Offset SIZE> LANGULUS(INLINED)
+   bool Block<TYPE>::AllocateLocal(
+      LocalAllocation<SIZE>& local, const Count count
+   ) noexcept {
+      // Sparse containers need room for each pointer's entry, too      
+      const Offset bytes = count * GetStride().mSize * (IsSparse() ? 2 : 1);
+      if (bytes > SIZE or GetType()->mAlignment > Alignment)
+         return false;
+
+      mEntry = local.GetEntry();
+      mRaw = const_cast<Byte*>(mEntry->GetBlockStart());
+      mReserved = count;
+      return true;
+   }
+
    /// Reference memory block once                                            
    ///   @param DEEP - reference inner pointers/referenced instances, too?    
    template<class TYPE> template<bool DEEP> LANGULUS(INLINED)
@@ -528,15 +620,42 @@ namespace Langulus::Anyness
 
          Allocator::Deallocate(const_cast<Allocation*>(mEntry));
       }
-      else {
-         // Dereference memory                                          
-         if (mCount)
-            FreeInner<false>();
+      else FreeShared();
+
+      mEntry = nullptr;
+   }
 
-         const_cast<Allocation*>(mEntry)->Free();
+   /// Dereference memory, that is used from multiple locations               
+   /// Elements are dereferenced first, while this block still keeps the      
+   /// memory alive. Other owners might release it on other threads in the    
+   /// meantime, in which case this block turns out to be the last owner -    
+   /// it then destroys what dereferencing didn't, and deallocates memory     
+   ///   @attention this never modifies any state                             
+   ///   @param mask - internally used for destroying tables (tag dispatch)   
+   template<class TYPE> template<class MASK>
+   void Block<TYPE>::FreeShared(MASK mask) {
+      LANGULUS_ASSUME(DevAssumes, mEntry, "Freeing unallocated memory");
+      if (mCount)
+         FreeInner<false>(mask);
+
+      const auto entry = const_cast<Allocation*>(mEntry);
+      if (entry->Free())
+         return;
+
+      // Referencable elements were fully dereferenced above, and       
+      // destroyed if no longer used - destroy the rest                 
+      entry->Keep();
+      if (mCount) {
+         if constexpr (not TypeErased) {
+            if constexpr (Sparse ? not CT::Referencable<Deptr<TYPE>>
+                                 : not CT::Referencable<Decay<TYPE>>)
+               FreeInner(mask);
+         }
+         else if (not mType->mReference)
+            FreeInner(mask);
       }
 
-      mEntry = nullptr;
+      Allocator::Deallocate(entry);
    }
    
    /// Call destructors of all initialized items                              
@@ -755,18 +874,19 @@ namespace Langulus::Anyness
          }
 
          if (1 != mEntry->GetUses()) {
+            // Dereference only what was referenced by this block, but  
+            // destroy elements, if other occurences were released      
             if constexpr (not TypeErased) {
                if constexpr (CT::Referencable<Deptr<TYPE>>) {
                   // Statically typed and sparse                        
-                  const_cast<Allocation*>(handle.GetEntry())->Free();
-                  DecvqCast(static_cast<TYPE>(handle.Get()))->Reference(-1);
+                  Handle<TYPE>::FreeSparse(
+                     static_cast<TYPE>(handle.Get()), handle.GetEntry());
                }
             }
             else if (mType->mReference) {
                // Type-erased and sparse                                
-               const auto reference = mType->mReference;
-               const_cast<Allocation*>(handle.GetEntry())->Free();
-               reference(handle.Get(), -1);
+               Handle<void*>::FreeSparse(
+                  handle.Get(), handle.GetEntry(), mType);
             }
          }
          else {
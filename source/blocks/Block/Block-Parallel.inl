@@ -0,0 +1,328 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Block.hpp"
+#include "../../parallel/Executor.hpp"
+#include <atomic>
+#include <optional>
+#include <vector>
+
+
+namespace Langulus::Anyness
+{
+
+   /// Execute a function for each element, splitting the container into      
+   /// chunks that are processed simultaneously by the installed executor     
+   /// Small containers are iterated serially, exactly like ForEach does      
+   ///   @attention the function is executed from multiple threads at once    
+   ///   @attention order of execution is not guaranteed                      
+   ///   @tparam MUTABLE - whether elements will be changed                   
+   ///   @param call - the function to execute, its argument type is tested   
+   ///      against the contained type, as in ForEach; it can't control the   
+   ///      loop, so it must return void                                      
+   ///   @return the number of executions                                     
+   template<class TYPE> template<bool MUTABLE>
+   Count Block<TYPE>::ParallelForEach(auto&& call) const {
+      using F = Deref<decltype(call)>;
+      static_assert(CT::Void<ReturnOf<F>>,
+         "Parallel iterators can't control the loop, so they must return void");
+
+      if (IsEmpty())
+         return 0;
+
+      const auto chunks = Parallel::GetChunkCount(mCount);
+      if (chunks < 2)
+         return ForEach<false, MUTABLE>(call);
+
+      ::std::atomic<Count> result = 0;
+      Parallel::Execute(chunks, [&](Offset chunk) {
+         const auto start = Parallel::GetChunkStart(mCount, chunks, chunk);
+         const auto end = Parallel::GetChunkStart(mCount, chunks, chunk + 1);
+         const auto done = CropInner(start, end - start)
+            .template ForEach<false, MUTABLE>(call);
+         result.fetch_add(done, ::std::memory_order_relaxed);
+      });
+
+      return result.load();
+   }
+
+   template<class TYPE> LANGULUS(INLINED)
+   Count Block<TYPE>::ParallelForEach(auto&& call) {
+      return const_cast<const Block*>(this)->template
+         ParallelForEach<true>(Forward<decltype(call)>(call));
+   }
+
+   /// Sort the contents of this container, using multiple threads            
+   /// Chunks are sorted independently via the Sort() engines, and are then   
+   /// merged pairwise, doubling their size each round                        
+   ///   @attention sorting is not stable                                     
+   ///   @tparam ASCEND - whether to sort in ascending order (123)            
+   template<class TYPE> template<bool ASCEND>
+   void Block<TYPE>::ParallelSort() requires (TypeErased or CT::Sortable<TYPE, TYPE>) {
+      if (mCount < 2)
+         return;
+
+      if constexpr (TypeErased) {
+         LANGULUS_ASSERT(IsTyped(), Compare, "Sorting an untyped container");
+
+         // Attempt interpreting the contents as a fundamental type     
+         const auto sortAs = [this]<class T>() {
+            if constexpr (CT::Sortable<T, T>) {
+               if (mType->template IsSimilar<T>()) {
+                  reinterpret_cast<Block<T>*>(this)
+                     ->template ParallelSort<ASCEND>();
+                  return true;
+               }
+            }
+            return false;
+         };
+
+         const bool sorted = not mType->mIsSparse
+         and [&]<class...T>(Types<T...>) {
+            return (sortAs.template operator()<T>() or ...);
+         }(Types<
+            ::std::int8_t,  ::std::uint8_t,
+            ::std::int16_t, ::std::uint16_t,
+            ::std::int32_t, ::std::uint32_t,
+            ::std::int64_t, ::std::uint64_t,
+            char, wchar_t, char8_t, char16_t, char32_t,
+            float, double, Hash
+         > {});
+
+         // Serial sort will either do the job, or throw                
+         if (not sorted)
+            Sort<ASCEND>();
+      }
+      else if constexpr (Sparse or not ::std::movable<Decvq<TYPE>>) {
+         // Sparse containers sort a permutation - do it serially       
+         Sort<ASCEND>();
+      }
+      else {
+         const auto chunks = Parallel::GetChunkCount(mCount);
+         if (chunks < 2)
+            return Sort<ASCEND>();
+
+         BranchOut();
+
+         using T = Decvq<TYPE>;
+         const auto less = [](const T& lhs, const T& rhs) {
+            if constexpr (ASCEND)
+               return lhs < rhs;
+            else
+               return lhs > rhs;
+         };
+
+         const auto data = GetRaw();
+         const auto count = mCount;
+         const auto chunkStart = [count, chunks](Offset chunk) {
+            return Parallel::GetChunkStart(count, chunks, chunk);
+         };
+
+         // Radix sort needs a scratch buffer, which is allocated on    
+         // this thread, because allocator might not be thread-safe     
+         UNUSED() TMany<T> scratch;
+         if constexpr (CT::RadixSortable<T>)
+            scratch.Reserve(mCount);
+
+         Parallel::Execute(chunks, [&](Offset chunk) {
+            const auto start = chunkStart(chunk);
+            const auto end = chunkStart(chunk + 1);
+            if constexpr (CT::RadixSortable<T>) {
+               if (end - start >= Inner::SortRadixThreshold) {
+                  Inner::RadixSort<ASCEND>(data + start,
+                     const_cast<T*>(scratch.GetRaw()) + start, end - start);
+                  return;
+               }
+            }
+
+            Inner::PdqSort(data + start, data + end, less);
+         });
+
+         // Merge sorted runs pairwise                                  
+         for (Count width = 1; width < chunks; width *= 2) {
+            const auto pairs = (chunks + width * 2 - 1) / (width * 2);
+            Parallel::Execute(pairs, [&](Offset pair) {
+               const auto lo = pair * width * 2;
+               const auto mid = ::std::min(lo + width, chunks);
+               const auto hi = ::std::min(lo + width * 2, chunks);
+               if (mid == hi)
+                  return;
+
+               ::std::inplace_merge(
+                  data + chunkStart(lo),
+                  data + chunkStart(mid),
+                  data + chunkStart(hi),
+                  less
+               );
+            });
+         }
+      }
+   }
+
+   /// Find the first matching element, using multiple threads                
+   /// Chunks after an already found match are skipped                        
+   ///   @param item - the item to search for                                 
+   ///   @return the index of the first match, or IndexNone if not found      
+   template<class TYPE> template<CT::NoIntent T1>
+   Index Block<TYPE>::ParallelFind(const T1& item) const
+   requires (TypeErased or CT::Comparable<TYPE, T1>) {
+      if (IsEmpty())
+         return IndexNone;
+
+      // Use smaller chunks, so that more work can be skipped           
+      const auto chunks = Parallel::GetChunkCount(mCount, Parallel::MinimumGrain / 2);
+      if (chunks < 2)
+         return Find(item);
+
+      ::std::atomic<Offset> found = mCount;
+      Parallel::Execute(chunks, [&](Offset chunk) {
+         const auto start = Parallel::GetChunkStart(mCount, chunks, chunk);
+         if (start >= found.load(::std::memory_order_relaxed))
+            return;
+
+         const auto end = Parallel::GetChunkStart(mCount, chunks, chunk + 1);
+         const auto index = CropInner(start, end - start).Find(item);
+         if (index == IndexNone)
+            return;
+
+         // Keep only the smallest offset                               
+         const Offset offset = start + index.GetOffsetUnsafe();
+         auto previous = found.load(::std::memory_order_relaxed);
+         while (offset < previous and not found.compare_exchange_weak(
+            previous, offset, ::std::memory_order_relaxed));
+      });
+
+      const Offset result = found.load();
+      if (result == mCount)
+         return IndexNone;
+      return result;
+   }
+
+   /// Reduce all elements to a single value, using multiple threads          
+   /// Each chunk is seeded with its first element, and the results of the    
+   /// chunks are combined in order, starting from 'init'                     
+   ///   @attention op must be associative, because it is applied in an       
+   ///      unspecified grouping                                              
+   ///   @param init - the initial value                                      
+   ///   @param op - the binary operation, it is called both as               
+   ///      op(result, element) and op(result, result)                        
+   ///   @return the reduced value                                            
+   template<class TYPE>
+   auto Block<TYPE>::Reduce(auto&& init, auto&& op) const requires (not TypeErased) {
+      using R = Decvq<Deref<decltype(init)>>;
+      static_assert(::std::constructible_from<R, const TYPE&>,
+         "Result type must be constructible from the contained type");
+
+      R result = Forward<decltype(init)>(init);
+      if (IsEmpty())
+         return result;
+
+      const auto data = GetRaw();
+      const auto chunks = Parallel::GetChunkCount(mCount);
+      if (chunks < 2) {
+         for (Offset i = 0; i < mCount; ++i)
+            result = op(::std::move(result), data[i]);
+         return result;
+      }
+
+      ::std::vector<::std::optional<R>> partials (chunks);
+      Parallel::Execute(chunks, [&](Offset chunk) {
+         const auto start = Parallel::GetChunkStart(mCount, chunks, chunk);
+         const auto end = Parallel::GetChunkStart(mCount, chunks, chunk + 1);
+         R partial (data[start]);
+         for (Offset i = start + 1; i < end; ++i)
+            partial = op(::std::move(partial), data[i]);
+         partials[chunk].emplace(::std::move(partial));
+      });
+
+      for (auto& partial : partials)
+         result = op(::std::move(result), ::std::move(*partial));
+      return result;
+   }
+
+   /// Append the result of a function for each element to another block,     
+   /// using multiple threads                                                 
+   ///   @attention the function is executed from multiple threads at once    
+   ///   @param out - [in/out] the container to append results to; if it is   
+   ///      type-erased, it will be set to the function's return type         
+   ///   @param call - the function to execute for each element               
+   template<class TYPE>
+   void Block<TYPE>::TransformInto(CT::Block auto& out, auto&& call) const
+   requires (not TypeErased) {
+      using OUT = Deref<decltype(out)>;
+      using R = Decvq<Deref<decltype(call(Fake<const TYPE&>()))>>;
+      using E = Conditional<OUT::TypeErased, R, TypeOf<OUT>>;
+      static_assert(CT::Dense<E>,
+         "Can't transform into sparse elements");
+      static_assert(::std::constructible_from<E, decltype(call(Fake<const TYPE&>()))>,
+         "Destination element must be constructible from function result");
+
+      if (IsEmpty())
+         return;
+
+      if constexpr (OUT::TypeErased)
+         out.template SetType<E>();
+
+      auto& dest = reinterpret_cast<Block<E>&>(out);
+      dest.BranchOut();
+      const auto offset = dest.mCount;
+      dest.Reserve(offset + mCount);
+
+      const auto from = GetRaw();
+      const auto to = dest.GetRaw() + offset;
+      const auto chunks = Parallel::GetChunkCount(mCount);
+      if (chunks < 2) {
+         for (Offset i = 0; i < mCount; ++i) {
+            new (to + i) E (call(from[i]));
+            ++dest.mCount;
+         }
+         return;
+      }
+
+      // Track finished chunks, so that results can be destroyed if any 
+      // of the chunks throws                                           
+      ::std::vector<char> finished (chunks, 0);
+      try {
+         Parallel::Execute(chunks, [&](Offset chunk) {
+            const auto start = Parallel::GetChunkStart(mCount, chunks, chunk);
+            const auto end = Parallel::GetChunkStart(mCount, chunks, chunk + 1);
+            auto i = start;
+            try {
+               for (; i < end; ++i)
+                  new (to + i) E (call(from[i]));
+            }
+            catch (...) {
+               if constexpr (not CT::POD<E>) {
+                  while (i-- > start)
+                     to[i].~E();
+               }
+               throw;
+            }
+
+            finished[chunk] = 1;
+         });
+      }
+      catch (...) {
+         if constexpr (not CT::POD<E>) {
+            for (Offset chunk = 0; chunk < chunks; ++chunk) {
+               if (not finished[chunk])
+                  continue;
+
+               const auto start = Parallel::GetChunkStart(mCount, chunks, chunk);
+               const auto end = Parallel::GetChunkStart(mCount, chunks, chunk + 1);
+               for (auto i = start; i < end; ++i)
+                  to[i].~E();
+            }
+         }
+         throw;
+      }
+
+      dest.mCount += mCount;
+   }
+
+} // namespace Langulus::Anyness
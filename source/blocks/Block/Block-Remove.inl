@@ -257,7 +257,7 @@ namespace Langulus::Anyness
       else {
          // If reached, then data is referenced from multiple places    
          // Don't call destructors, just clear it up and dereference    
-         const_cast<Allocation*>(mEntry)->Free();
+         FreeShared();
          mRaw   = nullptr;
          mEntry = nullptr;
          mCount = mReserved = 0;
@@ -0,0 +1,689 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Block.hpp"
+#include <algorithm>
+#include <bit>
+
+
+namespace Langulus
+{
+   namespace CT
+   {
+
+      /// Types that can be sorted by their binary representation, via an LSD 
+      /// radix sort. These are all built-in numbers of 1, 2, 4 or 8 bytes,   
+      /// as well as hashes                                                   
+      template<class...T>
+      concept RadixSortable = ((Dense<T> and (
+            (BuiltinInteger<T> and not Bool<T>)
+         or  Character<T>
+         or (Real<T> and (sizeof(T) == 4 or sizeof(T) == 8))
+         or  Exact<T, Hash>
+      )) and ...);
+
+   } // namespace Langulus::CT
+
+} // namespace Langulus
+
+namespace Langulus::Anyness::Inner
+{
+
+   /// Sequences smaller than this are sorted via insertion sort              
+   constexpr Count SortInsertionThreshold = 24;
+   /// Sequences bigger than this use the ninther for picking a pivot         
+   constexpr Count SortNintherThreshold = 128;
+   /// Max number of moves, before partial insertion sort gives up            
+   constexpr Count SortPartialInsertionLimit = 8;
+   /// Radix sort has overhead of two histogram passes and a scratch buffer   
+   /// so it is used only for sequences bigger than this                      
+   constexpr Count SortRadixThreshold = 256;
+
+   /// Get the unsigned word used as a radix key for a type                   
+   template<class T>
+   using RadixWord = Conditional<sizeof(T) == 1, ::std::uint8_t,
+                     Conditional<sizeof(T) == 2, ::std::uint16_t,
+                     Conditional<sizeof(T) == 4, ::std::uint32_t,
+                                                 ::std::uint64_t>>>;
+
+   /// Map a value to an unsigned key, whose unsigned order matches the       
+   /// order of the original value                                            
+   ///   @tparam ASCEND - when false, the key is inverted, so that sorting    
+   ///      the keys in ascending order, sorts the values in descending       
+   ///   @param value - the value to get the key of                           
+   ///   @return the key                                                      
+   template<bool ASCEND, CT::RadixSortable T> LANGULUS(INLINED)
+   constexpr auto RadixKey(const T& value) noexcept {
+      if constexpr (CT::Exact<T, Hash>) {
+         const auto key = static_cast<::std::uint64_t>(value.mHash);
+         return ASCEND ? key : ~key;
+      }
+      else {
+         using U = RadixWord<T>;
+         constexpr U SignBit = U {1} << (sizeof(U) * 8 - 1);
+         U key = ::std::bit_cast<U>(value);
+
+         if constexpr (CT::Real<T>) {
+            // Negative floats are ordered in reverse, so flip them all,
+            // while positive ones only get their sign flipped          
+            key = (key & SignBit) ? static_cast<U>(~key)
+                                  : static_cast<U>(key | SignBit);
+         }
+         else if constexpr (::std::is_signed_v<T>) {
+            // Two's complement integers just need their sign flipped   
+            key = static_cast<U>(key ^ SignBit);
+         }
+
+         return ASCEND ? key : static_cast<U>(~key);
+      }
+   }
+
+   /// LSD radix sort, one byte at a time                                     
+   /// Digits that are the same for all keys are skipped, so narrow ranges    
+   /// of values are sorted in less passes. The sort is always stable.        
+   ///   @tparam ASCEND - whether to sort in ascending order (123)            
+   ///   @param data - the data to sort                                       
+   ///   @param scratch - a buffer for at least 'count' elements              
+   ///   @param count - number of elements in data                            
+   template<bool ASCEND, CT::RadixSortable T>
+   void RadixSort(T* data, T* scratch, const Count count) noexcept {
+      using K = decltype(RadixKey<ASCEND>(*data));
+      constexpr Offset Passes = sizeof(K);
+
+      // Build histograms for all digits in a single pass               
+      Count histogram[Passes][256] {};
+      for (Offset i = 0; i < count; ++i) {
+         const auto key = RadixKey<ASCEND>(data[i]);
+         for (Offset p = 0; p < Passes; ++p)
+            ++histogram[p][(key >> (p * 8)) & 0xFF];
+      }
+
+      const auto firstKey = RadixKey<ASCEND>(data[0]);
+      auto from = data;
+      auto to = scratch;
+      for (Offset p = 0; p < Passes; ++p) {
+         auto& h = histogram[p];
+         if (h[(firstKey >> (p * 8)) & 0xFF] == count)
+            continue;
+
+         // Convert counts to starting offsets                          
+         Count sum = 0;
+         for (auto& bucket : h) {
+            const auto c = bucket;
+            bucket = sum;
+            sum += c;
+         }
+
+         // Scatter                                                     
+         for (Offset i = 0; i < count; ++i) {
+            const auto digit = (RadixKey<ASCEND>(from[i]) >> (p * 8)) & 0xFF;
+            to[h[digit]++] = from[i];
+         }
+
+         ::std::swap(from, to);
+      }
+
+      if (from != data)
+         CopyMemory(data, from, count);
+   }
+
+   /// Sort the range [begin, end) using insertion sort                       
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   template<class T>
+   void InsertionSort(T* begin, T* end, auto&& less) {
+      if (begin == end)
+         return;
+
+      for (auto cur = begin + 1; cur != end; ++cur) {
+         auto sift = cur;
+         auto sift_1 = cur - 1;
+         if (less(*sift, *sift_1)) {
+            T tmp = ::std::move(*sift);
+            do *sift-- = ::std::move(*sift_1);
+            while (sift != begin and less(tmp, *--sift_1));
+            *sift = ::std::move(tmp);
+         }
+      }
+   }
+
+   /// Sort the range [begin, end) using insertion sort, assuming that        
+   /// *(begin - 1) is an element smaller than or equal to all elements in    
+   /// the range, so that the boundary check can be omitted                   
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   template<class T>
+   void UnguardedInsertionSort(T* begin, T* end, auto&& less) {
+      if (begin == end)
+         return;
+
+      for (auto cur = begin + 1; cur != end; ++cur) {
+         auto sift = cur;
+         auto sift_1 = cur - 1;
+         if (less(*sift, *sift_1)) {
+            T tmp = ::std::move(*sift);
+            do *sift-- = ::std::move(*sift_1);
+            while (less(tmp, *--sift_1));
+            *sift = ::std::move(tmp);
+         }
+      }
+   }
+
+   /// Attempt insertion sort on [begin, end), but give up if it turns out    
+   /// to be too costly                                                       
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   ///   @return true if range got sorted                                     
+   template<class T>
+   bool PartialInsertionSort(T* begin, T* end, auto&& less) {
+      if (begin == end)
+         return true;
+
+      Count limit = 0;
+      for (auto cur = begin + 1; cur != end; ++cur) {
+         auto sift = cur;
+         auto sift_1 = cur - 1;
+         if (less(*sift, *sift_1)) {
+            T tmp = ::std::move(*sift);
+            do *sift-- = ::std::move(*sift_1);
+            while (sift != begin and less(tmp, *--sift_1));
+            *sift = ::std::move(tmp);
+            limit += cur - sift;
+         }
+
+         if (limit > SortPartialInsertionLimit)
+            return false;
+      }
+
+      return true;
+   }
+
+   /// Sort two elements                                                      
+   template<class T> LANGULUS(INLINED)
+   void Sort2(T* a, T* b, auto&& less) {
+      if (less(*b, *a))
+         ::std::iter_swap(a, b);
+   }
+
+   /// Sort three elements                                                    
+   template<class T> LANGULUS(INLINED)
+   void Sort3(T* a, T* b, T* c, auto&& less) {
+      Sort2(a, b, less);
+      Sort2(b, c, less);
+      Sort2(a, b, less);
+   }
+
+   /// Partition [begin, end) around the pivot *begin. Elements equal to the  
+   /// pivot are put in the right-hand partition                              
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   ///   @param alreadyPartitioned - [out] true if no swaps were required     
+   ///   @return the position of the pivot after partitioning                 
+   template<class T>
+   T* PartitionRight(T* begin, T* end, auto&& less, bool& alreadyPartitioned) {
+      T pivot = ::std::move(*begin);
+      auto first = begin;
+      auto last = end;
+
+      // Find the first element greater than or equal to the pivot -    
+      // the median of 3 guarantees that this exists                    
+      while (less(*++first, pivot));
+
+      // Find the first element strictly smaller than the pivot. We     
+      // have to guard this search, if there was no element before      
+      // *first                                                         
+      if (first - 1 == begin)
+         while (first < last and not less(*--last, pivot));
+      else
+         while (not less(*--last, pivot));
+
+      // If the first pair of elements that should be swapped to        
+      // partition are the same element, the input was already          
+      // correctly partitioned                                          
+      alreadyPartitioned = first >= last;
+
+      while (first < last) {
+         ::std::iter_swap(first, last);
+         while (less(*++first, pivot));
+         while (not less(*--last, pivot));
+      }
+
+      // Put the pivot in the right place                               
+      auto pivotPos = first - 1;
+      *begin = ::std::move(*pivotPos);
+      *pivotPos = ::std::move(pivot);
+      return pivotPos;
+   }
+
+   /// Partition [begin, end) around the pivot *begin. Elements equal to the  
+   /// pivot are put in the left-hand partition. Used only when there are     
+   /// lots of equal elements, so it doesn't check for already partitioned    
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   ///   @return the position of the pivot after partitioning                 
+   template<class T>
+   T* PartitionLeft(T* begin, T* end, auto&& less) {
+      T pivot = ::std::move(*begin);
+      auto first = begin;
+      auto last = end;
+
+      while (less(pivot, *--last));
+
+      if (last + 1 == end)
+         while (first < last and not less(pivot, *++first));
+      else
+         while (not less(pivot, *++first));
+
+      while (first < last) {
+         ::std::iter_swap(first, last);
+         while (less(pivot, *--last));
+         while (not less(pivot, *++first));
+      }
+
+      auto pivotPos = last;
+      *begin = ::std::move(*pivotPos);
+      *pivotPos = ::std::move(pivot);
+      return pivotPos;
+   }
+
+   /// Pattern-defeating quicksort loop                                       
+   /// https://github.com/orlp/pdqsort                                        
+   ///   @tparam LEFTMOST - whether range is the leftmost partition           
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   ///   @param badAllowed - number of unbalanced partitions allowed, before  
+   ///      switching to heap sort                                            
+   template<class T, bool LEFTMOST = true>
+   void PdqSortLoop(T* begin, T* end, auto&& less, int badAllowed) {
+      while (true) {
+         const Count size = end - begin;
+
+         // Insertion sort is faster for small arrays                   
+         if (size < SortInsertionThreshold) {
+            if constexpr (LEFTMOST)
+               InsertionSort(begin, end, less);
+            else
+               UnguardedInsertionSort(begin, end, less);
+            return;
+         }
+
+         // Choose pivot as median of 3 or pseudo-median of 9 (ninther) 
+         const auto half = size / 2;
+         if (size > SortNintherThreshold) {
+            Sort3(begin,              begin + half,       end - 1, less);
+            Sort3(begin + 1,          begin + (half - 1), end - 2, less);
+            Sort3(begin + 2,          begin + (half + 1), end - 3, less);
+            Sort3(begin + (half - 1), begin + half,       begin + (half + 1), less);
+            ::std::iter_swap(begin, begin + half);
+         }
+         else Sort3(begin + half, begin, end - 1, less);
+
+         // If *(begin - 1) is the end of the right partition of a      
+         // previous partition operation, then there's no element in    
+         // [begin, end) that is smaller than *(begin - 1). If the pivot
+         // is equal to *(begin - 1), we put equal elements in the left 
+         // partition, because they're already sorted                   
+         if constexpr (not LEFTMOST) {
+            if (not less(*(begin - 1), *begin)) {
+               begin = PartitionLeft(begin, end, less) + 1;
+               continue;
+            }
+         }
+
+         bool alreadyPartitioned;
+         const auto pivotPos = PartitionRight(begin, end, less, alreadyPartitioned);
+
+         // Check for a highly unbalanced partition                     
+         const Count lsize = pivotPos - begin;
+         const Count rsize = end - (pivotPos + 1);
+         if (lsize < size / 8 or rsize < size / 8) {
+            // If we had too many bad partitions, switch to heapsort,   
+            // which guarantees O(n log n)                              
+            if (--badAllowed == 0) {
+               ::std::make_heap(begin, end, less);
+               ::std::sort_heap(begin, end, less);
+               return;
+            }
+
+            // Shuffle some elements around to break patterns           
+            if (lsize >= SortInsertionThreshold) {
+               ::std::iter_swap(begin, begin + lsize / 4);
+               ::std::iter_swap(pivotPos - 1, pivotPos - lsize / 4);
+
+               if (lsize > SortNintherThreshold) {
+                  ::std::iter_swap(begin + 1, begin + (lsize / 4 + 1));
+                  ::std::iter_swap(begin + 2, begin + (lsize / 4 + 2));
+                  ::std::iter_swap(pivotPos - 2, pivotPos - (lsize / 4 + 1));
+                  ::std::iter_swap(pivotPos - 3, pivotPos - (lsize / 4 + 2));
+               }
+            }
+
+            if (rsize >= SortInsertionThreshold) {
+               ::std::iter_swap(pivotPos + 1, pivotPos + (1 + rsize / 4));
+               ::std::iter_swap(end - 1, end - rsize / 4);
+
+               if (rsize > SortNintherThreshold) {
+                  ::std::iter_swap(pivotPos + 2, pivotPos + (2 + rsize / 4));
+                  ::std::iter_swap(pivotPos + 3, pivotPos + (3 + rsize / 4));
+                  ::std::iter_swap(end - 2, end - (1 + rsize / 4));
+                  ::std::iter_swap(end - 3, end - (2 + rsize / 4));
+               }
+            }
+         }
+         else if (alreadyPartitioned
+         and PartialInsertionSort(begin, pivotPos, less)
+         and PartialInsertionSort(pivotPos + 1, end, less)) {
+            // Decently balanced and already partitioned - there's a    
+            // good chance that the range was already sorted            
+            return;
+         }
+
+         // Sort the left partition first using recursion, and do tail  
+         // recursion elimination for the right-hand partition          
+         PdqSortLoop<T, LEFTMOST>(begin, pivotPos, less, badAllowed);
+         begin = pivotPos + 1;
+
+         if constexpr (LEFTMOST) {
+            // Any partition on the right is no longer leftmost         
+            PdqSortLoop<T, false>(begin, end, less, badAllowed);
+            return;
+         }
+      }
+   }
+
+   /// Sort the range [begin, end) using pattern-defeating quicksort          
+   /// Not stable, but runs in O(n log n) worst case, and in O(n) for many    
+   /// common patterns, like already sorted or reversed sequences             
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param less - the ordering predicate                                 
+   template<class T> LANGULUS(INLINED)
+   void PdqSort(T* begin, T* end, auto&& less) {
+      if (begin == end)
+         return;
+
+      const auto size = static_cast<Offset>(end - begin);
+      PdqSortLoop<T, true>(begin, end, less,
+         static_cast<int>(FastLog2(size)) + 1);
+   }
+
+   /// Stable merge sort of the range [begin, end)                            
+   ///   @attention intended for trivially copyable T, like indices           
+   ///   @param begin - first element                                         
+   ///   @param end - one past the last element                               
+   ///   @param scratch - a buffer for at least end - begin elements          
+   ///   @param less - the ordering predicate                                 
+   template<class T>
+   void MergeSort(T* begin, T* end, T* scratch, auto&& less) {
+      const Count size = end - begin;
+
+      // Sort small runs via insertion sort, it is stable, too          
+      constexpr Count Run = SortInsertionThreshold;
+      for (Offset i = 0; i < size; i += Run)
+         InsertionSort(begin + i, begin + ::std::min(i + Run, size), less);
+
+      // Then merge runs bottom-up, ping-ponging between buffers        
+      auto from = begin;
+      auto to = scratch;
+      for (Count width = Run; width < size; width *= 2) {
+         for (Offset lo = 0; lo < size; lo += 2 * width) {
+            const auto mid = ::std::min(lo + width, size);
+            const auto hi = ::std::min(lo + 2 * width, size);
+            auto l = from + lo;
+            auto r = from + mid;
+            auto o = to + lo;
+
+            // Take from the right only when strictly less, so that     
+            // equal elements preserve their relative order             
+            while (l != from + mid and r != from + hi)
+               *o++ = less(*r, *l) ? *r++ : *l++;
+            while (l != from + mid)
+               *o++ = *l++;
+            while (r != from + hi)
+               *o++ = *r++;
+         }
+
+         ::std::swap(from, to);
+      }
+
+      if (from != begin)
+         CopyMemory(begin, from, size);
+   }
+
+} // namespace Langulus::Anyness::Inner
+
+
+namespace Langulus::Anyness
+{
+
+   /// Sort the contents of this container                                    
+   ///   Picks the best available engine, depending on the contained type:    
+   ///   - LSD radix sort for built-in numbers and hashes, when many          
+   ///   - pattern-defeating quicksort for other comparable types             
+   ///   - stable merge sort of indices, followed by a single permutation     
+   ///     pass for stable sorting and for sparse containers                  
+   ///   Type-erased containers dispatch to the radix engine at runtime, if   
+   ///   they contain fundamental types, otherwise use SortWith()             
+   ///   @attention reflected types carry no ordering, only equality, so      
+   ///      type-erased containers of anything but fundamental types and      
+   ///      pointers throw Except::Compare, and must use SortWith() instead   
+   ///   @tparam ASCEND - whether to sort in ascending order (123)            
+   ///   @tparam STABLE - whether equal elements should keep their order      
+   template<class TYPE> template<bool ASCEND, bool STABLE>
+   void Block<TYPE>::Sort() requires (TypeErased or CT::Sortable<TYPE, TYPE>) {
+      if (mCount < 2)
+         return;
+
+      if constexpr (TypeErased) {
+         LANGULUS_ASSERT(IsTyped(), Compare, "Sorting an untyped container");
+
+         if (mType->mIsSparse) {
+            // Order pointers by address                                
+            return SortWith<STABLE>([](const Block<>& lhs, const Block<>& rhs) {
+               if constexpr (ASCEND)
+                  return *lhs.mRawSparse < *rhs.mRawSparse;
+               else
+                  return *lhs.mRawSparse > *rhs.mRawSparse;
+            });
+         }
+
+         // Attempt interpreting the contents as a fundamental type     
+         const auto sortAs = [this]<class T>() {
+            if constexpr (CT::Sortable<T, T>) {
+               if (mType->template IsSimilar<T>()) {
+                  reinterpret_cast<Block<T>*>(this)
+                     ->template Sort<ASCEND, STABLE>();
+                  return true;
+               }
+            }
+            return false;
+         };
+
+         const bool sorted = [&]<class...T>(Types<T...>) {
+            return (sortAs.template operator()<T>() or ...);
+         }(Types<
+            ::std::int8_t,  ::std::uint8_t,
+            ::std::int16_t, ::std::uint16_t,
+            ::std::int32_t, ::std::uint32_t,
+            ::std::int64_t, ::std::uint64_t,
+            char, wchar_t, char8_t, char16_t, char32_t,
+            float, double, Hash
+         > {});
+
+         LANGULUS_ASSERT(sorted, Compare,
+            "Can't sort elements"
+            " - no ordering available, use SortWith for type ", mType);
+      }
+      else {
+         using T = Decvq<TYPE>;
+         const auto less = [](const T& lhs, const T& rhs) {
+            if constexpr (ASCEND)
+               return lhs < rhs;
+            else
+               return lhs > rhs;
+         };
+
+         if constexpr (CT::RadixSortable<T>) {
+            BranchOut();
+
+            if (mCount >= Inner::SortRadixThreshold) {
+               // Radix sort is always stable                           
+               TMany<T> scratch;
+               scratch.Reserve(mCount);
+               Inner::RadixSort<ASCEND>(
+                  GetRaw(), const_cast<T*>(scratch.GetRaw()), mCount);
+            }
+            else if constexpr (STABLE) {
+               // Not worth the radix overhead, insertion is stable     
+               Inner::InsertionSort(GetRaw(), GetRaw() + mCount, less);
+            }
+            else Inner::PdqSort(GetRaw(), GetRaw() + mCount, less);
+         }
+         else SortWith<STABLE>(less);
+      }
+   }
+
+   /// Sort the contents of this container using a custom ordering predicate  
+   ///   @tparam STABLE - whether equal elements should keep their order      
+   ///   @param less - a predicate that returns true, if its first argument   
+   ///      should be placed before its second one. For statically typed      
+   ///      containers, it receives the contained type by const reference,    
+   ///      otherwise it receives both elements wrapped in a Block<>          
+   template<class TYPE> template<bool STABLE>
+   void Block<TYPE>::SortWith(auto&& less) {
+      if (mCount < 2)
+         return;
+
+      BranchOut();
+
+      if constexpr (not TypeErased and not STABLE and Dense
+      and ::std::movable<Decvq<TYPE>>) {
+         // Sort elements in-place - swaps are cheap enough             
+         Inner::PdqSort(GetRaw(), GetRaw() + mCount, less);
+      }
+      else {
+         // Sort indices instead of elements, then move every element   
+         // only once, when applying the permutation. This is the only  
+         // option for type-erased containers, where each move goes     
+         // through the reflected constructors, and for sparse          
+         // containers, where entries must follow their pointers        
+         TMany<Offset> indices;
+         indices.Reserve(mCount * 2);
+         const auto order = const_cast<Offset*>(indices.GetRaw());
+         for (Offset i = 0; i < mCount; ++i)
+            order[i] = i;
+
+         const auto lessIdx = [&](Offset lhs, Offset rhs) {
+            if constexpr (TypeErased)
+               return less(GetElementInner(lhs), GetElementInner(rhs));
+            else
+               return less(GetRaw()[lhs], GetRaw()[rhs]);
+         };
+
+         if constexpr (STABLE)
+            Inner::MergeSort(order, order + mCount, order + mCount, lessIdx);
+         else
+            Inner::PdqSort(order, order + mCount, lessIdx);
+
+         PermuteInner(order);
+      }
+   }
+
+   /// Rearrange elements, so that element at i becomes the element that was  
+   /// previously at order[i]. Each element is moved exactly once, by walking 
+   /// the cycles of the permutation                                          
+   ///   @attention assumes order is a valid permutation of mCount indices    
+   ///   @attention order is used as scratch memory and is invalid after call 
+   ///   @param order - the permutation to apply                              
+   template<class TYPE>
+   void Block<TYPE>::PermuteInner(Offset* order) {
+      if constexpr (not TypeErased and Dense and not CT::POD<TYPE>) {
+         // Move statically typed elements via their move-assignment    
+         const auto data = GetRaw();
+         for (Offset i = 0; i < mCount; ++i) {
+            if (order[i] == i)
+               continue;
+
+            Decvq<TYPE> parked = ::std::move(data[i]);
+            Offset j = i;
+            while (order[j] != i) {
+               const auto k = order[j];
+               data[j] = ::std::move(data[k]);
+               order[j] = j;
+               j = k;
+            }
+
+            data[j] = ::std::move(parked);
+            order[j] = j;
+         }
+      }
+      else {
+         // A single element worth of temporary storage                 
+         Block<TYPE> temporary {mState, mType};
+         temporary.AllocateFresh(temporary.RequestSize(1));
+         temporary.mCount = 1;
+
+         // Release the temporary storage even if a move throws         
+         struct Scratch {
+            Allocation* mEntry;
+            ~Scratch() { Allocator::Deallocate(mEntry); }
+         } scratch {const_cast<Allocation*>(temporary.mEntry)};
+
+         // Elements that can be moved bytewise are trivially           
+         // relocatable elements, and pointers, as long as their        
+         // entries follow them                                         
+         const bool bytewise = IsSparse() or IsRelocatable();
+         const auto entries = IsSparse() and mEntry
+            ? const_cast<const Allocation**>(GetEntries()) : nullptr;
+         const auto stride = GetStride();
+
+         const auto relocate = [&](Block<TYPE>& to, Block<TYPE>& from) {
+            if (bytewise)
+               CopyMemory(to.mRaw, from.mRaw, stride);
+            else {
+               to.CreateWithIntent(Abandon(from));
+               from.FreeInner();
+            }
+         };
+
+         for (Offset i = 0; i < mCount; ++i) {
+            if (order[i] == i)
+               continue;
+
+            auto from = CropInner(i, 1);
+            relocate(temporary, from);
+            const Allocation* parkedEntry = entries ? entries[i] : nullptr;
+
+            Offset j = i;
+            while (order[j] != i) {
+               const auto k = order[j];
+               auto to = CropInner(j, 1);
+               from = CropInner(k, 1);
+               relocate(to, from);
+               if (entries)
+                  entries[j] = entries[k];
+               order[j] = j;
+               j = k;
+            }
+
+            auto to = CropInner(j, 1);
+            relocate(to, temporary);
+            if (entries)
+               entries[j] = parkedEntry;
+            order[j] = j;
+         }
+      }
+   }
+
+} // namespace Langulus::Anyness
@@ -32,6 +32,11 @@ namespace Langulus
          static constexpr Count MinimalAllocation = 8;
          static constexpr Count AllowedMisses = 128;
 
+         // Whether a byte of each key's hash is kept after the info    
+         // bytes, so that most mismatching keys are rejected without   
+         // touching key memory                                         
+         static constexpr bool Fingerprints = LANGULUS_FEATURE(HASH_FINGERPRINTS);
+
       protected:
          // A precomputed pointer for the info/ordering bytes           
          // Points to an offset inside mKeys allocation                 
@@ -40,6 +45,8 @@ namespace Langulus
          //    1 - the index is used, and key is where it should be     
          //   2+ - the index is used, but bucket is info-1 buckets to   
          //         the right of this index                             
+         // Ordered maps also keep a doubly-linked list of the pairs in 
+         // the order they were inserted, after the info bytes          
          InfoType* mInfo {};
 
          // The block that contains the keys and info bytes             
@@ -116,6 +123,7 @@ namespace Langulus::Anyness
 
       static constexpr bool Ownership = false;
       static constexpr bool Ordered = false;
+      static constexpr Engine Probing = Engine::RobinHood;
 
       ///                                                                     
       ///   Construction & Assignment                                         
@@ -240,6 +248,35 @@ namespace Langulus::Anyness
       NOD() auto GetInfoEnd() const noexcept -> const InfoType*;
 
    protected:
+      NOD() auto GetFingerprints() const noexcept -> const InfoType*;
+      NOD() auto GetFingerprints()       noexcept -> InfoType*;
+      template<CT::Map>
+      NOD() Size GetInfoSize() const noexcept;
+      template<CT::Map>
+      NOD() static constexpr Size RequestInfoSize(Count) noexcept;
+      NOD() static constexpr Offset GetOrderOffset(Count) noexcept;
+
+      NOD() auto GetOrder() const noexcept -> const OrderType*;
+      NOD() auto GetOrder()       noexcept -> OrderType*;
+      template<CT::Map>
+      NOD() auto GetOrderLink(Offset) const noexcept -> const OrderType*;
+      NOD() Offset GetOrderNext(Offset) const noexcept;
+      NOD() Offset GetOrderPrev(Offset) const noexcept;
+      void SetOrderLink(Offset, Offset) noexcept;
+
+      template<CT::Map>
+      void OrderReset() noexcept;
+      template<CT::Map>
+      void OrderAppend(Offset) noexcept;
+      template<CT::Map>
+      void OrderUnlink(Offset) noexcept;
+      template<CT::Map>
+      void OrderMove(Offset, Offset) noexcept;
+      template<CT::Map>
+      void OrderSwap(Offset, bool) noexcept;
+      template<CT::Map>
+      void OrderPlace(Offset, bool) noexcept;
+
       NOD() Count GetCountDeep(const CT::Block auto&) const noexcept;
       NOD() Count GetCountElementsDeep(const CT::Block auto&) const noexcept;
 
@@ -267,6 +304,7 @@ namespace Langulus::Anyness
 
       NOD() static Offset GetBucket(Offset, const CT::NoIntent auto&) noexcept;
       NOD() static Offset GetBucketUnknown(Offset, const Block<>&) noexcept;
+      NOD() static InfoType GetFingerprint(const Hash&) noexcept;
 
       template<CT::Map>
       NOD() decltype(auto) GetRawKey(Offset) const IF_UNSAFE(noexcept);
@@ -336,6 +374,11 @@ namespace Langulus::Anyness
       Count ForEachValueDeep(auto&&...) const;
 
    protected:
+      template<CT::Map, bool REVERSE = false>
+      NOD() Offset GetNextIndex(Offset) const noexcept;
+      template<CT::Map, bool REVERSE = false>
+      Offset DiscardInner(Offset);
+
       template<CT::Map, bool REVERSE>
       LoopControl ForEachElementInner(const CT::Block auto&, auto&&, Count&) const;
 
@@ -431,6 +474,7 @@ namespace Langulus::Anyness
       NOD() Offset FindInner(const CT::NoIntent auto&) const;
       template<CT::Map>
       NOD() Offset FindBlockInner(const Block<>&) const;
+      NOD() Offset FindGroupInner(const Hash&, auto&&) const;
 
    public:
       ///                                                                     
@@ -447,6 +491,8 @@ namespace Langulus::Anyness
       void AllocateData(Count);
       template<CT::Map>
       void AllocateInner(Count);
+      template<CT::Map>
+      void Reorder();
 
       template<CT::Map, bool DEEP = false>
       void Keep() const noexcept;
@@ -473,6 +519,8 @@ namespace Langulus::Anyness
       auto CreateKeyHandle(auto&&);
       template<CT::Map>
       auto CreateValHandle(auto&&);
+      template<CT::Map>
+      static auto& GetSwapper(auto&) noexcept;
 
       template<CT::Map>
       NOD() Size RequestKeyAndInfoSize(Count, Offset&) const IF_UNSAFE(noexcept);
@@ -485,10 +533,13 @@ namespace Langulus::Anyness
       template<CT::Map>
       void RehashVals(BlockMap&);
       template<CT::Map>
-      void RehashInner(const Count hashmask, const Offset current, Offset& moveTo, auto& key, auto& val);
+      void RehashInner(InfoType*, Count);
       template<CT::Map>
       void ShiftPairs();
 
+      template<CT::Map>
+      void PrefetchBucket(Offset) const noexcept;
+
       template<CT::Map, bool CHECK_FOR_MATCH>
       Offset InsertInner(Offset, auto&&, auto&&);
 
@@ -533,6 +584,7 @@ namespace Langulus::Anyness
 
       template<CT::Map>
       void RemoveInner(Offset);
+      NOD() Offset GetShiftedIndex(Offset, Offset) const noexcept;
 
    #if LANGULUS(TESTING)
       public: NOD() constexpr const void* GetRawKeysMemory() const noexcept;
@@ -569,8 +621,11 @@ namespace Langulus::Anyness
       friend struct BlockMap;
       const InfoType* mInfo;
       const InfoType* mSentinel;
+      // Points to the insertion order link of the current pair, used   
+      // only when iterating ordered maps                               
+      const OrderType* mOrder;
 
-      constexpr Iterator(const InfoType*, const InfoType*, const KA&, const VA&) noexcept;
+      constexpr Iterator(const InfoType*, const InfoType*, const KA&, const VA&, const OrderType* = nullptr) noexcept;
 
    public:
       Iterator() noexcept = delete;
@@ -614,7 +669,7 @@ namespace Langulus::Anyness
 
       constexpr explicit operator bool() const noexcept;
       constexpr operator Iterator<const MAP>() const noexcept requires Mutable {
-         return {mInfo, mSentinel, mKey, mValue};
+         return {mInfo, mSentinel, mKey, mValue, mOrder};
       }
    };
 
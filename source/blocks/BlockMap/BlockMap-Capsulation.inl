@@ -155,6 +155,192 @@ namespace Langulus::Anyness
       return mInfo + GetReserved();
    }
 
+   /// Get the fingerprints array, that follows the info sentinel (const)     
+   ///   @attention contents are valid only if Fingerprints is enabled        
+   ///   @return a pointer to the first fingerprint                           
+   LANGULUS(INLINED)
+   auto BlockMap::GetFingerprints() const noexcept -> const InfoType* {
+      return mInfo + GetReserved() + 1;
+   }
+
+   /// Get the fingerprints array, that follows the info sentinel             
+   ///   @attention contents are valid only if Fingerprints is enabled        
+   ///   @return a pointer to the first fingerprint                           
+   LANGULUS(INLINED)
+   auto BlockMap::GetFingerprints() noexcept -> InfoType* {
+      return mInfo + GetReserved() + 1;
+   }
+
+   /// Get the number of bytes after the keys, that are used for info bytes,  
+   /// the sentinel, fingerprints (if enabled) and insertion order (if THIS   
+   /// is ordered)                                                            
+   ///   @return the number of bytes                                          
+   template<CT::Map THIS> LANGULUS(INLINED)
+   Size BlockMap::GetInfoSize() const noexcept {
+      return RequestInfoSize<THIS>(GetReserved());
+   }
+
+   /// Get the number of bytes after the keys, required for a given number    
+   /// of slots                                                               
+   ///   @param count - the number of slots                                   
+   ///   @return the number of bytes                                          
+   template<CT::Map THIS> LANGULUS(INLINED)
+   constexpr Size BlockMap::RequestInfoSize(const Count count) noexcept {
+      if constexpr (THIS::Ordered) {
+         // Two links for each slot, and three additional labels - the  
+         // anchor, the carried pair, and a temporary for swapping      
+         return GetOrderOffset(count) + 2 * (count + 3) * sizeof(OrderType);
+      }
+      else return count * (Fingerprints ? 2 : 1) + 1;
+   }
+
+   /// Get the offset of the insertion order links, relative to the start of  
+   /// the info array. The links are aligned, and follow the fingerprints     
+   ///   @param count - the number of slots                                   
+   ///   @return the offset in bytes                                          
+   LANGULUS(INLINED)
+   constexpr Offset BlockMap::GetOrderOffset(const Count count) noexcept {
+      const Offset bytes = count * (Fingerprints ? 2 : 1) + 1;
+      return (bytes + sizeof(OrderType) - 1) & ~(sizeof(OrderType) - 1);
+   }
+
+   /// Get the insertion order links of an ordered map (const)                
+   /// Each slot, as well as the anchor (at the reserved count), the carried  
+   /// pair and a temporary label, has a link to the next and to the previous 
+   /// label. Links are relative to the label itself, so that iterators can   
+   /// follow them without knowing where the array starts                     
+   ///   @attention contents are valid only if the map is ordered             
+   ///   @return a pointer to the first 'next' link                           
+   LANGULUS(INLINED)
+   auto BlockMap::GetOrder() const noexcept -> const OrderType* {
+      return reinterpret_cast<const OrderType*>(
+         mInfo + GetOrderOffset(GetReserved()));
+   }
+
+   /// Get the insertion order links of an ordered map                        
+   ///   @attention contents are valid only if the map is ordered             
+   ///   @return a pointer to the first 'next' link                           
+   LANGULUS(INLINED)
+   auto BlockMap::GetOrder() noexcept -> OrderType* {
+      return reinterpret_cast<OrderType*>(
+         mInfo + GetOrderOffset(GetReserved()));
+   }
+
+   /// Get the 'next' link of a slot, for use in iterators                    
+   ///   @param index - the slot                                              
+   ///   @return the link, or nullptr if THIS is not ordered                  
+   template<CT::Map THIS> LANGULUS(INLINED)
+   auto BlockMap::GetOrderLink(const Offset index) const noexcept
+   -> const OrderType* {
+      if constexpr (THIS::Ordered)
+         return GetOrder() + index;
+      else
+         return nullptr;
+   }
+
+   /// Get the label that follows another in insertion order                  
+   ///   @param index - the label                                             
+   ///   @return the next label                                               
+   LANGULUS(INLINED)
+   Offset BlockMap::GetOrderNext(const Offset index) const noexcept {
+      return index + GetOrder()[index];
+   }
+
+   /// Get the label that precedes another in insertion order                 
+   ///   @param index - the label                                             
+   ///   @return the previous label                                           
+   LANGULUS(INLINED)
+   Offset BlockMap::GetOrderPrev(const Offset index) const noexcept {
+      return index + GetOrder()[GetReserved() + 3 + index];
+   }
+
+   /// Make one label follow another in insertion order                       
+   ///   @param from - the preceding label                                    
+   ///   @param to - the following label                                      
+   LANGULUS(INLINED)
+   void BlockMap::SetOrderLink(const Offset from, const Offset to) noexcept {
+      const auto order = GetOrder();
+      order[from] = to - from;
+      order[GetReserved() + 3 + to] = from - to;
+   }
+
+   /// Forget the insertion order of all pairs                                
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::OrderReset() noexcept {
+      if constexpr (THIS::Ordered)
+         SetOrderLink(GetReserved(), GetReserved());
+   }
+
+   /// Make a slot the most recently inserted one                             
+   ///   @param index - the slot                                              
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::OrderAppend(const Offset index) noexcept {
+      if constexpr (THIS::Ordered) {
+         const auto anchor = GetReserved();
+         SetOrderLink(GetOrderPrev(anchor), index);
+         SetOrderLink(index, anchor);
+      }
+   }
+
+   /// Remove a slot from the insertion order                                 
+   ///   @param index - the slot                                              
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::OrderUnlink(const Offset index) noexcept {
+      if constexpr (THIS::Ordered)
+         SetOrderLink(GetOrderPrev(index), GetOrderNext(index));
+   }
+
+   /// Make a label take the place of another in insertion order, used when   
+   /// a pair is moved to a different slot                                    
+   ///   @attention assumes 'to' is not linked                                
+   ///   @param from - the label to replace                                   
+   ///   @param to - the label to put in its place                            
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::OrderMove(const Offset from, const Offset to) noexcept {
+      if constexpr (THIS::Ordered) {
+         const auto prev = GetOrderPrev(from);
+         const auto next = GetOrderNext(from);
+         SetOrderLink(prev, to);
+         SetOrderLink(to, next);
+      }
+   }
+
+   /// Account for a robin-hood swap on insertion - the carried pair settles  
+   /// at a slot, and the pair that was there is carried further              
+   ///   @param index - the slot where the swap happened                      
+   ///   @param first - whether it is the first swap, which settles the pair  
+   ///                  that is being inserted                                
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::OrderSwap(const Offset index, const bool first) noexcept {
+      if constexpr (THIS::Ordered) {
+         const auto carried = GetReserved() + 1;
+         if (first) {
+            OrderMove<THIS>(index, carried);
+            OrderAppend<THIS>(index);
+         }
+         else {
+            const auto temporary = GetReserved() + 2;
+            OrderMove<THIS>(index, temporary);
+            OrderMove<THIS>(carried, index);
+            OrderMove<THIS>(temporary, carried);
+         }
+      }
+   }
+
+   /// Account for the carried pair settling at an empty slot on insertion    
+   ///   @param index - the empty slot                                        
+   ///   @param swapped - whether the carried pair is a displaced one, or     
+   ///                    the pair that is being inserted                     
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::OrderPlace(const Offset index, const bool swapped) noexcept {
+      if constexpr (THIS::Ordered) {
+         if (swapped)
+            OrderMove<THIS>(GetReserved() + 1, index);
+         else
+            OrderAppend<THIS>(index);
+      }
+   }
+
    /// Get the key container                                                  
    ///   @attention for internal use only, elements might not be initialized  
    template<CT::Map THIS> LANGULUS(INLINED)
@@ -8,6 +8,7 @@
 #pragma once
 #include "../BlockMap.hpp"
 #include "../../text/Text.hpp"
+#include "../../Vectorize.hpp"
 
 
 namespace Langulus::Anyness
@@ -61,7 +62,7 @@ namespace Langulus::Anyness
       using P = Deref<decltype(rhs)>;
       using RHS = Conditional<CT::Typed<THIS>
          , THIS
-         , TMap<typename P::Key, typename P::Value, THIS::Ordered>>;
+         , TMap<typename P::Key, typename P::Value, THIS::Ordered, THIS::Probing>>;
 
       Offset idx;
       if constexpr (CT::Typed<RHS>)
@@ -188,7 +189,8 @@ namespace Langulus::Anyness
       return {
          GetInfo() + offset, GetInfoEnd(),
          GetRawKey<THIS>(offset),
-         GetRawVal<THIS>(offset)
+         GetRawVal<THIS>(offset),
+         GetOrderLink<THIS>(offset)
       };
    }
    
@@ -262,52 +264,32 @@ namespace Langulus::Anyness
             else return InvalidOffset;
          }
 
-         // Get the starting index based on the key hash                
-         const auto start = GetBucket(GetReserved() - 1, match);
-         auto info = GetInfo() + start;
-         if (not *info)
-            return InvalidOffset;
-
-         // Test first candidate                                        
-         if (GetKeyRef<THIS>(start) == match)
-            return start;
-
-         // Test all candidates on the right up until the end           
-         ++info;
-
-         auto infoEnd = GetInfoEnd();
-         while (info < infoEnd) {
-            if (not *info)
-               return InvalidOffset;
-
-            const auto i = info - GetInfo();
-            if (GetKeyRef<THIS>(i) == match)
-               return i;
-
-            ++info;
+         // Get the starting index based on the key hash, and walk      
+         // the probe sequence. Robin-hood insertion guarantees, that   
+         // the pairs in a cluster are sorted by distance from their    
+         // buckets, so a stored distance below the current one means   
+         // that the key can't be any further in the sequence           
+         const auto hash = HashOf(match);
+         if constexpr (THIS::Probing == Engine::Swiss) {
+            return FindGroupInner(hash, [&](Offset index) {
+               return GetKeyRef<THIS>(index) == match;
+            });
          }
 
-         // Reached only if info has reached the end                    
-         // Keys might loop around, continue the search from the start  
-         info = GetInfo();
-         if (not *info)
-            return InvalidOffset;
-
-         if (GetKeyRef<THIS>(0) == match)
-            return 0;
-
-         ++info;
-
-         infoEnd = GetInfo() + start;
-         while (info < infoEnd) {
-            if (not *info)
-               return InvalidOffset;
-
-            const auto i = info - GetInfo();
-            if (GetKeyRef<THIS>(i) == match)
-               return i;
-
-            ++info;
+         const auto info = GetInfo();
+         const auto prints = GetFingerprints();
+         const auto mask = GetReserved() - 1;
+         const auto print = GetFingerprint(hash);
+         auto index = hash.mHash & mask;
+         Offset distance = 1;
+         while (info[index] >= distance) {
+            if ((not Fingerprints or prints[index] == print)
+            and GetKeyRef<THIS>(index) == match)
+               return index;
+
+            // Keys might loop around the end of the table              
+            index = (index + 1) & mask;
+            ++distance;
          }
 
          // No such key was found                                       
@@ -323,56 +305,87 @@ namespace Langulus::Anyness
       if (IsEmpty() or not IsKeySimilar<THIS>(match.GetType()))
          return InvalidOffset;
 
-      // Get the starting index based on the key hash                   
-      const auto start = GetBucketUnknown(GetReserved() - 1, match);
-      auto info = GetInfo() + start;
-      if (not *info)
-         return InvalidOffset;
-
-      // Test first candidate                                           
-      if (GetKeyRef<THIS>(start) == match)
-         return start;
-
-      // Test all candidates on the right up until the end              
-      ++info;
-
-      auto infoEnd = GetInfoEnd();
-      while (info != infoEnd) {
-         if (not *info)
-            return InvalidOffset;
-
-         const auto i = info - GetInfo();
-         if (GetKeyRef<THIS>(i) == match)
-            return i;
+      // Get the starting index based on the key hash, and walk the     
+      // probe sequence, until a pair closer to its bucket is found     
+      const auto hash = match.GetHash();
+      if constexpr (THIS::Probing == Engine::Swiss) {
+         return FindGroupInner(hash, [&](Offset index) {
+            return GetKeyRef<THIS>(index) == match;
+         });
+      }
 
-         ++info;
+      const auto info = GetInfo();
+      const auto prints = GetFingerprints();
+      const auto mask = GetReserved() - 1;
+      const auto print = GetFingerprint(hash);
+      auto index = hash.mHash & mask;
+      Offset distance = 1;
+      while (info[index] >= distance) {
+         if ((not Fingerprints or prints[index] == print)
+         and GetKeyRef<THIS>(index) == match)
+            return index;
+
+         // Keys might loop around the end of the table                 
+         index = (index + 1) & mask;
+         ++distance;
       }
 
-      // Reached only if info has reached the end                       
-      // Keys might loop around, continue the search from the start     
-      info = GetInfo();
-      if (not *info)
-         return InvalidOffset;
+      // No such key was found                                          
+      return InvalidOffset;
+   }
 
-      if (GetKeyRef<THIS>(0) == match)
-         return 0;
+   /// Find the index of a pair by walking the probe sequence in groups of    
+   /// 16 info bytes, instead of one byte at a time. Only pairs that belong   
+   /// to the same bucket as the key (and have the same fingerprint, if       
+   /// enabled) are ever compared                                             
+   ///   @param hash - the hash of the key to search for                      
+   ///   @param matches - predicate that compares the key at an index         
+   ///   @return the index, or InvalidOffset if not found                     
+   Offset BlockMap::FindGroupInner(const Hash& hash, auto&& matches) const {
+      const auto info = GetInfo();
+      const auto prints = GetFingerprints();
+      const auto reserved = GetReserved();
+      const auto print = GetFingerprint(hash);
+      Offset index = hash.mHash & (reserved - 1);
+      Offset distance = 1;
+
+      while (true) {
+         if (index + Inner::GroupSize <= reserved and distance < 0xF0) {
+            // Match a whole group at once                              
+            unsigned candidates;
+            const auto run = Inner::ProbeGroup(info + index, distance, candidates);
+            if constexpr (Fingerprints)
+               candidates &= Inner::MatchGroup(prints + index, print);
+
+            while (candidates) {
+               const auto found = index + ::std::countr_zero(candidates);
+               if (matches(found))
+                  return found;
+               candidates &= candidates - 1;
+            }
 
-      ++info;
+            if (run < Inner::GroupSize)
+               return InvalidOffset;
 
-      infoEnd = GetInfo() + start;
-      while (info != infoEnd) {
-         if (not *info)
-            return InvalidOffset;
+            index = (index + Inner::GroupSize) & (reserved - 1);
+            distance += Inner::GroupSize;
+         }
+         else {
+            // Groups can't cross the end of the table, so walk the     
+            // rest of it one byte at a time, and loop around           
+            for (; index < reserved; ++index, ++distance) {
+               if (info[index] < distance)
+                  return InvalidOffset;
 
-         const auto i = info - GetInfo();
-         if (GetKeyRef<THIS>(i) == match)
-            return i;
+               if (info[index] == distance
+               and (not Fingerprints or prints[index] == print)
+               and matches(index))
+                  return index;
+            }
 
-         ++info;
+            index = 0;
+         }
       }
-      
-      // No such key was found                                          
-      return InvalidOffset;
    }
-   
+
 } // namespace Langulus::Anyness
@@ -20,6 +20,23 @@ namespace Langulus::Anyness
    void BlockMap::BlockTransfer(S<FROM>&& other) {
       using SS = S<FROM>;
 
+      if constexpr (TO::Ordered and not FROM::Ordered) {
+         // The source doesn't keep track of insertion order, so we     
+         // transfer it as it is, and then rebuild it in the order      
+         // pairs are stored in                                         
+         BlockTransfer<FROM>(other.Forward());
+         if constexpr (CT::TypedMap<TO>) {
+            mKeys.mType    = MetaDataOf<typename TO::Key>();
+            mValues.mType  = MetaDataOf<typename TO::Value>();
+            mKeys.mState  += DataState::Typed;
+            mValues.mState += DataState::Typed;
+         }
+
+         if (not IsEmpty())
+            Reorder<TO>();
+         return;
+      }
+
       if constexpr (not CT::TypedMap<TO>) {
          // TO is not statically typed, so we can safely                
          // overwrite type and state                                    
@@ -111,7 +128,7 @@ namespace Langulus::Anyness
                }
 
                AllocateFresh<B>(other->GetReserved());
-               CopyMemory(mInfo, other->mInfo, GetReserved() + 1);
+               CopyMemory(mInfo, other->mInfo, GetInfoSize<B>());
 
                if constexpr (CT::Typed<B>) {
                   // At least one of the maps is typed                  
@@ -232,7 +249,7 @@ namespace Langulus::Anyness
             if constexpr (CT::Dense<K>) {
                // We're cloning dense keys, so we're 100% sure, that    
                // each pair will end up in the same place               
-               CopyMemory(mInfo, other->mInfo, GetReserved() + 1);
+               CopyMemory(mInfo, other->mInfo, GetInfoSize<B>());
 
                if constexpr (CT::POD<K>) {
                   // Data is POD, we can directly copy all keys         
@@ -283,6 +300,7 @@ namespace Langulus::Anyness
                // Zero info bytes and insert pointers                   
                ZeroMemory(mInfo, mKeys.mReserved);
                mInfo[mKeys.mReserved] = 1;
+               OrderReset<B>();
 
                CloneValuesReinsertInner(coalescedKeys, SS::Nest(*asFrom));
             }
@@ -292,7 +310,7 @@ namespace Langulus::Anyness
             if (not asFrom->mKeys.mType->mIsSparse) {
                // We're cloning dense elements, so we're 100% sure, that
                // each element will end up in the same place            
-               CopyMemory(mInfo, other->mInfo, GetReserved() + 1);
+               CopyMemory(mInfo, other->mInfo, GetInfoSize<B>());
 
                if (asFrom->mKeys.mType->mIsPOD) {
                   // Keys are POD, we can directly copy them all        
@@ -343,6 +361,7 @@ namespace Langulus::Anyness
                // Zero info bytes and insert pointers                   
                ZeroMemory(mInfo, mKeys.mReserved);
                mInfo[mKeys.mReserved] = 1;
+               OrderReset<B>();
 
                CloneValuesReinsertInner(coalescedKeys, SS::Nest(*asFrom));
             }
@@ -402,24 +421,20 @@ namespace Langulus::Anyness
             const_cast<Allocation*>(coalescedVals.mEntry)
                ->Keep(asFrom->GetCount());
 
+            // Values were coalesced in iteration order, so they're     
+            // distributed in the same order                            
             auto srcVal = coalescedVals.GetRaw();
-            auto info = GetInfo();
-            const auto infoEnd = GetInfoEnd();
-            auto dstVal = GetValHandle<B>(0);
-            while (info != infoEnd) {
-               if (*info) {
-                  dstVal.CreateWithIntent(
-                     Abandon(HandleLocal<V> {srcVal, coalescedVals.mEntry})
-                  );
-
-                  if constexpr (CT::Referencable<Deptr<V>>)
-                     srcVal->Reference(1);
+            auto index = GetNextIndex<B>(GetReserved());
+            while (index != GetReserved()) {
+               GetValHandle<B>(index).CreateWithIntent(
+                  Abandon(HandleLocal<V> {srcVal, coalescedVals.mEntry})
+               );
 
-                  ++srcVal;
-               }
+               if constexpr (CT::Referencable<Deptr<V>>)
+                  srcVal->Reference(1);
 
-               ++info;
-               ++dstVal;
+               ++srcVal;
+               index = GetNextIndex<B>(index);
             }
          }
       }
@@ -464,23 +479,21 @@ namespace Langulus::Anyness
             const_cast<Allocation*>(coalescedVals.mEntry)
                ->Keep(asFrom->GetCount());
 
+            // Values were coalesced in iteration order, so they're     
+            // distributed in the same order                            
             auto srcVal = coalescedVals.mRaw;
             const Size valstride = coalescedVals.GetStride();
-            auto info = GetInfo();
-            const auto infoEnd = GetInfoEnd();
-            while (info != infoEnd) {
-               if (*info) {
-                  GetValHandle<B>(info - GetInfo()).CreateWithIntent(
-                     Abandon(HandleLocal<void*> {srcVal, coalescedVals.mEntry})
-                  );
-
-                  if (coalescedVals.GetType()->mReference)
-                     coalescedVals.GetType()->mReference(srcVal, 1);
+            auto index = GetNextIndex<B>(GetReserved());
+            while (index != GetReserved()) {
+               GetValHandle<B>(index).CreateWithIntent(
+                  Abandon(HandleLocal<void*> {srcVal, coalescedVals.mEntry})
+               );
 
-                  srcVal += valstride.mSize;
-               }
+               if (coalescedVals.GetType()->mReference)
+                  coalescedVals.GetType()->mReference(srcVal, 1);
 
-               ++info;
+               srcVal += valstride.mSize;
+               index = GetNextIndex<B>(index);
             }
          }
       }
@@ -506,11 +519,9 @@ namespace Langulus::Anyness
          const auto ptrEnd = coalescedKeys.GetRawEnd();
 
          if constexpr (CT::Dense<V>) {
-            // Values are dense, however                                
-            int valIdx = 0;
-            while (not asFrom->mInfo[valIdx])
-               ++valIdx;
-
+            // Values are dense, however - keys were coalesced in       
+            // iteration order, so values are walked in the same order  
+            auto valIdx = asFrom->template GetNextIndex<B>(asFrom->GetReserved());
             while (ptr != ptrEnd) {
                InsertInner<B, false>(
                   GetBucket(GetReserved() - 1, ptr),
@@ -522,10 +533,7 @@ namespace Langulus::Anyness
                   ptr->Reference(1);
 
                ++ptr;
-               ++valIdx;
-
-               while (not asFrom->mInfo[valIdx])
-                  ++valIdx;
+               valIdx = asFrom->template GetNextIndex<B>(valIdx);
             }
          }
          else {
@@ -568,11 +576,9 @@ namespace Langulus::Anyness
          const Size stride = coalescedKeys.GetStride();
 
          if (not asFrom->mValues.mType->mIsSparse) {
-            // Values are dense, however                                
-            int valIdx = 0;
-            while (not asFrom->mInfo[valIdx])
-               ++valIdx;
-
+            // Values are dense, however - keys were coalesced in       
+            // iteration order, so values are walked in the same order  
+            auto valIdx = asFrom->template GetNextIndex<B>(asFrom->GetReserved());
             while (ptr != ptrEnd) {
                InsertInner<B, false>(
                   GetBucket(GetReserved() - 1, ptr),
@@ -583,10 +589,8 @@ namespace Langulus::Anyness
                if (coalescedKeys.GetType()->mReference)
                   coalescedKeys.GetType()->mReference(ptr, 1);
 
-               ++ptr;
-               ++valIdx;
-               while (not asFrom->mInfo[valIdx])
-                  ++valIdx;
+               ptr += stride.mSize;
+               valIdx = asFrom->template GetNextIndex<B>(valIdx);
             }
          }
          else {
@@ -637,10 +641,12 @@ namespace Langulus::Anyness
          if constexpr (CT::Typed<THIS>
          and CT::ReferMakable<typename THIS::Key>
          and CT::ReferMakable<typename THIS::Value>) {
-            const BlockMap backup = *this;
-            const_cast<Allocation*>(mKeys.mEntry)->Free();
-            const_cast<Allocation*>(mValues.mEntry)->Free();
+            // The original is released only after copying, because     
+            // other owners might release it in the meantime            
+            BlockMap backup = *this;
             new (this) THIS {Copy(reinterpret_cast<const THIS&>(backup))};
+            backup.GetVals<THIS>().FreeShared(backup.mInfo);
+            backup.GetKeys<THIS>().FreeShared(backup.mInfo);
             return true;
          }
          else LANGULUS_THROW(Construct,
@@ -137,6 +137,18 @@ namespace Langulus::Anyness
       return value.GetHash().mHash & mask;
    }
 
+   /// Get the fingerprint of a hash, that is stored next to the info bytes   
+   /// The hash is scrambled, so that its highest byte depends on all bits,   
+   /// even for weak hashes, like the ones of small integers                  
+   ///   @param hash - the hash to fingerprint                                
+   ///   @return the fingerprint                                              
+   LANGULUS(ALWAYS_INLINED)
+   auto BlockMap::GetFingerprint(const Hash& hash) noexcept -> InfoType {
+      constexpr auto golden = static_cast<decltype(hash.mHash)>(0x9E3779B97F4A7C15ull);
+      constexpr auto shift = sizeof(hash.mHash) * 8 - sizeof(InfoType) * 8;
+      return static_cast<InfoType>((hash.mHash * golden) >> shift);
+   }
+
    /// Get a key reference if THIS is typed, otherwise get a block            
    ///   @attention assumes index is in container's limits                    
    ///   @attention assumes K is similar to the contained key type            
@@ -7,77 +7,75 @@
 ///                                                                           
 #pragma once
 #include "../BlockMap.hpp"
+#include "../LocalBlock.hpp"
 #include "../../blocks/Block/Block-Insert.inl"
 #include "../../blocks/Block/Block-Construct.inl"
+#include "../../Vectorize.hpp"
 
 
 namespace Langulus::Anyness
 {
 
-   /// Wrap the argument into a handle with key's type                        
+   /// Wrap the argument into a handle with key's type, or into a local       
+   /// block with the contained key type, if map is type-erased               
    ///   @attention if key is a type-erased handle or void*, we assume that   
    ///      the pointer always points to a valid instance of the current      
    ///      key type                                                          
    ///   @attention make sure this isn't used like:                           
    ///      CreateKeyHandle(GetKeyHandle()) when map is type-erased           
    ///   @param key - the key to wrap, with or without intent                 
-   ///   @return the handle object                                            
+   ///   @return the handle object, or the local block                        
    template<CT::Map THIS>
    auto BlockMap::CreateKeyHandle(auto&& key) {
       using S = IntentOf<decltype(key)>;
       using T = TypeOf<S>;
 
-      if constexpr (CT::Typed<THIS>) {
-         using K = Conditional<CT::Typed<THIS>, typename THIS::Key, TypeOf<T>>;
-         return HandleLocal<K> {S::Nest(key)};
-      }
+      if constexpr (CT::Typed<THIS>)
+         return HandleLocal<typename THIS::Key> {S::Nest(key)};
       else {
-         // Make sure that value is always inserted, and never absorbed 
-         auto result = Many::Wrap(S::Nest(key));
-         // And make sure that type is set to the contained value type  
-         result.mType = mKeys.mType;
-         return result;
-
-         /*auto result = Many::FromMeta(mKeys.mType);
-         result.AllocateFresh(result.RequestSize(1));
-         result.CreateWithIntent(S::Nest(key));
-         ++result.mCount;
-         return result;*/
+         // Make sure that key is always inserted, and never absorbed   
+         // The block has the contained key type                        
+         using K = Decvq<Conditional<CT::Handle<T>, TypeOf<T>, T>>;
+         return LocalBlock<K> {mKeys.mType, S::Nest(key)};
       }
    }
 
-   /// Wrap the argument into a handle with value's type                      
+   /// Wrap the argument into a handle with value's type, or into a local     
+   /// block with the contained value type, if map is type-erased             
    ///   @attention if value is a type-erased handle or void*, we assume that 
    ///      the pointer always points to a valid instance of the current      
    ///      value type                                                        
    ///   @attention make sure this isn't used like:                           
    ///      CreateValHandle(GetValHandle()) when map is type-erased           
    ///   @param val - the value to wrap, with or without intent               
-   ///   @return the handle object                                            
+   ///   @return the handle object, or the local block                        
    template<CT::Map THIS>
    auto BlockMap::CreateValHandle(auto&& val) {
       using S = IntentOf<decltype(val)>;
       using T = TypeOf<S>;
 
-      if constexpr (CT::Typed<THIS>) {
-         using V = Conditional<CT::Typed<THIS>, typename THIS::Value, TypeOf<T>>;
-         return HandleLocal<V> {S::Nest(val)};
-      }
+      if constexpr (CT::Typed<THIS>)
+         return HandleLocal<typename THIS::Value> {S::Nest(val)};
       else {
          // Make sure that value is always inserted, and never absorbed 
-         auto result = Many::Wrap(S::Nest(val));
-         // And make sure that type is set to the contained value type  
-         result.mType = mValues.mType;
-         return result;
-
-         /*auto result = Many::FromMeta(mValues.mType);
-         result.AllocateFresh(result.RequestSize(1));
-         result.CreateWithIntent(S::Nest(val));
-         ++result.mCount;
-         return result;*/
+         // The block has the contained value type                      
+         using V = Decvq<Conditional<CT::Handle<T>, TypeOf<T>, T>>;
+         return LocalBlock<V> {mValues.mType, S::Nest(val)};
       }
    }
 
+   /// Get what is swapped with the contained keys or values while inserting  
+   ///   @param holder - the result of CreateKeyHandle or CreateValHandle     
+   ///   @return the handle itself if map is typed, or the block inside the   
+   ///      local block otherwise                                             
+   template<CT::Map THIS> LANGULUS(INLINED)
+   auto& BlockMap::GetSwapper(auto& holder) noexcept {
+      if constexpr (CT::Typed<THIS>)
+         return holder;
+      else
+         return holder.GetBlock();
+   }
+
    /// Insert a pair, or an array of pairs                                    
    ///   @param item - the argument to unfold and insert, can have intent     
    ///   @return the number of inserted elements after unfolding              
@@ -207,10 +205,14 @@ namespace Langulus::Anyness
       return 1;
    }
    
-   /// Manually insert type-rased pair, with or without intent                
-   ///   @param key - the key to insert                                       
-   ///   @param val - the value to insert                                     
-   ///   @return 1 if pair was inserted or value was overwritten              
+   /// Manually insert type-erased pairs, with or without intent              
+   /// Memory is reserved only once, and pairs are inserted in batches - all  
+   /// keys in a batch are hashed in one pass, and the buckets are prefetched 
+   /// a couple of pairs ahead of placement, hiding most cache misses         
+   ///   @attention only the overlapping elements will be inserted            
+   ///   @param key - the keys to insert                                      
+   ///   @param val - the values to insert                                    
+   ///   @return the number of inserted pairs or overwritten values           
    template<CT::Map THIS, class T1, class T2>
    requires CT::Block<Deint<T1>, Deint<T2>> LANGULUS(INLINED)
    Count BlockMap::InsertBlock(T1&& key, T2&& val) {
@@ -235,25 +237,45 @@ namespace Langulus::Anyness
       );
 
       Reserve<THIS>(GetCount() + count);
+      const auto mask = GetReserved() - 1;
+      Offset buckets[Inner::InsertBatchSize];
 
-      for (Offset i = 0; i < count; ++i) {
-         if constexpr (not CT::Typed<KB> or not CT::Typed<VB>) {
-            // Type-erased insertion                                    
-            auto keyBlock = DeintCast(key).GetElement(i);
-            InsertBlockInner<THIS, true>(
-               GetBucketUnknown(GetReserved() - 1, keyBlock),
-               SK::Nest(keyBlock),
-               SV::Nest(DeintCast(val).GetElement(i))
-            );
+      for (Offset batch = 0; batch < count; batch += Inner::InsertBatchSize) {
+         const auto batchCount = ::std::min(count - batch, Inner::InsertBatchSize);
+
+         // Hash all keys in the batch in a tight loop, and start       
+         // loading the buckets of the first pairs right away           
+         for (Offset i = 0; i < batchCount; ++i) {
+            if constexpr (not CT::Typed<KB> or not CT::Typed<VB>)
+               buckets[i] = GetBucketUnknown(mask, DeintCast(key).GetElement(batch + i));
+            else
+               buckets[i] = GetBucket(mask, DeintCast(key)[batch + i]);
+
+            if (i < Inner::PrefetchDistance)
+               PrefetchBucket<THIS>(buckets[i]);
          }
-         else {
-            // Static type insertion                                    
-            auto& keyRef = DeintCast(key)[i];
-            InsertInner<THIS, true>(
-               GetBucket(GetReserved() - 1, keyRef),
-               SK::Nest(keyRef),
-               SV::Nest(DeintCast(val)[i])
-            );
+
+         // Place the pairs, while loading buckets of upcoming ones     
+         for (Offset i = 0; i < batchCount; ++i) {
+            if (i + Inner::PrefetchDistance < batchCount)
+               PrefetchBucket<THIS>(buckets[i + Inner::PrefetchDistance]);
+
+            if constexpr (not CT::Typed<KB> or not CT::Typed<VB>) {
+               // Type-erased insertion                                 
+               auto keyBlock = DeintCast(key).GetElement(batch + i);
+               InsertBlockInner<THIS, true>(buckets[i],
+                  SK::Nest(keyBlock),
+                  SV::Nest(DeintCast(val).GetElement(batch + i))
+               );
+            }
+            else {
+               // Static type insertion                                 
+               auto& keyRef = DeintCast(key)[batch + i];
+               InsertInner<THIS, true>(buckets[i],
+                  SK::Nest(keyRef),
+                  SV::Nest(DeintCast(val)[batch + i])
+               );
+            }
          }
       }
 
@@ -278,6 +300,8 @@ namespace Langulus::Anyness
    ///         [padding for alignment]                                        
    ///               [info for each bucket]                                   
    ///                     [one sentinel byte for terminating loops]          
+   ///                           [fingerprint for each bucket, if enabled]    
+   ///                                 [insertion order links, if ordered]    
    ///   @attention assumes key type has been set                             
    ///   @param request - number of keys to allocate                          
    ///   @param infoStart - [out] the offset at which info bytes start        
@@ -301,7 +325,7 @@ namespace Langulus::Anyness
       }
 
       infoStart = keymemory + Alignment - (keymemory % Alignment);
-      return infoStart + request + 1;
+      return infoStart + RequestInfoSize<THIS>(request);
    }
 
    /// Request a new size of value container                                  
@@ -316,81 +340,120 @@ namespace Langulus::Anyness
       return valueByteSize;
    }
 
-   ///                                                                        
+   /// Reinsert all pairs that remained in place after a reallocation         
+   /// Pending pairs still reside at their old index, while mInfo marks only  
+   /// pairs that were already reinserted. Robin-hood order is maintained     
+   /// throughout, so that lookups can terminate early afterwards             
+   ///   @param pending - marks the pairs that are not yet reinserted         
+   ///   @param oldCount - the number of slots before the reallocation        
    template<CT::Map THIS>
-   void BlockMap::RehashInner(const Count hashmask, const Offset current, Offset& moveTo, auto& key, auto& val) {
-      Offset attempt = 0;
-      Offset wrapped = moveTo + attempt >= GetReserved()
-         ? (moveTo + attempt) - GetReserved()
-         : moveTo + attempt;
-
-      while (mInfo[wrapped]) {
-         if (wrapped == current)
-            break; // Don't swap with self                              
-
-         // While there's something on the rehashed slot - swap         
-         // with it and continue swapping                               
-         auto nextKey = GetKeyHandle<THIS>(wrapped);
-         if constexpr (CT::TypedMap<THIS>) {
-            LANGULUS_ASSUME(DevAssumes, key.Get() != nextKey.Get(),
-               "Duplicated key - are map keys interfaced as static and change outside the map?"
-               " You should clone them when inserting!"
-            );
-         }
-         else {
-            LANGULUS_ASSUME(DevAssumes, key != nextKey,
-               "Duplicated key - are map keys interfaced as static and change outside the map?"
-               " You should clone them when inserting!"
-            );
-         }
-
-         nextKey.Swap(key);
-         GetValHandle<THIS>(wrapped).Swap(val);
-         mInfo[wrapped] = attempt + 1;
+   void BlockMap::RehashInner(InfoType* pending, const Count oldCount) {
+      const auto hashmask = GetReserved() - 1;
+      const auto prints = GetFingerprints();
 
-         // Where does the next element want to go?                     
-         Offset moveTo2 = 0;
+      // Where does a pair want to move after a rehash?                 
+      const auto hashOf = [](const auto& key) {
          if constexpr (CT::TypedMap<THIS>)
-            moveTo2 = GetBucket(hashmask, key.Get());
+            return HashOf(key.Get());
          else
-            moveTo2 = GetBucketUnknown(hashmask, key);
-
-         // Does it want to return here again?                          
-         // If so, continuously insert next to it                       
-         if ((moveTo2 >= moveTo and moveTo2 <= moveTo + attempt)
-         or (moveTo2 + GetReserved() >= moveTo
-            and moveTo2 + GetReserved() <= moveTo + attempt)) {
-            ++attempt;
-
-            wrapped = moveTo + attempt >= GetReserved()
-               ? (moveTo + attempt) - GetReserved()
-               : moveTo + attempt;
-
-            if (attempt == AllowedMisses) {
-               // Attempts go beyond the allowed count - the map        
-               // has to be widened further                             
+            return key.GetHash();
+      };
+
+      // Insert a pair that was taken out of its slot. Probing over a   
+      // slot that still holds a pending pair takes its place, and the  
+      // displaced pair is carried to its own bucket instead            
+      const auto reinsert = [&](auto& key, auto& val, Hash hash) {
+         Offset index = hash.mHash & hashmask;
+         InfoType print = GetFingerprint(hash);
+         InfoType attempts = 1;
+         while (true) {
+            if (not mInfo[index]) {
+               if (index >= oldCount or not pending[index]) {
+                  // Empty slot reached, so put the pair there          
+                  GetKeyHandle<THIS>(index).CreateWithIntent(Abandon(key));
+                  GetValHandle<THIS>(index).CreateWithIntent(Abandon(val));
+                  mInfo[index] = attempts;
+                  if constexpr (Fingerprints)
+                     prints[index] = print;
+                  return;
+               }
+
+               // Slot holds a pair that wasn't reinserted yet          
+               GetKeyHandle<THIS>(index).Swap(key);
+               GetValHandle<THIS>(index).Swap(val);
+               pending[index] = 0;
+               mInfo[index] = attempts;
+               if constexpr (Fingerprints)
+                  prints[index] = print;
+
+               hash = hashOf(key);
+               index = hash.mHash & hashmask;
+               print = GetFingerprint(hash);
+               attempts = 1;
+               continue;
+            }
+
+            if (attempts > mInfo[index]) {
+               // The pair we're carrying is closer to bucket, so swap  
+               GetKeyHandle<THIS>(index).Swap(key);
+               GetValHandle<THIS>(index).Swap(val);
+               ::std::swap(attempts, mInfo[index]);
+               if constexpr (Fingerprints)
+                  ::std::swap(print, prints[index]);
+            }
+
+            ++attempts;
+
+            if (attempts == AllowedMisses) {
+               // Attempts go beyond the allowed count - the map has to 
+               // be widened further                                    
                throw Except::Overflow();
             }
+
+            // Wrap around and start from the beginning if we have to   
+            index = (index + 1) & hashmask;
          }
-         else {
-            moveTo = moveTo2;
-            attempt = 0;
-            wrapped = moveTo;
+      };
+
+      for (Offset i = 0; i < oldCount; ++i) {
+         if (not pending[i])
+            continue;
+         pending[i] = 0;
+
+         // If it's the same position then we just move on, just make   
+         // sure that info has been set to 1                            
+         auto key = GetKeyHandle<THIS>(i);
+         const auto hash = hashOf(key);
+         if ((hash.mHash & hashmask) == i) {
+            mInfo[i] = 1;
+            if constexpr (Fingerprints)
+               prints[i] = GetFingerprint(hash);
+            continue;
          }
-      }
 
-      if (wrapped != current) {
-         // This is reached when an empty desired slot was found        
-         GetKeyHandle<THIS>(wrapped).CreateWithIntent(Abandon(key));
-         key.FreeInner();
+         // Otherwise take the pair out of its slot, and reinsert it    
+         auto val = GetValHandle<THIS>(i);
+         if constexpr (CT::TypedMap<THIS>) {
+            HandleLocal<typename THIS::Key>   keyswap {Abandon(key)};
+            HandleLocal<typename THIS::Value> valswap {Abandon(val)};
+            key.FreeInner();
+            val.FreeInner();
+            reinsert(keyswap, valswap, hash);
+         }
+         else {
+            Block<> keyswap {DataState {}, mKeys.mType, 1};
+            keyswap.AllocateFresh(keyswap.RequestSize(1));
+            keyswap.RelocateFrom(key);
 
-         GetValHandle<THIS>(wrapped).CreateWithIntent(Abandon(val));
-         val.FreeInner();
+            Block<> valswap {DataState {}, mValues.mType, 1};
+            valswap.AllocateFresh(valswap.RequestSize(1));
+            valswap.RelocateFrom(val);
 
-         mInfo[current] = 0;
+            reinsert(keyswap, valswap, hash);
+            keyswap.Free();
+            valswap.Free();
+         }
       }
-
-      mInfo[wrapped] = attempt + 1;
    }
 
    /// Rehashes and reinserts each pair in the same block                     
@@ -423,38 +486,12 @@ namespace Langulus::Anyness
             oldCount
          );
       };
-            
-      auto info = mInfo;
-      const auto infoend = info + oldCount;
-      const auto hashmask = GetReserved() - 1;
 
-      while (info != infoend) {
-         if (*info) {
-            // Use the 'current' slot as a swapper                      
-            const Offset current = info - mInfo;
-            auto key = GetKeyHandle<THIS>(current);
-
-            // Where does the pair want to move after a rehash?         
-            Offset moveTo = 0;
-            if constexpr (CT::TypedMap<THIS>)
-               moveTo = GetBucket(hashmask, key.Get());
-            else
-               moveTo = GetBucketUnknown(hashmask, key);
-
-            // If it's the same position then we just move on, just     
-            // make sure that info has been set to 1                    
-            if (moveTo == current) {
-               mInfo[moveTo] = 1;
-               ++info;
-               continue;
-            }
-
-            auto val = GetValHandle<THIS>(current);
-            RehashInner<THIS>(hashmask, current, moveTo, key, val);
-         }
-
-         ++info;
-      }
+      // Move the info array to a temporary, that marks which pairs     
+      // are pending, and rebuild the one in the map                    
+      TMany<InfoType> pending {Copy(MakeBlock(mInfo, oldCount))};
+      ZeroMemory(mInfo, oldCount);
+      RehashInner<THIS>(pending.GetRaw(), oldCount);
    }
    
    /// Rehashes and reinserts each key in the same block, and moves all       
@@ -481,43 +518,29 @@ namespace Langulus::Anyness
       // Reusing keys means reusing info, but we still have to mark     
       // which values have been initialized. So we move the info array  
       // to a temporary, and rebuild the one in the map.                
-      TMany<InfoType> temp_info {Copy(MakeBlock(old.mInfo, old.GetReserved()))};
+      TMany<InfoType> pending {Copy(MakeBlock(old.mInfo, old.GetReserved()))};
       ZeroMemory(mInfo, GetReserved());
 
-      auto info = temp_info.GetRaw();
-      const auto infoend = info + old.GetReserved();
-      const auto hashmask = GetReserved() - 1;
-
-      while (info != infoend) {
-         if (*info) {
-            const Offset current = info - temp_info.GetRaw();
-            auto key = GetKeyHandle<THIS>(current);
-            auto val = GetValHandle<THIS>(current);
-            auto oldVal = old.GetValHandle<THIS>(current);
-            val.CreateWithIntent(Abandon(oldVal));
-            oldVal.FreeInner();
-
-            // Where does the pair want to move after a rehash?         
-            Offset moveTo = 0;
-            if constexpr (CT::TypedMap<THIS>)
-               moveTo = GetBucket(hashmask, key.Get());
-            else
-               moveTo = GetBucketUnknown(hashmask, key);
-
-            // If it's the same position, then just initialize value,   
-            // and make sure that info has been reset to 1              
-            if (moveTo == current) {
-               mInfo[moveTo] = 1;
-               ++info;
+      // Move all values in at their old indices, before rehashing      
+      const auto info = pending.GetRaw();
+      if (not IsValueSparse<THIS>() and GetVals<THIS>().IsRelocatable()) {
+         // Trivially relocatable values are copied all at once - the   
+         // unused slots in between are copied, too, but never read     
+         CopyMemory(mValues.mRaw, old.mValues.mRaw,
+            old.GetReserved() * mValues.GetStride());
+      }
+      else {
+         for (Offset i = 0; i < old.GetReserved(); ++i) {
+            if (not info[i])
                continue;
-            }
 
-            RehashInner<THIS>(hashmask, current, moveTo, key, val);
+            auto oldVal = old.GetValHandle<THIS>(i);
+            GetValHandle<THIS>(i).RelocateFrom(oldVal);
          }
-
-         ++info;
       }
 
+      RehashInner<THIS>(info, old.GetReserved());
+
       // We can discard the old values                                  
       LANGULUS_ASSUME(DevAssumes, old.mValues.mEntry->GetUses() == 1,
          "Deallocating old values data that is still in use");
@@ -545,99 +568,81 @@ namespace Langulus::Anyness
          );
       };
 
-      // Not reusing keys means not reusing info                        
+      // Not reusing keys means not reusing info, but the old info      
+      // still marks which pairs are pending                            
       ZeroMemory(mInfo, GetReserved());
 
-      auto info = old.GetInfo();
-      const auto infoend = old.GetInfoEnd();
-      const auto hashmask = GetReserved() - 1;
-
-      while (info != infoend) {
-         if (*info) {
-            const Offset current = info - old.GetInfo();
-            auto key = GetKeyHandle<THIS>(current);
-            auto val = GetValHandle<THIS>(current);
-            auto oldKey = old.GetKeyHandle<THIS>(current);
-            key.CreateWithIntent(Abandon(oldKey));
-            oldKey.FreeInner();
-
-            // Where does the pair want to move after a rehash?         
-            Offset moveTo = 0;
-            if constexpr (CT::TypedMap<THIS>)
-               moveTo = GetBucket(hashmask, key.Get());
-            else
-               moveTo = GetBucketUnknown(hashmask, key);
-
-            // If it's the same position, then just initialize key, and 
-            // make sure that info has been set to 1                    
-            if (moveTo == current) {
-               mInfo[moveTo] = 1;
-               ++info;
+      // Move all keys in at their old indices, before rehashing        
+      if (not IsKeySparse<THIS>() and GetKeys<THIS>().IsRelocatable()) {
+         // Trivially relocatable keys are copied all at once - the     
+         // unused slots in between are copied, too, but never read     
+         CopyMemory(mKeys.mRaw, old.mKeys.mRaw,
+            old.GetReserved() * mKeys.GetStride());
+      }
+      else {
+         for (Offset i = 0; i < old.GetReserved(); ++i) {
+            if (not old.mInfo[i])
                continue;
-            }
 
-            RehashInner<THIS>(hashmask, current, moveTo, key, val);
+            auto oldKey = old.GetKeyHandle<THIS>(i);
+            GetKeyHandle<THIS>(i).RelocateFrom(oldKey);
          }
-
-         ++info;
       }
 
+      RehashInner<THIS>(old.mInfo, old.GetReserved());
+
       // We can discard the old keys                                    
       LANGULUS_ASSUME(DevAssumes, old.mKeys.mEntry->GetUses() == 1,
          "Deallocating old keys data that is still in use");
       Allocator::Deallocate(const_cast<Allocation*>(old.mKeys.mEntry));
    }
-   
-   /// Shift elements left where possible                                     
-   /// Repeat this couple of times until no more moves are possible           
+
+   /// Fill the gaps left after removing pairs, by shifting the following     
+   /// pairs back towards their buckets, one slot at a time                   
+   /// This is equivalent to a backward-shift deletion for each gap, so the   
+   /// robin-hood order of pairs is preserved                                 
    template<CT::Map THIS>
    void BlockMap::ShiftPairs() {
+      const auto hashmask = GetReserved() - 1;
+      const auto prints = GetFingerprints();
       int moves_performed;
       do {
          moves_performed = 0;
-         auto oldInfo = mInfo;
-         const auto newInfoEnd = GetInfoEnd();
-         while (oldInfo != newInfoEnd) {
-            if (*oldInfo > 1) {
-               // Entry can be moved by *oldInfo - 1 cells to the left  
-               const Offset oldIndex = oldInfo - GetInfo();
-
-               // Will loop around if it goes beyond mKeys.mReserved    
-               Offset to = mKeys.mReserved + oldIndex - *oldInfo + 1;
-               if (to >= mKeys.mReserved)
-                  to -= mKeys.mReserved;
-
-               InfoType attempt = 1;
-               while (mInfo[to] and attempt < *oldInfo) {
-                  // Might loop around                                  
-                  ++to;
-                  if (to >= mKeys.mReserved)
-                     to -= mKeys.mReserved;
-                  ++attempt;
-               }
+         for (Offset to = 0; to < GetReserved(); ++to) {
+            // Will loop around if it goes beyond mKeys.mReserved       
+            const Offset from = (to + 1) & hashmask;
+            if (mInfo[to] or mInfo[from] <= 1)
+               continue;
 
-               if (not mInfo[to] and attempt < *oldInfo) {
-                  // Empty spot found, so move pair there               
-                  auto key = GetKeyHandle<THIS>(oldIndex);
-                  GetKeyHandle<THIS>(to).CreateWithIntent(Abandon(key));
-                  key.FreeInner();
+            // Empty spot found before a displaced pair, so move it     
+            auto key = GetKeyHandle<THIS>(from);
+            GetKeyHandle<THIS>(to).RelocateFrom(key);
 
-                  auto val = GetValHandle<THIS>(oldIndex);
-                  GetValHandle<THIS>(to).CreateWithIntent(Abandon(val));
-                  val.FreeInner();
+            auto val = GetValHandle<THIS>(from);
+            GetValHandle<THIS>(to).RelocateFrom(val);
 
-                  mInfo[to] = attempt;
-                  *oldInfo = 0;
-                  ++moves_performed;
-               }
-            }
-
-            ++oldInfo;
+            mInfo[to] = mInfo[from] - 1;
+            mInfo[from] = 0;
+            if constexpr (Fingerprints)
+               prints[to] = prints[from];
+            OrderMove<THIS>(from, to);
+            ++moves_performed;
          }
-
       } while (moves_performed);
    }
-   
+
+   /// Hint the CPU to start loading the info byte and key of a bucket, so    
+   /// that it is likely cached by the time a pair is placed there            
+   ///   @param index - the bucket index                                      
+   template<CT::Map THIS> LANGULUS(INLINED)
+   void BlockMap::PrefetchBucket(const Offset index) const noexcept {
+      Inner::Prefetch(mInfo + index);
+      if constexpr (CT::Typed<THIS>)
+         Inner::Prefetch(GetKeys<THIS>().GetRaw() + index);
+      else
+         Inner::Prefetch(mKeys.mRaw + index * mKeys.GetStride().mSize);
+   }
+
    /// Inner insertion function                                               
    ///   @attention assumes that keys and values are constructible with the   
    ///      provided arguments                                                
@@ -648,22 +653,53 @@ namespace Langulus::Anyness
    ///   @return the offset at which pair was inserted                        
    template<CT::Map THIS, bool CHECK_FOR_MATCH>
    Offset BlockMap::InsertInner(const Offset start, auto&& key, auto&& val) {
-      BranchOut<THIS>();
       using SK = IntentOf<decltype(key)>;
       using SV = IntentOf<decltype(val)>;
-      auto keyswapper = CreateKeyHandle<THIS>(SK::Nest(key));
-      auto valswapper = CreateValHandle<THIS>(SV::Nest(val));
+
+      if constexpr (not CT::Typed<THIS>) {
+         using K = Decvq<TypeOf<SK>>;
+         using V = Decvq<TypeOf<SV>>;
+
+         if constexpr (CT::LocalHandleable<K, V>) {
+            // Key and value types are known at compile-time, and if    
+            // they're exactly the contained ones, insert as if the map 
+            // was statically typed. This avoids going through the      
+            // reflected constructors and assigners on each swap        
+            if (mKeys.template IsExact<K>() and mValues.template IsExact<V>()) {
+               using TYPED = TMap<K, V, THIS::Ordered, THIS::Probing>;
+               return InsertInner<TYPED, CHECK_FOR_MATCH>(
+                  start, SK::Nest(key), SV::Nest(val));
+            }
+         }
+      }
+
+      BranchOut<THIS>();
+      auto keyholder = CreateKeyHandle<THIS>(SK::Nest(key));
+      auto valholder = CreateValHandle<THIS>(SV::Nest(val));
+      auto& keyswapper = GetSwapper<THIS>(keyholder);
+      auto& valswapper = GetSwapper<THIS>(valholder);
+
+      // Fingerprint the key, if enabled - this hashes it again         
+      InfoType print {};
+      if constexpr (Fingerprints) {
+         if constexpr (CT::Typed<THIS>)
+            print = GetFingerprint(HashOf(keyswapper.Get()));
+         else
+            print = GetFingerprint(keyswapper.GetHash());
+      }
 
       // Get the starting index based on the key hash                   
       auto psl = GetInfo() + start;
       const auto pslEnd = GetInfoEnd();
+      const auto prints = GetFingerprints();
       InfoType attempts = 1;
       Offset insertedAt = mKeys.mReserved;
       while (*psl) {
          const auto index = psl - GetInfo();
 
          if constexpr (CHECK_FOR_MATCH) {
-            if (keyswapper.Compare(GetKeyRef<THIS>(index))) {
+            if ((not Fingerprints or prints[index] == print)
+            and keyswapper.Compare(GetKeyRef<THIS>(index))) {
                // Neat, the key already exists - just set value and go  
                GetValHandle<THIS>(index).AssignWithIntent(Abandon(valswapper));
                return index;
@@ -676,6 +712,9 @@ namespace Langulus::Anyness
             GetValHandle<THIS>(index).Swap(valswapper);
 
             ::std::swap(attempts, *psl);
+            if constexpr (Fingerprints)
+               ::std::swap(print, prints[index]);
+            OrderSwap<THIS>(index, insertedAt == mKeys.mReserved);
             if (insertedAt == mKeys.mReserved)
                insertedAt = index;
          }
@@ -702,11 +741,14 @@ namespace Langulus::Anyness
       const auto index = psl - GetInfo();
       GetKeyHandle<THIS>(index).CreateWithIntent(Abandon(keyswapper));
       GetValHandle<THIS>(index).CreateWithIntent(Abandon(valswapper));
+      OrderPlace<THIS>(index, insertedAt != mKeys.mReserved);
 
       if (insertedAt == mKeys.mReserved)
          insertedAt = index;
 
       *psl = attempts;
+      if constexpr (Fingerprints)
+         prints[index] = print;
       ++mKeys.mCount;
       return insertedAt;
    }
@@ -722,16 +764,23 @@ namespace Langulus::Anyness
    Offset BlockMap::InsertBlockInner(const Offset start, S1<T>&& key, S2<T>&& val) {
       BranchOut<THIS>();
 
+      // Fingerprint the key, if enabled - this hashes it again         
+      InfoType print {};
+      if constexpr (Fingerprints)
+         print = GetFingerprint(key->GetHash());
+
       // Get the starting index based on the key hash                   
       auto psl = GetInfo() + start;
       const auto pslEnd = GetInfoEnd();
+      const auto prints = GetFingerprints();
       InfoType attempts = 1;
       Offset insertedAt = mKeys.mReserved;
       while (*psl) {
          const auto index = psl - GetInfo();
          if constexpr (CHECK_FOR_MATCH) {
             const auto candidate = GetKeyHandle<THIS>(index);
-            if (candidate == *key) {
+            if ((not Fingerprints or prints[index] == print)
+            and candidate == *key) {
                // Neat, the key already exists - just set value and go  
                GetValHandle<THIS>(index).AssignWithIntent(val.Forward());
 
@@ -750,6 +799,9 @@ namespace Langulus::Anyness
             GetValHandle<THIS>(index).Swap(val.Forward());
 
             ::std::swap(attempts, *psl);
+            if constexpr (Fingerprints)
+               ::std::swap(print, prints[index]);
+            OrderSwap<THIS>(index, insertedAt == mKeys.mReserved);
             if (insertedAt == mKeys.mReserved)
                insertedAt = index;
          }
@@ -770,6 +822,7 @@ namespace Langulus::Anyness
       const auto index = psl - GetInfo();
       GetKeyHandle<THIS>(index).CreateWithIntent(key.Forward());
       GetValHandle<THIS>(index).CreateWithIntent(val.Forward());
+      OrderPlace<THIS>(index, insertedAt != mKeys.mReserved);
 
       if (insertedAt == mKeys.mReserved)
          insertedAt = index;
@@ -785,6 +838,8 @@ namespace Langulus::Anyness
       }
 
       *psl = attempts;
+      if constexpr (Fingerprints)
+         prints[index] = print;
       ++mKeys.mCount;
       return insertedAt;
    }
@@ -40,31 +40,16 @@ namespace Langulus::Anyness
       }
 
       // Prepare for the loop                                           
-      auto key = mKeys.GetElement(REVERSE ? -1 : 0);
-      auto val = mValues.GetElement(REVERSE ? -1 : 0);
-      auto inf = REVERSE ? mInfo + GetReserved() - 1 : mInfo;
-      const auto infEnd = REVERSE ? mInfo - 1 : mInfo + GetReserved();
-      const auto next = [&inf,&key,&val] {
-         if constexpr (REVERSE) {
-            --inf;
-            --key;
-            --val;
-         }
-         else {
-            ++inf;
-            ++key;
-            ++val;
-         }
+      auto index = GetNextIndex<THIS, REVERSE>(GetReserved());
+      const auto next = [this, &index] {
+         index = GetNextIndex<THIS, REVERSE>(index);
       };
 
       Count executions = 0;
-      while (inf != infEnd) {
-         if (not *inf) {
-            next();
-            continue;
-         }
-         
+      while (index != GetReserved()) {
          // Execute function for each valid pair                        
+         auto key = GetKeys<THIS>().GetElement(index);
+         auto val = GetVals<THIS>().GetElement(index);
          ++executions;
 
          if constexpr (CT::Void<R>) {
@@ -120,10 +105,8 @@ namespace Langulus::Anyness
                case LoopControl::Discard:
                   if constexpr (CT::Mutable<THIS>) {
                      // Discard is allowed only if THIS is mutable      
-                     const_cast<BlockMap*>(this)
-                        ->template RemoveInner<THIS>(inf - mInfo);
-                     if constexpr (REVERSE)
-                        next();
+                     index = const_cast<BlockMap*>(this)
+                        ->template DiscardInner<THIS, REVERSE>(index);
                   }
                   else {
                      // ...otherwise it acts like a Loop::Continue      
@@ -158,28 +141,21 @@ namespace Langulus::Anyness
       LANGULUS_ASSUME(DevAssumes, (part.template CastsTo<A, true>()),
          "Map is not typed properly");
        
-      auto inf = REVERSE ? mInfo + GetReserved() - 1 : mInfo;
-      const auto infEnd = REVERSE ? mInfo - 1 : mInfo + GetReserved();
-      const auto next = [&inf] {
-         if constexpr (REVERSE)  --inf;
-         else                    ++inf;
+      auto index = GetNextIndex<THIS, REVERSE>(GetReserved());
+      const auto next = [this, &index] {
+         index = GetNextIndex<THIS, REVERSE>(index);
       };
 
-      while (inf != infEnd) {
-         if (not *inf) {
-            next();
-            continue;
-         }
-
+      while (index != GetReserved()) {
          ++counter;
 
          if constexpr (CT::Bool<R>) {
-            if (not call(partLocal.template Get<A>(inf - mInfo)))
+            if (not call(partLocal.template Get<A>(index)))
                return Loop::Break;
             next();
          }
          else if constexpr (CT::Exact<R, LoopControl>) {
-            const R loop = call(partLocal.template Get<A>(inf - mInfo));
+            const R loop = call(partLocal.template Get<A>(index));
 
             switch (loop.mControl) {
             case LoopControl::Break:
@@ -193,10 +169,8 @@ namespace Langulus::Anyness
             case LoopControl::Discard:
                if constexpr (CT::Mutable<THIS>) {
                   // Discard is allowed only if THIS is mutable         
-                  const_cast<BlockMap*>(this)
-                     ->template RemoveInner<THIS>(inf - mInfo);
-                  if constexpr (REVERSE)
-                     next();
+                  index = const_cast<BlockMap*>(this)
+                     ->template DiscardInner<THIS, REVERSE>(index);
                }
                else {
                   // ...otherwise it acts like a Loop::Continue         
@@ -206,7 +180,7 @@ namespace Langulus::Anyness
             }
          }
          else {
-            call(partLocal.template Get<A>(inf - mInfo));
+            call(partLocal.template Get<A>(index));
             next();
          }
       }
@@ -233,28 +207,21 @@ namespace Langulus::Anyness
       static_assert(CT::Constant<A> or CT::Mutable<THIS>,
          "Non constant iterator for constant memory block");
 
-      auto info = REVERSE ? mInfo + GetReserved() - 1 : mInfo;
-      const auto infoEnd = REVERSE ? mInfo - 1 : mInfo + GetReserved();
-      const auto next = [&info] {
-         if constexpr (REVERSE)  --info;
-         else                    ++info;
+      auto index = GetNextIndex<THIS, REVERSE>(GetReserved());
+      const auto next = [this, &index] {
+         index = GetNextIndex<THIS, REVERSE>(index);
       };
 
-      while (info != infoEnd) {
-         if (not *info) {
-            next();
-            continue;
-         }
-
+      while (index != GetReserved()) {
          ++counter;
 
          if constexpr (CT::Bool<R>) {
-            if (not call(part.GetElement(info - mInfo)))
+            if (not call(part.GetElement(index)))
                return Loop::Break;
             next();
          }
          else if constexpr (CT::Exact<R, LoopControl>) {
-            const R loop = call(part.GetElement(info - mInfo));
+            const R loop = call(part.GetElement(index));
 
             switch (loop.mControl) {
             case LoopControl::Break:
@@ -268,10 +235,8 @@ namespace Langulus::Anyness
             case LoopControl::Discard:
                if constexpr (CT::Mutable<THIS>) {
                   // Discard is allowed only if THIS is mutable         
-                  const_cast<BlockMap*>(this)
-                     ->template RemoveInner<THIS>(info - mInfo);
-                  if constexpr (REVERSE)
-                     next();
+                  index = const_cast<BlockMap*>(this)
+                     ->template DiscardInner<THIS, REVERSE>(index);
                }
                else {
                   // ...otherwise it acts like a Loop::Continue         
@@ -281,7 +246,7 @@ namespace Langulus::Anyness
             }
          }
          else {
-            call(part.GetElement(info - mInfo));
+            call(part.GetElement(index));
             next();
          }
       }
@@ -443,6 +408,60 @@ namespace Langulus::Anyness
       return result;
    }
 
+   /// Get the slot of the pair that follows another one in iteration order   
+   /// Unordered maps follow the slots, while ordered maps follow the order   
+   /// in which pairs were inserted                                           
+   ///   @tparam REVERSE - whether to step backwards                          
+   ///   @param index - the slot to step from, use the reserved count to get  
+   ///                  the first pair (or the last one, if REVERSE)          
+   ///   @return the next slot, or the reserved count if there are no more    
+   template<CT::Map THIS, bool REVERSE> LANGULUS(INLINED)
+   Offset BlockMap::GetNextIndex(Offset index) const noexcept {
+      if constexpr (THIS::Ordered) {
+         if constexpr (REVERSE)  return GetOrderPrev(index);
+         else                    return GetOrderNext(index);
+      }
+      else if constexpr (REVERSE) {
+         while (index--) {
+            if (mInfo[index])
+               return index;
+         }
+         return GetReserved();
+      }
+      else {
+         // The sentinel guarantees that this loop ends                 
+         index = index == GetReserved() ? 0 : index + 1;
+         while (not mInfo[index])
+            ++index;
+         return index;
+      }
+   }
+
+   /// Remove a pair while iterating, and get the one that follows            
+   ///   @tparam REVERSE - whether iteration is backwards                     
+   ///   @param index - the slot of the pair to remove                        
+   ///   @return the slot of the next pair, or the reserved count if none     
+   template<CT::Map THIS, bool REVERSE>
+   Offset BlockMap::DiscardInner(const Offset index) {
+      if constexpr (THIS::Ordered) {
+         // The following pair might get shifted back by the removal    
+         const auto next = GetNextIndex<THIS, REVERSE>(index);
+         RemoveInner<THIS>(index);
+         return next == GetReserved() ? next : GetShiftedIndex(index, next);
+      }
+      else {
+         // Moving forward stays on the same slot, because the removal  
+         // might have shifted the next pair into it                    
+         RemoveInner<THIS>(index);
+         if constexpr (REVERSE)
+            return GetNextIndex<THIS, true>(index);
+         else if (mInfo[index])
+            return index;
+         else
+            return GetNextIndex<THIS>(index);
+      }
+   }
+
    /// Get iterator to first element                                          
    ///   @return an iterator to the first element, or end if empty            
    template<CT::Map THIS> LANGULUS(INLINED)
@@ -450,16 +469,13 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return end();
 
-      // Seek first valid info, or hit sentinel at the end              
-      auto info = GetInfo();
-      while (not *info)
-         ++info;
-
-      const auto offset = info - GetInfo();
+      // Seek first valid info, or the first inserted pair if ordered   
+      const auto offset = GetNextIndex<THIS>(GetReserved());
       return {
-         info, GetInfoEnd(),
+         GetInfo() + offset, GetInfoEnd(),
          GetRawKey<THIS>(offset),
-         GetRawVal<THIS>(offset)
+         GetRawVal<THIS>(offset),
+         GetOrderLink<THIS>(offset)
       };
    }
 
@@ -475,16 +491,14 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return end();
 
-      // Seek first valid info in reverse, until one past first is met  
-      auto info = GetInfoEnd();
-      while (info >= GetInfo() and not *--info)
-         ;
-
-      const auto offset = info - GetInfo();
+      // Seek first valid info in reverse, or the last inserted pair if 
+      // ordered                                                        
+      const auto offset = GetNextIndex<THIS, true>(GetReserved());
       return {
-         info, GetInfoEnd(),
+         GetInfo() + offset, GetInfoEnd(),
          GetRawKey<THIS>(offset),
-         GetRawVal<THIS>(offset)
+         GetRawVal<THIS>(offset),
+         GetOrderLink<THIS>(offset)
       };
    }
 
@@ -503,16 +517,19 @@ namespace Langulus::Anyness
    ///   @param sentinel - the end of info pointers                           
    ///   @param key - pointer/block to the key element                        
    ///   @param value - pointer/block to the value element                    
+   ///   @param order - the insertion order link, if map is ordered           
    template<class T> LANGULUS(INLINED)
    constexpr BlockMap::Iterator<T>::Iterator(
       const InfoType* info, 
       const InfoType* sentinel, 
-      const KA& key, const VA& value
+      const KA& key, const VA& value,
+      const OrderType* order
    ) noexcept
       : mKey {key}
       , mValue {value}
       , mInfo {info}
-      , mSentinel {sentinel} {}
+      , mSentinel {sentinel}
+      , mOrder {order} {}
 
    /// Construct from end point                                               
    template<class T> LANGULUS(INLINED)
@@ -520,22 +537,33 @@ namespace Langulus::Anyness
       : mKey {}
       , mValue {} 
       , mInfo {}
-      , mSentinel {} {}
+      , mSentinel {}
+      , mOrder {} {}
 
    /// Prefix increment operator                                              
    /// Moves pointers to the right, unless end has been reached               
+   /// Ordered maps follow the insertion order links instead, and reach the   
+   /// sentinel when the anchor is reached                                    
    ///   @return the modified iterator                                        
    template<class T> LANGULUS(INLINED)
    constexpr BlockMap::Iterator<T>& BlockMap::Iterator<T>::operator ++ () noexcept {
       if (mInfo == mSentinel)
          return *this;
 
-      // Seek next valid info, or hit sentinel at the end               
-      const auto previous = mInfo;
-      while (not *++mInfo)
-         ;
-
-      const auto offset = mInfo - previous;
+      ::std::ptrdiff_t offset;
+      if constexpr (T::Ordered) {
+         // Links are relative, so just follow them                     
+         offset = static_cast<::std::ptrdiff_t>(*mOrder);
+         mOrder += offset;
+         mInfo += offset;
+      }
+      else {
+         // Seek next valid info, or hit sentinel at the end            
+         const auto previous = mInfo;
+         while (not *++mInfo)
+            ;
+         offset = mInfo - previous;
+      }
       if constexpr (CT::Typed<T>) {
          const_cast<KA&>(mKey)   += offset;
          const_cast<VA&>(mValue) += offset;
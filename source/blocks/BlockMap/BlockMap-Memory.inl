@@ -147,53 +147,47 @@ namespace Langulus::Anyness
 
       // If reached, then both keys and values are newly allocated      
       ZeroMemory(mInfo, count);
-      if (old.IsEmpty()) {
-         // There are no old values, the previous map was empty         
-         // Just do an early return right here                          
-         return;
-      }
+      OrderReset<THIS>();
 
       // If reached, then keys or values (or both) moved                
-      // Reinsert all pairs to rehash                                   
+      // Reinsert all pairs to rehash - ordered maps reinsert them in   
+      // the order they were originally inserted, to retain it          
       mKeys.mCount = 0;
 
-      UNUSED() auto& me = reinterpret_cast<const THIS&>(*this);
-      auto key = old.GetKeyHandle<THIS>(0);
-      auto val = old.GetValHandle<THIS>(0);
       const auto hashmask = GetReserved() - 1;
-      const auto infoend = old.GetInfoEnd();
-
-      while (old.mInfo != infoend) {
-         if (*old.mInfo) {
-            if constexpr (CT::TypedMap<THIS>) {
-               InsertInner<THIS, false>(
-                  GetBucket(hashmask, key.Get()),
-                  Abandon(key), Abandon(val)
-               );
+      const auto oldEnd = old.GetReserved();
+      auto index = old.IsEmpty() ? oldEnd : old.GetNextIndex<THIS>(oldEnd);
+
+      while (index != oldEnd) {
+         auto key = old.GetKeyHandle<THIS>(index);
+         auto val = old.GetValHandle<THIS>(index);
+
+         if constexpr (CT::TypedMap<THIS>) {
+            InsertInner<THIS, false>(
+               GetBucket(hashmask, key.Get()),
+               Abandon(key), Abandon(val)
+            );
+            key.FreeInner();
+            val.FreeInner();
+         }
+         else {
+            InsertBlockInner<THIS, false>(
+               GetBucketUnknown(hashmask, key),
+               Abandon(key), Abandon(val)
+            );
+
+            if (key)
                key.FreeInner();
+            else
+               key.mCount = 1;
+
+            if (val)
                val.FreeInner();
-            }
-            else {
-               InsertBlockInner<THIS, false>(
-                  GetBucketUnknown(hashmask, key),
-                  Abandon(key), Abandon(val)
-               );
-
-               if (key)
-                  key.FreeInner();
-               else
-                  key.mCount = 1;
-
-               if (val)
-                  val.FreeInner();
-               else
-                  val.mCount = 1;
-            }
+            else
+               val.mCount = 1;
          }
 
-         ++key;
-         ++val;
-         ++old.mInfo;
+         index = old.GetNextIndex<THIS>(index);
       }
 
       // Free the old allocations                                       
@@ -207,19 +201,13 @@ namespace Langulus::Anyness
             Allocator::Deallocate(const_cast<Allocation*>(old.mKeys.mEntry));
       }
       else {
-         // Not reusing, so either deallocate, or dereference           
-         if (old.mKeys.mEntry) {
-            if (old.mKeys.mEntry->GetUses() > 1)
-               const_cast<Allocation*>(old.mKeys.mEntry)->Free();
-            else
-               Allocator::Deallocate(const_cast<Allocation*>(old.mKeys.mEntry));
-         }
-
-         if (old.mValues.mEntry) {
-            if (old.mValues.mEntry->GetUses() > 1)
-               const_cast<Allocation*>(old.mValues.mEntry)->Free();
-            else
-               Allocator::Deallocate(const_cast<Allocation*>(old.mValues.mEntry));
+         // Not reusing, so dereference, and deallocate if this turns   
+         // out to be the last reference - elements were already moved  
+         for (auto entry : {old.mKeys.mEntry, old.mValues.mEntry}) {
+            if (entry and not const_cast<Allocation*>(entry)->Free()) {
+               const_cast<Allocation*>(entry)->Keep();
+               Allocator::Deallocate(const_cast<Allocation*>(entry));
+            }
          }
       }
    }
@@ -236,10 +224,59 @@ namespace Langulus::Anyness
          return;
 
       // Allocate/Reallocate the keys and info                          
-      if (IsAllocated() and mKeys.GetUses() == 1 and mValues.GetUses() == 1)
-         AllocateData<THIS, true>(count);
-      else
-         AllocateData<THIS, false>(count);
+      // Ordered maps are always reinserted into fresh memory, because  
+      // rehashing in place doesn't retain the insertion order          
+      if constexpr (not THIS::Ordered) {
+         if (IsAllocated() and mKeys.GetUses() == 1 and mValues.GetUses() == 1) {
+            AllocateData<THIS, true>(count);
+            return;
+         }
+      }
+
+      AllocateData<THIS, false>(count);
+   }
+
+   /// Rebuild an ordered map, that was transferred from an unordered one     
+   /// The pairs are reinserted in the order they're stored in, which becomes 
+   /// their insertion order. The transferred memory is released afterwards   
+   ///   @attention assumes THIS is ordered, and map is not empty             
+   template<CT::Map THIS>
+   void BlockMap::Reorder() {
+      static_assert(THIS::Ordered, "Reordering an unordered map");
+      LANGULUS_ASSUME(DevAssumes, not IsEmpty(), "Reordering an empty map");
+
+      BlockMap old = *this;
+      AllocateFresh<THIS>(old.GetReserved());
+      ZeroMemory(mInfo, GetReserved());
+      mInfo[GetReserved()] = 1;
+      OrderReset<THIS>();
+      mKeys.mCount = 0;
+
+      // The old memory might be shared or disowned, so pairs are       
+      // always referred, and never moved                               
+      const auto hashmask = GetReserved() - 1;
+      for (Offset index = 0; index < old.GetReserved(); ++index) {
+         if (not old.mInfo[index])
+            continue;
+
+         auto key = old.GetKeyHandle<THIS>(index);
+         auto val = old.GetValHandle<THIS>(index);
+         if constexpr (CT::TypedMap<THIS>) {
+            InsertInner<THIS, false>(
+               GetBucket(hashmask, key.Get()),
+               Refer(key), Refer(val)
+            );
+         }
+         else {
+            InsertBlockInner<THIS, false>(
+               GetBucketUnknown(hashmask, key),
+               Refer(key), Refer(val)
+            );
+         }
+      }
+
+      // Dereference, or destroy the old pairs                          
+      old.Free<THIS>();
    }
    
    /// Reference memory block once                                            
@@ -279,10 +316,7 @@ namespace Langulus::Anyness
          }
          else {
             // Dereference values                                       
-            if (not IsEmpty())
-               GetVals<THIS>().template FreeInner<false>(mInfo);
-
-            const_cast<Allocation*>(mValues.mEntry)->Free();
+            GetVals<THIS>().FreeShared(mInfo);
          }
 
          mValues.mEntry = nullptr;
@@ -301,10 +335,7 @@ namespace Langulus::Anyness
          }
          else {
             // Dereference keys                                         
-            if (not IsEmpty())
-               GetKeys<THIS>().template FreeInner<false>(mInfo);
-
-            const_cast<Allocation*>(mKeys.mEntry)->Free();
+            GetKeys<THIS>().FreeShared(mInfo);
          }
 
          mKeys.mEntry = nullptr;
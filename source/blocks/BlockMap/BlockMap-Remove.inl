@@ -26,22 +26,39 @@ namespace Langulus::Anyness
       if (offset >= sentinel)
          return end();
 
-      RemoveInner<THIS>(offset--);
+      if constexpr (THIS::Ordered) {
+         // The previous pair in insertion order might get shifted      
+         auto previous = GetOrderPrev(offset);
+         RemoveInner<THIS>(offset);
+
+         if (IsEmpty())
+            return end();
+
+         if (previous == sentinel)
+            previous = GetOrderNext(sentinel);
+         else
+            previous = GetShiftedIndex(offset, previous);
+         offset = previous;
+      }
+      else {
+         RemoveInner<THIS>(offset--);
 
-      if (IsEmpty())
-         return end();
+         if (IsEmpty())
+            return end();
       
-      while (offset < sentinel and not mInfo[offset])
-         --offset;
+         while (offset < sentinel and not mInfo[offset])
+            --offset;
 
-      if (offset >= sentinel)
-         offset = 0;
+         if (offset >= sentinel)
+            offset = 0;
+      }
 
       return {
          mInfo + offset, 
-         index.mSentinel,
+         GetInfoEnd(),
          GetRawKey<THIS>(offset),
-         GetRawVal<THIS>(offset)
+         GetRawVal<THIS>(offset),
+         GetOrderLink<THIS>(offset)
       };
    }
 
@@ -175,6 +192,7 @@ namespace Langulus::Anyness
             key.FreeInner();
             val.FreeInner();
             *psl = 0;
+            OrderUnlink<THIS>(index);
             ++removed;
             --mKeys.mCount;
          }
@@ -210,20 +228,24 @@ namespace Langulus::Anyness
       ++val;
 
       *(psl++) = 0;
+      OrderUnlink<THIS>(index);
 
       // And shift backwards, until a zero or 1 is reached              
       // That way we move every entry that is far from its start        
       // closer to it. Moving is costly, unless you use pointers        
+      const auto prints = GetFingerprints();
       try_again:
       while (*psl > 1) {
          psl[-1] = (*psl) - 1;
+         const Offset i = psl - GetInfo();
+         if constexpr (Fingerprints)
+            prints[i - 1] = prints[i];
+         OrderMove<THIS>(i, i - 1);
 
-         (key--).CreateWithIntent(Abandon(key));
-         key.FreeInner();
+         (key--).RelocateFrom(key);
          ++key;
 
-         (val--).CreateWithIntent(Abandon(val));
-         val.FreeInner();
+         (val--).RelocateFrom(val);
          ++val;
 
          *(psl++) = 0;
@@ -235,16 +257,17 @@ namespace Langulus::Anyness
          const auto last = mKeys.mReserved - 1;
          psl = GetInfo();
          GetInfo()[last] = (*psl) - 1;
+         if constexpr (Fingerprints)
+            prints[last] = prints[0];
+         OrderMove<THIS>(0, last);
 
          // Shift first pair to the back                                
          key = GetKeyHandle<THIS>(0);
-         GetKeyHandle<THIS>(last).CreateWithIntent(Abandon(key));
-         key.FreeInner();
+         GetKeyHandle<THIS>(last).RelocateFrom(key);
          ++key;
 
          val = GetValHandle<THIS>(0);
-         GetValHandle<THIS>(last).CreateWithIntent(Abandon(val));
-         val.FreeInner();
+         GetValHandle<THIS>(last).RelocateFrom(val);
          ++val;
 
          *(psl++) = 0;
@@ -257,6 +280,25 @@ namespace Langulus::Anyness
       --mKeys.mCount;
    }
 
+   /// Find where a slot ended up, after a pair was removed. Pairs that       
+   /// followed the removed one in its cluster are shifted one slot back      
+   ///   @param removed - the slot of the removed pair                        
+   ///   @param index - the slot, as it was before the removal                
+   ///   @return the slot after the removal                                   
+   LANGULUS(INLINED)
+   Offset BlockMap::GetShiftedIndex(const Offset removed, const Offset index) const noexcept {
+      // After shifting, the first empty slot marks the cluster's end   
+      const auto hashmask = GetReserved() - 1;
+      auto empty = removed;
+      while (mInfo[empty])
+         empty = (empty + 1) & hashmask;
+
+      const auto distance = (index - removed) & hashmask;
+      if (distance and distance <= ((empty - removed) & hashmask))
+         return (index - 1) & hashmask;
+      return index;
+   }
+
    /// Clears all data, but doesn't deallocate                                
    template<CT::Map THIS> LANGULUS(INLINED)
    void BlockMap::Clear() {
@@ -264,31 +306,34 @@ namespace Langulus::Anyness
          return;
 
       // Always destroy values before keys, because keys contain mInfo  
-      if (mValues.mEntry->GetUses() == 1) {
+      // Memory can't be inspected after it's dereferenced, because     
+      // other owners might release it meanwhile                        
+      const bool reuseValues = mValues.mEntry->GetUses() == 1;
+      if (reuseValues) {
          // Value memory can be reused                                  
          GetVals<THIS>().FreeInner(mInfo);
       }
       else {
          // Data is used from multiple locations, don't change data     
          // We're forced to dereference and reset value pointers        
-         GetVals<THIS>().template FreeInner<false>(mInfo);
-         const_cast<Allocation*>(mValues.mEntry)->Free();
+         GetVals<THIS>().FreeShared(mInfo);
       }
 
-      if (mKeys.mEntry->GetUses() == 1) {
+      const bool reuseKeys = mKeys.mEntry->GetUses() == 1;
+      if (reuseKeys) {
          // Key memory can be reused, which means info is reusable, too 
          GetKeys<THIS>().FreeInner(mInfo);
       }
       else {
          // Data is used from multiple locations, don't change data     
          // We're forced to dereference and reset key pointers          
-         GetKeys<THIS>().template FreeInner<false>(mInfo);
-         const_cast<Allocation*>(mKeys.mEntry)->Free();
+         GetKeys<THIS>().FreeShared(mInfo);
       }
 
       // Info array must be cleared at the end                          
-      if (mKeys.mEntry->GetUses() == 1) {
+      if (reuseKeys) {
          ZeroMemory(mInfo, GetReserved());
+         OrderReset<THIS>();
          mKeys.mCount = 0;
       }
       else {
@@ -296,7 +341,7 @@ namespace Langulus::Anyness
          mKeys.ResetMemory();
       }
 
-      if (mValues.mEntry->GetUses() != 1)
+      if (not reuseValues)
          mValues.ResetMemory();
    }
 
@@ -313,9 +358,7 @@ namespace Langulus::Anyness
          }
          else {
             // Data is used from multiple locations, just deref values  
-            if (not IsEmpty())
-               GetVals<THIS>().template FreeInner<false>(mInfo);
-            const_cast<Allocation*>(mValues.mEntry)->Free();
+            GetVals<THIS>().FreeShared(mInfo);
          }
       }
 
@@ -328,9 +371,7 @@ namespace Langulus::Anyness
          }
          else {
             // Data is used from multiple locations, just deref keys    
-            if (not IsEmpty())
-               GetKeys<THIS>().template FreeInner<false>(mInfo);
-            const_cast<Allocation*>(mKeys.mEntry)->Free();
+            GetKeys<THIS>().FreeShared(mInfo);
          }
       }
 
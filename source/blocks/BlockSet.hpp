@@ -30,6 +30,11 @@ namespace Langulus
          static constexpr Offset InvalidOffset = -1;
          static constexpr Count MinimalAllocation = 8;
 
+         // Whether a byte of each key's hash is kept after the info    
+         // bytes, so that most mismatching keys are rejected without   
+         // touching key memory                                         
+         static constexpr bool Fingerprints = LANGULUS_FEATURE(HASH_FINGERPRINTS);
+
       protected:
          // A precomputed pointer for the info (and ordering) bytes     
          // Points to an offset inside mKeys allocation                 
@@ -38,6 +43,8 @@ namespace Langulus
          //    1 - the index is used, key is exactly where it should be 
          //   2+ - the index is used, but bucket is info-1 buckets to   
          //         the right of this index                             
+         // Ordered sets also keep a doubly-linked list of the elements 
+         // in the order they were inserted, after the info bytes       
          InfoType* mInfo {};
 
          // The block that contains the keys and info bytes             
@@ -171,6 +178,34 @@ namespace Langulus::Anyness
       NOD() InfoType const* GetInfo() const noexcept;
       NOD() InfoType*       GetInfo() noexcept;
       NOD() InfoType const* GetInfoEnd() const noexcept;
+      NOD() InfoType const* GetFingerprints() const noexcept;
+      NOD() InfoType*       GetFingerprints() noexcept;
+      template<CT::Set>
+      NOD() Size            GetInfoSize() const noexcept;
+      template<CT::Set>
+      NOD() static constexpr Size RequestInfoSize(Count) noexcept;
+      NOD() static constexpr Offset GetOrderOffset(Count) noexcept;
+
+      NOD() OrderType const* GetOrder() const noexcept;
+      NOD() OrderType*       GetOrder() noexcept;
+      template<CT::Set>
+      NOD() OrderType const* GetOrderLink(Offset) const noexcept;
+      NOD() Offset GetOrderNext(Offset) const noexcept;
+      NOD() Offset GetOrderPrev(Offset) const noexcept;
+      void SetOrderLink(Offset, Offset) noexcept;
+
+      template<CT::Set>
+      void OrderReset() noexcept;
+      template<CT::Set>
+      void OrderAppend(Offset) noexcept;
+      template<CT::Set>
+      void OrderUnlink(Offset) noexcept;
+      template<CT::Set>
+      void OrderMove(Offset, Offset) noexcept;
+      template<CT::Set>
+      void OrderSwap(Offset, bool) noexcept;
+      template<CT::Set>
+      void OrderPlace(Offset, bool) noexcept;
 
       NOD() Count GetCountDeep(const Block<>&) const noexcept;
       NOD() Count GetCountElementsDeep(const Block<>&) const noexcept;
@@ -192,6 +227,7 @@ namespace Langulus::Anyness
 
       NOD() static Offset GetBucket(Offset, const CT::NoIntent auto&) noexcept;
       NOD() static Offset GetBucketUnknown(Offset, const Block<>&) noexcept;
+      NOD() static InfoType GetFingerprint(const Hash&) noexcept;
 
       template<CT::Set = UnorderedSet>
       NOD() decltype(auto) GetRaw(Offset)       IF_UNSAFE(noexcept);
@@ -239,6 +275,11 @@ namespace Langulus::Anyness
       static constexpr bool NoexceptIterator = not LANGULUS_SAFE()
          and noexcept(Fake<F&&>().operator() (Fake<ArgumentOf<F>>()));
 
+      template<CT::Set, bool REVERSE = false>
+      NOD() Offset GetNextIndex(Offset) const noexcept;
+      template<CT::Set, bool REVERSE = false>
+      Offset DiscardInner(Offset);
+
       template<CT::Set, bool REVERSE>
       LoopControl ForEachInner(auto&& f, Count&) const noexcept(NoexceptIterator<decltype(f)>);
 
@@ -319,6 +360,8 @@ namespace Langulus::Anyness
       void AllocateData(Count);
       template<CT::Set>
       void AllocateInner(Count);
+      template<CT::Set>
+      void Reorder();
 
       template<CT::Set, bool DEEP = false>
       void Keep() const noexcept;
@@ -342,6 +385,8 @@ namespace Langulus::Anyness
    protected:
       template<CT::Set>
       auto CreateValHandle(auto&&);
+      template<CT::Set>
+      static auto& GetSwapper(auto&) noexcept;
 
       template<CT::Set>
       NOD() Size RequestKeyAndInfoSize(Count, Offset&) const IF_UNSAFE(noexcept);
@@ -351,9 +396,15 @@ namespace Langulus::Anyness
       template<CT::Set>
       void ShiftPairs();
 
+      template<CT::Set>
+      void PrefetchBucket(Offset) const noexcept;
+
       template<CT::Set, bool CHECK_FOR_MATCH>
       Offset InsertInner(Offset, auto&&);
 
+      template<CT::Set, bool CHECK_FOR_MATCH, bool TYPED, CT::Intent S>
+      void InsertBatchInner(auto&&);
+
       template<CT::Set, bool CHECK_FOR_MATCH, template<class> class S, CT::Block B>
       requires CT::Intent<S<B>>
       Offset InsertBlockInner(Offset, S<B>&&);
@@ -380,6 +431,7 @@ namespace Langulus::Anyness
       void RemoveInner(Offset) IF_UNSAFE(noexcept);
       template<CT::Set>
       Count RemoveKeyInner(const CT::NoIntent auto&);
+      NOD() Offset GetShiftedIndex(Offset, Offset) const noexcept;
 
    #if LANGULUS(TESTING)
       public: NOD() constexpr const void* GetRawMemory() const noexcept;
@@ -413,8 +465,11 @@ namespace Langulus::Anyness
       const InfoType* mSentinel;
       // Currently selected element                                     
       InnerT mKey;
+      // Points to the insertion order link of the current element,     
+      // used only when iterating ordered sets                          
+      const OrderType* mOrder;
 
-      constexpr Iterator(const InfoType*, const InfoType*, const InnerT&) noexcept;
+      constexpr Iterator(const InfoType*, const InfoType*, const InnerT&, const OrderType* = nullptr) noexcept;
 
    public:
       Iterator() noexcept = delete;
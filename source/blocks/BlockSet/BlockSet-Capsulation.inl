@@ -92,6 +92,189 @@ namespace Langulus::Anyness
       return mInfo + GetReserved();
    }
 
+   /// Get the fingerprints array, that follows the info sentinel (const)     
+   ///   @attention contents are valid only if Fingerprints is enabled        
+   ///   @return a pointer to the first fingerprint                           
+   LANGULUS(INLINED)
+   const BlockSet::InfoType* BlockSet::GetFingerprints() const noexcept {
+      return mInfo + GetReserved() + 1;
+   }
+
+   /// Get the fingerprints array, that follows the info sentinel             
+   ///   @attention contents are valid only if Fingerprints is enabled        
+   ///   @return a pointer to the first fingerprint                           
+   LANGULUS(INLINED)
+   BlockSet::InfoType* BlockSet::GetFingerprints() noexcept {
+      return mInfo + GetReserved() + 1;
+   }
+
+   /// Get the number of bytes after the keys, that are used for info bytes,  
+   /// the sentinel, fingerprints (if enabled) and insertion order (if THIS   
+   /// is ordered)                                                            
+   ///   @return the number of bytes                                          
+   template<CT::Set THIS> LANGULUS(INLINED)
+   Size BlockSet::GetInfoSize() const noexcept {
+      return RequestInfoSize<THIS>(GetReserved());
+   }
+
+   /// Get the number of bytes after the keys, required for a given number    
+   /// of slots                                                               
+   ///   @param count - the number of slots                                   
+   ///   @return the number of bytes                                          
+   template<CT::Set THIS> LANGULUS(INLINED)
+   constexpr Size BlockSet::RequestInfoSize(const Count count) noexcept {
+      if constexpr (THIS::Ordered) {
+         // Two links for each slot, and three additional labels - the  
+         // anchor, the carried element, and a temporary for swapping   
+         return GetOrderOffset(count) + 2 * (count + 3) * sizeof(OrderType);
+      }
+      else return count * (Fingerprints ? 2 : 1) + 1;
+   }
+
+   /// Get the offset of the insertion order links, relative to the start of  
+   /// the info array. The links are aligned, and follow the fingerprints     
+   ///   @param count - the number of slots                                   
+   ///   @return the offset in bytes                                          
+   LANGULUS(INLINED)
+   constexpr Offset BlockSet::GetOrderOffset(const Count count) noexcept {
+      const Offset bytes = count * (Fingerprints ? 2 : 1) + 1;
+      return (bytes + sizeof(OrderType) - 1) & ~(sizeof(OrderType) - 1);
+   }
+
+   /// Get the insertion order links of an ordered set (const)                
+   /// Links are laid out the same way as in ordered maps - see               
+   /// BlockMap::GetOrder for details                                         
+   ///   @attention contents are valid only if the set is ordered             
+   ///   @return a pointer to the first 'next' link                           
+   LANGULUS(INLINED)
+   const BlockSet::OrderType* BlockSet::GetOrder() const noexcept {
+      return reinterpret_cast<const OrderType*>(
+         mInfo + GetOrderOffset(GetReserved()));
+   }
+
+   /// Get the insertion order links of an ordered set                        
+   ///   @attention contents are valid only if the set is ordered             
+   ///   @return a pointer to the first 'next' link                           
+   LANGULUS(INLINED)
+   BlockSet::OrderType* BlockSet::GetOrder() noexcept {
+      return reinterpret_cast<OrderType*>(
+         mInfo + GetOrderOffset(GetReserved()));
+   }
+
+   /// Get the 'next' link of a slot, for use in iterators                    
+   ///   @param index - the slot                                              
+   ///   @return the link, or nullptr if THIS is not ordered                  
+   template<CT::Set THIS> LANGULUS(INLINED)
+   const BlockSet::OrderType* BlockSet::GetOrderLink(const Offset index) const noexcept {
+      if constexpr (THIS::Ordered)
+         return GetOrder() + index;
+      else
+         return nullptr;
+   }
+
+   /// Get the label that follows another in insertion order                  
+   ///   @param index - the label                                             
+   ///   @return the next label                                               
+   LANGULUS(INLINED)
+   Offset BlockSet::GetOrderNext(const Offset index) const noexcept {
+      return index + GetOrder()[index];
+   }
+
+   /// Get the label that precedes another in insertion order                 
+   ///   @param index - the label                                             
+   ///   @return the previous label                                           
+   LANGULUS(INLINED)
+   Offset BlockSet::GetOrderPrev(const Offset index) const noexcept {
+      return index + GetOrder()[GetReserved() + 3 + index];
+   }
+
+   /// Make one label follow another in insertion order                       
+   ///   @param from - the preceding label                                    
+   ///   @param to - the following label                                      
+   LANGULUS(INLINED)
+   void BlockSet::SetOrderLink(const Offset from, const Offset to) noexcept {
+      const auto order = GetOrder();
+      order[from] = to - from;
+      order[GetReserved() + 3 + to] = from - to;
+   }
+
+   /// Forget the insertion order of all elements                             
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::OrderReset() noexcept {
+      if constexpr (THIS::Ordered)
+         SetOrderLink(GetReserved(), GetReserved());
+   }
+
+   /// Make a slot the most recently inserted one                             
+   ///   @param index - the slot                                              
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::OrderAppend(const Offset index) noexcept {
+      if constexpr (THIS::Ordered) {
+         const auto anchor = GetReserved();
+         SetOrderLink(GetOrderPrev(anchor), index);
+         SetOrderLink(index, anchor);
+      }
+   }
+
+   /// Remove a slot from the insertion order                                 
+   ///   @param index - the slot                                              
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::OrderUnlink(const Offset index) noexcept {
+      if constexpr (THIS::Ordered)
+         SetOrderLink(GetOrderPrev(index), GetOrderNext(index));
+   }
+
+   /// Make a label take the place of another in insertion order, used when   
+   /// an element is moved to a different slot                                
+   ///   @attention assumes 'to' is not linked                                
+   ///   @param from - the label to replace                                   
+   ///   @param to - the label to put in its place                            
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::OrderMove(const Offset from, const Offset to) noexcept {
+      if constexpr (THIS::Ordered) {
+         const auto prev = GetOrderPrev(from);
+         const auto next = GetOrderNext(from);
+         SetOrderLink(prev, to);
+         SetOrderLink(to, next);
+      }
+   }
+
+   /// Account for a robin-hood swap on insertion - the carried element       
+   /// settles at a slot, and the element that was there is carried further   
+   ///   @param index - the slot where the swap happened                      
+   ///   @param first - whether it is the first swap, which settles the       
+   ///                  element that is being inserted                        
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::OrderSwap(const Offset index, const bool first) noexcept {
+      if constexpr (THIS::Ordered) {
+         const auto carried = GetReserved() + 1;
+         if (first) {
+            OrderMove<THIS>(index, carried);
+            OrderAppend<THIS>(index);
+         }
+         else {
+            const auto temporary = GetReserved() + 2;
+            OrderMove<THIS>(index, temporary);
+            OrderMove<THIS>(carried, index);
+            OrderMove<THIS>(temporary, carried);
+         }
+      }
+   }
+
+   /// Account for the carried element settling at an empty slot on insertion 
+   ///   @param index - the empty slot                                        
+   ///   @param swapped - whether the carried element is a displaced one, or  
+   ///                    the element that is being inserted                  
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::OrderPlace(const Offset index, const bool swapped) noexcept {
+      if constexpr (THIS::Ordered) {
+         if (swapped)
+            OrderMove<THIS>(GetReserved() + 1, index);
+         else
+            OrderAppend<THIS>(index);
+      }
+   }
+
    /// Get the templated values container                                     
    ///   @attention for internal use only, elements might not be initialized  
    template<CT::Set THIS> LANGULUS(INLINED)
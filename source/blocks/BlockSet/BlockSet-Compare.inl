@@ -99,7 +99,8 @@ namespace Langulus::Anyness
 
       return {
          GetInfo() + offset, GetInfoEnd(),
-         GetRaw<THIS>(offset)
+         GetRaw<THIS>(offset),
+         GetOrderLink<THIS>(offset)
       };
    }
 
@@ -141,52 +142,26 @@ namespace Langulus::Anyness
               and not me.template IsSimilar<K>())
             return InvalidOffset;
 
-         // Get the starting index based on the key hash                
-         const auto start = GetBucket(GetReserved() - 1, match);
-         auto info = GetInfo() + start;
-         if (not *info)
-            return InvalidOffset;
-
-         // Test first candidate                                        
-         if (GetRef<THIS>(start) == match)
-            return start;
-
-         // Test all candidates on the right up until the end           
-         ++info;
-
-         auto infoEnd = GetInfoEnd();
-         while (info != infoEnd) {
-            if (not *info)
-               return InvalidOffset;
-
-            const auto i = info - GetInfo();
-            if (GetRef<THIS>(i) == match)
-               return i;
-
-            ++info;
-         }
-
-         // Reached only if info has reached the end                    
-         // Keys might loop around, continue the search from the start  
-         info = GetInfo();
-         if (not *info)
-            return InvalidOffset;
-
-         if (GetRef<THIS>(0) == match)
-            return 0;
-
-         ++info;
-
-         infoEnd = GetInfo() + start;
-         while (info != infoEnd) {
-            if (not *info)
-               return InvalidOffset;
-
-            const auto i = info - GetInfo();
-            if (GetRef<THIS>(i) == match)
-               return i;
-
-            ++info;
+         // Get the starting index based on the key hash, and walk      
+         // the probe sequence. Robin-hood insertion guarantees, that   
+         // the keys in a cluster are sorted by distance from their     
+         // buckets, so a stored distance below the current one means   
+         // that the key can't be any further in the sequence           
+         const auto info = GetInfo();
+         const auto prints = GetFingerprints();
+         const auto mask = GetReserved() - 1;
+         const auto hash = HashOf(match);
+         const auto print = GetFingerprint(hash);
+         auto index = hash.mHash & mask;
+         Offset distance = 1;
+         while (info[index] >= distance) {
+            if ((not Fingerprints or prints[index] == print)
+            and GetRef<THIS>(index) == match)
+               return index;
+
+            // Keys might loop around the end of the table              
+            index = (index + 1) & mask;
+            ++distance;
          }
 
          // No such key was found                                       
@@ -204,54 +179,25 @@ namespace Langulus::Anyness
       if (IsEmpty() or not IsSimilar<THIS>(match.GetType()))
          return InvalidOffset;
 
-      // Get the starting index based on the key hash                   
-      const auto start = GetBucketUnknown(GetReserved() - 1, match);
-      auto info = GetInfo() + start;
-      if (not *info)
-         return InvalidOffset;
-
-      // Test first candidate                                           
-      if (GetRef<THIS>(start) == match)
-         return start;
-
-      // Test all candidates on the right up until the end              
-      ++info;
-
-      auto infoEnd = GetInfoEnd();
-      while (info != infoEnd) {
-         if (not *info)
-            return InvalidOffset;
-
-         const auto i = info - GetInfo();
-         if (GetRef<THIS>(i) == match)
-            return i;
-
-         ++info;
+      // Get the starting index based on the key hash, and walk the     
+      // probe sequence, until a key closer to its bucket is found      
+      const auto info = GetInfo();
+      const auto prints = GetFingerprints();
+      const auto mask = GetReserved() - 1;
+      const auto hash = match.GetHash();
+      const auto print = GetFingerprint(hash);
+      auto index = hash.mHash & mask;
+      Offset distance = 1;
+      while (info[index] >= distance) {
+         if ((not Fingerprints or prints[index] == print)
+         and GetRef<THIS>(index) == match)
+            return index;
+
+         // Keys might loop around the end of the table                 
+         index = (index + 1) & mask;
+         ++distance;
       }
 
-      // Reached only if info has reached the end                       
-      // Keys might loop around, continue the search from the start     
-      info = GetInfo();
-      if (not *info)
-         return InvalidOffset;
-
-      if (GetRef<THIS>(0) == match)
-         return 0;
-
-      ++info;
-
-      infoEnd = GetInfo() + start;
-      while (info != infoEnd) {
-         if (not *info)
-            return InvalidOffset;
-
-         const auto i = info - GetInfo();
-         if (GetRef<THIS>(i) == match)
-            return i;
-
-         ++info;
-      }
-      
       // No such key was found                                          
       return InvalidOffset;
    }
@@ -20,6 +20,21 @@ namespace Langulus::Anyness
    void BlockSet::BlockTransfer(S<FROM>&& other) {
       using SS = S<FROM>;
 
+      if constexpr (TO::Ordered and not FROM::Ordered) {
+         // The source doesn't keep track of insertion order, so we     
+         // transfer it as it is, and then rebuild it in the order      
+         // elements are stored in                                      
+         BlockTransfer<FROM>(other.Forward());
+         if constexpr (CT::TypedSet<TO>) {
+            mKeys.mType   = MetaDataOf<TypeOf<TO>>();
+            mKeys.mState += DataState::Typed;
+         }
+
+         if (not IsEmpty())
+            Reorder<TO>();
+         return;
+      }
+
       if constexpr (not CT::TypedSet<TO>) {
          // TO is not statically typed, so we can safely                
          // overwrite type and state                                    
@@ -93,7 +108,7 @@ namespace Langulus::Anyness
                }
 
                AllocateFresh<B>(other->GetReserved());
-               CopyMemory(mInfo, other->mInfo, GetReserved() + 1);
+               CopyMemory(mInfo, other->mInfo, GetInfoSize<B>());
 
                if constexpr (CT::Typed<B>) {
                   // At least one of the sets is typed                  
@@ -198,7 +213,7 @@ namespace Langulus::Anyness
             if constexpr (CT::Dense<TypeOf<B>>) {
                // We're cloning dense elements, so we're 100% sure, that
                // each element will end up in the same place            
-               CopyMemory(mInfo, other->mInfo, GetReserved() + 1);
+               CopyMemory(mInfo, other->mInfo, GetInfoSize<B>());
 
                if constexpr (CT::POD<TypeOf<B>>) {
                   // Data is POD, we can directly copy the entire table 
@@ -247,6 +262,7 @@ namespace Langulus::Anyness
                // Zero info bytes and insert pointers                   
                ZeroMemory(mInfo, mKeys.mReserved);
                mInfo[mKeys.mReserved] = 1;
+               OrderReset<B>();
 
                auto ptr = coalesced.GetRaw();
                const auto ptrEnd = coalesced.GetRawEnd();
@@ -267,7 +283,7 @@ namespace Langulus::Anyness
             if (not asFrom->mKeys.mType->mIsSparse) {
                // We're cloning dense elements, so we're 100% sure, that
                // each element will end up in the same place            
-               CopyMemory(mInfo, other->mInfo, GetReserved() + 1);
+               CopyMemory(mInfo, other->mInfo, GetInfoSize<B>());
 
                if (asFrom->mKeys.mType->mIsPOD) {
                   // Data is POD, we can directly copy the entire table 
@@ -316,6 +332,7 @@ namespace Langulus::Anyness
                // Zero info bytes and insert pointers                   
                ZeroMemory(mInfo, mKeys.mReserved);
                mInfo[mKeys.mReserved] = 1;
+               OrderReset<B>();
 
                auto ptr = coalesced.mRaw;
                const auto ptrEnd = coalesced.mRaw + coalesced.GetBytesize();
@@ -343,9 +360,11 @@ namespace Langulus::Anyness
          // Set is used from multiple locations, and we must branch out 
          // before changing it - only this copy will be affected        
          if constexpr (CT::Typed<THIS> and CT::ReferMakable<TypeOf<THIS>>) {
-            const BlockSet backup = *this;
-            const_cast<Allocation*>(mKeys.mEntry)->Free();
+            // The original is released only after copying, because     
+            // other owners might release it in the meantime            
+            BlockSet backup = *this;
             new (this) THIS {Copy(reinterpret_cast<const THIS&>(backup))};
+            backup.GetValues<THIS>().FreeShared(backup.mInfo);
          }
          else LANGULUS_THROW(Construct,
             "Set needs to branch out, but type doesn't support Intent::Copy");
@@ -113,15 +113,13 @@ namespace Langulus::Anyness
          i = static_cast<Offset>(index);
       }
 
-      auto info = GetInfo();
-      const auto infoEnd = GetInfoEnd();
-      while (info != infoEnd) {
-         if (*info) {
-            if (i == 0)
-               return GetRef<THIS>(info - GetInfo());
-            --i;
-         }
-         ++info;
+      // Ordered sets count elements in the order they were inserted    
+      auto slot = GetNextIndex<THIS>(GetReserved());
+      while (slot != GetReserved()) {
+         if (i == 0)
+            return GetRef<THIS>(slot);
+         --i;
+         slot = GetNextIndex<THIS>(slot);
       }
 
       // If reached, then index was invalid                             
@@ -189,6 +187,18 @@ namespace Langulus::Anyness
       return value.GetHash().mHash & mask;
    }
 
+   /// Get the fingerprint of a hash, that is stored next to the info bytes   
+   /// The hash is scrambled, so that its highest byte depends on all bits,   
+   /// even for weak hashes, like the ones of small integers                  
+   ///   @param hash - the hash to fingerprint                                
+   ///   @return the fingerprint                                              
+   LANGULUS(ALWAYS_INLINED)
+   auto BlockSet::GetFingerprint(const Hash& hash) noexcept -> InfoType {
+      constexpr auto golden = static_cast<decltype(hash.mHash)>(0x9E3779B97F4A7C15ull);
+      constexpr auto shift = sizeof(hash.mHash) * 8 - sizeof(InfoType) * 8;
+      return static_cast<InfoType>((hash.mHash * golden) >> shift);
+   }
+
    /// Get an element handle                                                  
    ///   @attention assumes index is in container's limits                    
    ///   @param i - the key index                                             
@@ -7,36 +7,48 @@
 ///                                                                           
 #pragma once
 #include "../BlockSet.hpp"
+#include "../LocalBlock.hpp"
 #include "../../text/Text.hpp"
+#include "../../Vectorize.hpp"
 
 
 namespace Langulus::Anyness
 {
 
-   /// Wrap the argument into a handle with value's type                      
+   /// Wrap the argument into a handle with value's type, or into a local     
+   /// block with the contained type, if set is type-erased                   
    ///   @attention if value is a type-erased handle or void*, we assume that 
    ///      the pointer always points to a valid instance of the current      
    ///      value type                                                        
    ///   @param val - the val to wrap, with or without intent                 
-   ///   @return the handle object                                            
+   ///   @return the handle object, or the local block                        
    template<CT::Set THIS>
    auto BlockSet::CreateValHandle(auto&& val) {
       using S = IntentOf<decltype(val)>;
       using T = TypeOf<S>;
 
-      if constexpr (CT::Typed<THIS>) {
-         using V = Conditional<CT::Typed<THIS>, TypeOf<THIS>, TypeOf<T>>;
-         return HandleLocal<V> {S::Nest(val)};
-      }
+      if constexpr (CT::Typed<THIS>)
+         return HandleLocal<TypeOf<THIS>> {S::Nest(val)};
       else {
          // Make sure that value is always inserted, and never absorbed 
-         auto result = Many::Wrap(S::Nest(val));
-         // And make sure that type is set to the contained value type  
-         result.mType = mKeys.mType;
-         return result;
+         // The block has the contained value type                      
+         using V = Decvq<Conditional<CT::Handle<T>, TypeOf<T>, T>>;
+         return LocalBlock<V> {mKeys.mType, S::Nest(val)};
       }
    }
 
+   /// Get what is swapped with the contained elements while inserting        
+   ///   @param holder - the result of CreateValHandle                        
+   ///   @return the handle itself if set is typed, or the block inside the   
+   ///      local block otherwise                                             
+   template<CT::Set THIS> LANGULUS(INLINED)
+   auto& BlockSet::GetSwapper(auto& holder) noexcept {
+      if constexpr (CT::Typed<THIS>)
+         return holder;
+      else
+         return holder.GetBlock();
+   }
+
    /// Insert an element, or an array of elements, with or without intent     
    ///   @param item - the argument and intent to unfold and insert           
    ///   @return the number of inserted elements after unfolding              
@@ -55,7 +67,7 @@ namespace Langulus::Anyness
                // Construct from an array of elements, each of which    
                // can be used to initialize an element, nesting any     
                // intents while at it                                   
-               Reserve(GetCount() + ExtentOf<T>);
+               Reserve<THIS>(GetCount() + ExtentOf<T>);
                for (auto& key : DeintCast(item)) {
                   InsertInner<THIS, true>(
                      GetBucket(GetReserved() - 1, DeintCast(key)),
@@ -76,7 +88,7 @@ namespace Langulus::Anyness
          }
          else if constexpr (CT::StringLiteral<T>) {
             // Implicitly convert string literals to Text containers    
-            Reserve(GetCount() + 1);
+            Reserve<THIS>(GetCount() + 1);
             Text text {S::Nest(item)};
             InsertInner<THIS, true>(
                GetBucket(GetReserved() - 1, text),
@@ -87,7 +99,7 @@ namespace Langulus::Anyness
          else {
             // Insert the array                                         
             Mutate<THIS, Decvq<Deext<T>>>();
-            Reserve(GetCount() + ExtentOf<T>);
+            Reserve<THIS>(GetCount() + ExtentOf<T>);
             Count inserted = 0;
             for (auto& e : DeintCast(item)) {
                inserted += InsertInner<THIS, true>(
@@ -101,7 +113,7 @@ namespace Langulus::Anyness
       else if constexpr (not CT::TypeErased<E>) {
          if constexpr (CT::Handle<T> and CT::Similar<E, TypeOf<T>>) {
             // Insert a handle                                          
-            Reserve(GetCount() + 1);
+            Reserve<THIS>(GetCount() + 1);
             InsertInner<THIS, true>(
                GetBucket(GetReserved() - 1, DeintCast(item).Get()),
                S::Nest(item)
@@ -112,7 +124,7 @@ namespace Langulus::Anyness
             // Some of the arguments might still be used directly to    
             // make an element, forward these to standard insertion here
             mKeys.mType = MetaDataOf<E>();
-            Reserve(GetCount() + 1);
+            Reserve<THIS>(GetCount() + 1);
             InsertInner<THIS, true>(
                GetBucket(GetReserved() - 1, DeintCast(item)),
                S::Nest(item)
@@ -127,7 +139,7 @@ namespace Langulus::Anyness
 
                if constexpr (CT::MakableFrom<E, T2>) {
                   // Elements are mappable                              
-                  Reserve(GetCount() + DeintCast(item).GetCount());
+                  Reserve<THIS>(GetCount() + DeintCast(item).GetCount());
                   for (auto& key : DeintCast(item)) {
                      InsertInner<THIS, true>(
                         GetBucket(GetReserved() - 1, key),
@@ -150,7 +162,7 @@ namespace Langulus::Anyness
                LANGULUS_ASSERT(DeintCast(item).template IsSimilar<E>(), Meta,
                   "Type mismatch");
 
-               Reserve(GetCount() + DeintCast(item).GetCount());
+               Reserve<THIS>(GetCount() + DeintCast(item).GetCount());
                for (auto& key : DeintCast(item)) {
                   InsertBlockInner<THIS, true>(
                      GetBucketUnknown(GetReserved() - 1, key),
@@ -167,7 +179,7 @@ namespace Langulus::Anyness
          if constexpr (CT::Handle<T>) {
             // Insert a handle                                          
             Mutate<THIS, Decvq<TypeOf<T>>>();
-            Reserve(GetCount() + 1);
+            Reserve<THIS>(GetCount() + 1);
             InsertInner<THIS, true>(
                GetBucket(GetReserved() - 1, DeintCast(item).Get()),
                S::Nest(item)
@@ -177,7 +189,7 @@ namespace Langulus::Anyness
             // Some of the arguments might still be used directly to    
             // make an element, forward these to standard insertion here
             Mutate<THIS, Decvq<T>>();
-            Reserve(GetCount() + 1);
+            Reserve<THIS>(GetCount() + 1);
             InsertInner<THIS, true>(
                GetBucket(GetReserved() - 1, DeintCast(item)),
                S::Nest(item)
@@ -211,7 +223,15 @@ namespace Langulus::Anyness
       if (not count)
          return 0;
 
-      Reserve(GetCount() + count);
+      if constexpr (not CT::Typed<THIS>) {
+         // Make sure a type-erased set is typed, before reserving      
+         if constexpr (CT::Typed<ST>)
+            Mutate<THIS, TypeOf<ST>, void>();
+         else
+            Mutate<THIS, void>(DeintCast(item).GetType());
+      }
+
+      Reserve<THIS>(GetCount() + count);
 
       if (IsEmpty()) {
          // This set was empty, so no chance of collision, and since    
@@ -220,21 +240,12 @@ namespace Langulus::Anyness
          if constexpr (CT::Typed<ST> or CT::Typed<THIS>) {
             // Merging with a statically typed sets                     
             using B = Conditional<CT::Typed<ST>, ST, THIS>;
-            for (auto& it : reinterpret_cast<const B&>(DeintCast(item))) {
-               InsertInner<THIS, false>(
-                  GetBucket(GetReserved() - 1, it),
-                  S::Nest(it)
-               );
-            }
+            InsertBatchInner<THIS, false, true, S>(
+               reinterpret_cast<const B&>(DeintCast(item)));
          }
          else {
             // Merging type-erased sets                                 
-            for (auto& it : DeintCast(item)) {
-               InsertBlockInner<THIS, false>(
-                  GetBucketUnknown(GetReserved() - 1, it),
-                  S::Nest(it)
-               );
-            }
+            InsertBatchInner<THIS, false, false, S>(DeintCast(item));
          }
       }
       else {
@@ -243,21 +254,12 @@ namespace Langulus::Anyness
          if constexpr (CT::Typed<ST> or CT::Typed<THIS>) {
             // Merging with a statically typed sets                     
             using B = Conditional<CT::Typed<ST>, ST, THIS>;
-            for (auto& it : reinterpret_cast<const B&>(DeintCast(item))) {
-               InsertInner<THIS, true>(
-                  GetBucket(GetReserved() - 1, it),
-                  S::Nest(it)
-               );
-            }
+            InsertBatchInner<THIS, true, true, S>(
+               reinterpret_cast<const B&>(DeintCast(item)));
          }
          else {
             // Merging type-erased sets                                 
-            for (auto& it : DeintCast(item)) {
-               InsertBlockInner<THIS, true>(
-                  GetBucketUnknown(GetReserved() - 1, it),
-                  S::Nest(it)
-               );
-            }
+            InsertBatchInner<THIS, true, false, S>(DeintCast(item));
          }
       }
 
@@ -275,37 +277,89 @@ namespace Langulus::Anyness
       if (not count)
          return 0;
 
-      Reserve(GetCount() + count);
+      if constexpr (not CT::Typed<THIS>) {
+         // Make sure a type-erased set is typed, before reserving      
+         if constexpr (CT::Typed<ST>)
+            Mutate<THIS, TypeOf<ST>, void>();
+         else
+            Mutate<THIS, void>(DeintCast(item).GetType());
+      }
+
+      Reserve<THIS>(GetCount() + count);
 
       if constexpr (CT::Typed<ST> or CT::Typed<THIS>) {
          // Merging with a statically typed set and/or block            
          using B = Conditional<CT::Typed<ST>, ST, typename THIS::BlockType>;
-         for (auto& it : reinterpret_cast<const B&>(DeintCast(item))) {
-            InsertInner<THIS, true>(
-               GetBucket(GetReserved() - 1, it),
-               S::Nest(it)
-            );
-         }
+         InsertBatchInner<THIS, true, true, S>(
+            reinterpret_cast<const B&>(DeintCast(item)));
       }
       else {
          // Merging type-erased block with a type-erased set            
-         for (auto& it : DeintCast(item)) {
-            InsertBlockInner<THIS, true>(
-               GetBucketUnknown(GetReserved() - 1, it),
-               S::Nest(it)
-            );
-         }
+         InsertBatchInner<THIS, true, false, S>(DeintCast(item));
       }
 
       return count;
    }
-   
+
+   /// Insert a range of elements in batches, with or without intent          
+   /// All elements in a batch are hashed in one pass, and their buckets are  
+   /// prefetched a couple of elements ahead of placement, hiding most of the 
+   /// cache misses of inserting many elements at once                        
+   ///   @attention assumes enough memory has been reserved for the range     
+   ///   @tparam CHECK_FOR_MATCH - false if you guarantee elements are unique 
+   ///   @tparam TYPED - whether range elements are statically typed          
+   ///   @tparam S - the intent to insert elements with                       
+   ///   @param range - the elements to insert                                
+   template<CT::Set THIS, bool CHECK_FOR_MATCH, bool TYPED, CT::Intent S>
+   void BlockSet::InsertBatchInner(auto&& range) {
+      using E = Deref<decltype(*range.begin())>;
+      using Slot = Conditional<TYPED, E*, Decvq<E>>;
+
+      const auto mask = GetReserved() - 1;
+      Offset buckets[Inner::InsertBatchSize];
+      Slot slots[Inner::InsertBatchSize];
+
+      auto it = range.begin();
+      const auto end = range.end();
+      while (it != end) {
+         // Hash all elements in the batch in a tight loop, and start   
+         // loading the buckets of the first elements right away        
+         Count batchCount = 0;
+         for (; batchCount < Inner::InsertBatchSize and it != end; ++it, ++batchCount) {
+            if constexpr (TYPED) {
+               slots[batchCount] = &*it;
+               buckets[batchCount] = GetBucket(mask, *it);
+            }
+            else {
+               slots[batchCount] = *it;
+               buckets[batchCount] = GetBucketUnknown(mask, *it);
+            }
+
+            if (batchCount < Inner::PrefetchDistance)
+               PrefetchBucket<THIS>(buckets[batchCount]);
+         }
+
+         // Place the elements, while loading buckets of upcoming ones  
+         for (Offset i = 0; i < batchCount; ++i) {
+            if (i + Inner::PrefetchDistance < batchCount)
+               PrefetchBucket<THIS>(buckets[i + Inner::PrefetchDistance]);
+
+            if constexpr (TYPED)
+               InsertInner<THIS, CHECK_FOR_MATCH>(buckets[i], S::Nest(*slots[i]));
+            else
+               InsertBlockInner<THIS, CHECK_FOR_MATCH>(buckets[i], S::Nest(slots[i]));
+         }
+      }
+   }
+
    /// Request a new size of keys and info                                    
    /// The memory layout is:                                                  
    ///   [keys for each bucket, including entries, if sparse]                 
    ///         [padding for alignment]                                        
    ///               [info for each bucket]                                   
    ///                     [one sentinel byte for terminating loops]          
+   ///                           [fingerprint for each bucket, if enabled]    
+   ///                                 [insertion order links, if ordered]    
    ///   @attention assumes key type has been set                             
    ///   @param request - number of keys to allocate                          
    ///   @param infoStart - [out] the offset at which info bytes start        
@@ -329,13 +383,16 @@ namespace Langulus::Anyness
       }
 
       infoStart = keymemory + Alignment - (keymemory % Alignment);
-      return infoStart + request + 1;
+      return infoStart + RequestInfoSize<THIS>(request);
    }
 
-   /// Rehashes and reinserts each pair in the same block                     
+   /// Rehashes and reinserts each key in the same block                      
+   /// Pending keys still reside at their old index, while mInfo marks only   
+   /// keys that were already reinserted. Robin-hood order is maintained      
+   /// throughout, so that lookups can terminate early afterwards             
    ///   @attention assumes count and oldCount are power-of-two               
    ///   @attention assumes count > oldCount                                  
-   ///   @param oldCount - the old number of pairs                            
+   ///   @param oldCount - the old number of keys                             
    template<CT::Set THIS>
    void BlockSet::Rehash(const Count oldCount) {
       LANGULUS_ASSUME(DevAssumes, mKeys.mReserved > oldCount,
@@ -345,107 +402,144 @@ namespace Langulus::Anyness
       LANGULUS_ASSUME(DevAssumes, IsPowerOfTwo(oldCount),
          "Old count is not a power-of-two");
 
-      UNUSED() auto& me = reinterpret_cast<const THIS&>(*this);
-      auto oldKey = GetHandle<THIS>(0);
-      auto oldInfo = GetInfo();
-      const auto oldInfoEnd = oldInfo + oldCount;
+      // Move the info array to a temporary, that marks which keys are  
+      // pending, and rebuild the one in the set                        
+      TMany<InfoType> pendingInfo {Copy(MakeBlock(mInfo, oldCount))};
+      ZeroMemory(mInfo, oldCount);
+      const auto pending = pendingInfo.GetRaw();
       const auto hashmask = mKeys.mReserved - 1;
+      const auto prints = GetFingerprints();
 
-      // First run: move elements closer to their new buckets           
-      while (oldInfo != oldInfoEnd) {
-         if (*oldInfo) {
-            // Rehash and check if hashes match                         
-            const Offset oldIndex = oldInfo - GetInfo();
-            Offset oldBucket = (oldCount + oldIndex) - *oldInfo + 1;
-            Offset newBucket = 0;
-            if constexpr (CT::TypedSet<THIS>)
-               newBucket += GetBucket(hashmask, oldKey.Get());
-            else
-               newBucket += GetBucketUnknown(hashmask, oldKey);
-
-            if (oldBucket < oldCount or oldBucket - oldCount != newBucket) {
-               // Move it only if it won't end up in same bucket        
-               if constexpr (CT::Typed<THIS>) {
-                  using K = TypeOf<THIS>;
-                  HandleLocal<K> keyswap {Abandon(oldKey)};
+      // Where does a key want to move after a rehash?                  
+      const auto hashOf = [](const auto& key) {
+         if constexpr (CT::TypedSet<THIS>)
+            return HashOf(key.Get());
+         else
+            return key.GetHash();
+      };
+
+      // Insert a key that was taken out of its slot. Probing over a    
+      // slot that still holds a pending key takes its place, and the   
+      // displaced key is carried to its own bucket instead             
+      const auto reinsert = [&](auto& key, Hash hash) {
+         Offset index = hash.mHash & hashmask;
+         InfoType print = GetFingerprint(hash);
+         InfoType attempts {1};
+         while (true) {
+            if (not mInfo[index]) {
+               if (index >= oldCount or not pending[index]) {
+                  // Empty slot reached, so put the key there           
+                  GetHandle<THIS>(index).CreateWithIntent(Abandon(key));
+                  mInfo[index] = attempts;
+                  if constexpr (Fingerprints)
+                     prints[index] = print;
+                  return;
+               }
 
-                  // Destroy the key, info and value                    
-                  oldKey.FreeInner();
-                  *oldInfo = 0;
-                  --mKeys.mCount;
+               // Slot holds a key that wasn't reinserted yet           
+               GetHandle<THIS>(index).Swap(key);
+               pending[index] = 0;
+               mInfo[index] = attempts;
+               if constexpr (Fingerprints)
+                  prints[index] = print;
+
+               hash = hashOf(key);
+               index = hash.mHash & hashmask;
+               print = GetFingerprint(hash);
+               attempts = 1;
+               continue;
+            }
 
-                  // Reinsert at the new bucket                         
-                  InsertInner<THIS, false>(newBucket, Abandon(keyswap));
-               }
-               else {
-                  Block<> keyswap {DataState {}, GetType(), 1};
-                  keyswap.AllocateFresh(keyswap.RequestSize(1));
-                  keyswap.CreateWithIntent(Abandon(oldKey));
-
-                  // Destroy the pair and info at old index             
-                  oldKey.FreeInner();
-                  *oldInfo = 0;
-                  --mKeys.mCount;
-
-                  InsertBlockInner<THIS, false>(newBucket, Abandon(keyswap));
-                  keyswap.Free();
-               }
+            if (attempts > mInfo[index]) {
+               // The key we're carrying is closer to bucket, so swap   
+               GetHandle<THIS>(index).Swap(key);
+               ::std::swap(attempts, mInfo[index]);
+               if constexpr (Fingerprints)
+                  ::std::swap(print, prints[index]);
             }
+
+            // Wrap around and start from the beginning if we have to   
+            ++attempts;
+            index = (index + 1) & hashmask;
+         }
+      };
+
+      for (Offset i = 0; i < oldCount; ++i) {
+         if (not pending[i])
+            continue;
+         pending[i] = 0;
+
+         // If it's the same position then we just move on, just make   
+         // sure that info has been set to 1                            
+         auto oldKey = GetHandle<THIS>(i);
+         const auto hash = hashOf(oldKey);
+         if ((hash.mHash & hashmask) == i) {
+            mInfo[i] = 1;
+            if constexpr (Fingerprints)
+               prints[i] = GetFingerprint(hash);
+            continue;
          }
 
-         ++oldKey;
-         ++oldInfo;
+         // Otherwise take the key out of its slot, and reinsert it     
+         if constexpr (CT::Typed<THIS>) {
+            using K = TypeOf<THIS>;
+            HandleLocal<K> keyswap {Abandon(oldKey)};
+            oldKey.FreeInner();
+            reinsert(keyswap, hash);
+         }
+         else {
+            Block<> keyswap {DataState {}, GetType(), 1};
+            keyswap.AllocateFresh(keyswap.RequestSize(1));
+            keyswap.RelocateFrom(oldKey);
+            reinsert(keyswap, hash);
+            keyswap.Free();
+         }
       }
-
-      // First run might cause gaps                                     
-      // Second run: shift elements left, where possible                
-      ShiftPairs<THIS>();
    }
    
-   /// Shift elements left, where possible                                    
+   /// Fill the gaps left after removing keys, by shifting the following      
+   /// keys back towards their buckets, one slot at a time                    
+   /// This is equivalent to a backward-shift deletion for each gap, so the   
+   /// robin-hood order of keys is preserved                                  
    template<CT::Set THIS>
    void BlockSet::ShiftPairs() {
+      const auto hashmask = GetReserved() - 1;
+      const auto prints = GetFingerprints();
       int moves_performed;
       do {
          moves_performed = 0;
-         auto oldInfo = mInfo;
-         const auto newInfoEnd = GetInfoEnd();
-         while (oldInfo != newInfoEnd) {
-            if (*oldInfo > 1) {
-               // Entry can be moved by *oldInfo - 1 cells to the left  
-               const Offset oldIndex = oldInfo - GetInfo();
-
-               // Might loop around                                     
-               Offset to = mKeys.mReserved + oldIndex - *oldInfo + 1;
-               if (to >= mKeys.mReserved)
-                  to -= mKeys.mReserved;
-
-               InfoType attempt = 1;
-               while (mInfo[to] and attempt < *oldInfo) {
-                  // Might loop around                                  
-                  ++to;
-                  if (to >= mKeys.mReserved)
-                     to -= mKeys.mReserved;
-                  ++attempt;
-               }
-
-               if (not mInfo[to] and attempt < *oldInfo) {
-                  // Empty spot found, so move element there            
-                  auto key = GetHandle<THIS>(oldIndex);
-                  GetHandle<THIS>(to).CreateWithIntent(Abandon(key));
-                  key.FreeInner();
-
-                  mInfo[to] = attempt;
-                  *oldInfo = 0;
-                  ++moves_performed;
-               }
-            }
-
-            ++oldInfo;
+         for (Offset to = 0; to < GetReserved(); ++to) {
+            // Might loop around                                        
+            const Offset from = (to + 1) & hashmask;
+            if (mInfo[to] or mInfo[from] <= 1)
+               continue;
+
+            // Empty spot found before a displaced key, so move it      
+            auto key = GetHandle<THIS>(from);
+            GetHandle<THIS>(to).RelocateFrom(key);
+
+            mInfo[to] = mInfo[from] - 1;
+            mInfo[from] = 0;
+            if constexpr (Fingerprints)
+               prints[to] = prints[from];
+            OrderMove<THIS>(from, to);
+            ++moves_performed;
          }
       } while (moves_performed);
    }
 
+   /// Hint the CPU to start loading the info byte and element of a bucket,   
+   /// so that it is likely cached by the time an element is placed there     
+   ///   @param index - the bucket index                                      
+   template<CT::Set THIS> LANGULUS(INLINED)
+   void BlockSet::PrefetchBucket(const Offset index) const noexcept {
+      Inner::Prefetch(mInfo + index);
+      if constexpr (CT::Typed<THIS>)
+         Inner::Prefetch(GetValues<THIS>().GetRaw() + index);
+      else
+         Inner::Prefetch(mKeys.mRaw + index * mKeys.GetStride().mSize);
+   }
+
    /// Inner insertion function                                               
    ///   @tparam CHECK_FOR_MATCH - false if you guarantee key doesn't exist   
    ///   @param start - the starting index                                    
@@ -453,20 +547,49 @@ namespace Langulus::Anyness
    ///   @return the offset at which pair was inserted                        
    template<CT::Set THIS, bool CHECK_FOR_MATCH>
    Offset BlockSet::InsertInner(const Offset start, auto&& key) {
-      BranchOut<THIS>();
       using S = IntentOf<decltype(key)>;
-      auto keyswapper = CreateValHandle<THIS>(S::Nest(key));
+
+      if constexpr (not CT::Typed<THIS>) {
+         using K = Decvq<TypeOf<S>>;
+
+         if constexpr (CT::LocalHandleable<K>) {
+            // Element type is known at compile-time, and if it's       
+            // exactly the contained one, insert as if the set was      
+            // statically typed. This avoids going through the          
+            // reflected constructors and assigners on each swap        
+            if (mKeys.template IsExact<K>()) {
+               using TYPED = TSet<K, THIS::Ordered>;
+               return InsertInner<TYPED, CHECK_FOR_MATCH>(
+                  start, S::Nest(key));
+            }
+         }
+      }
+
+      BranchOut<THIS>();
+      auto keyholder = CreateValHandle<THIS>(S::Nest(key));
+      auto& keyswapper = GetSwapper<THIS>(keyholder);
+
+      // Fingerprint the key, if enabled - this hashes it again         
+      InfoType print {};
+      if constexpr (Fingerprints) {
+         if constexpr (CT::Typed<THIS>)
+            print = GetFingerprint(HashOf(keyswapper.Get()));
+         else
+            print = GetFingerprint(keyswapper.GetHash());
+      }
 
       // Get the starting index based on the key hash                   
       auto psl = GetInfo() + start;
       const auto pslEnd = GetInfoEnd();
+      const auto prints = GetFingerprints();
       InfoType attempts {1};
       Offset insertedAt = mKeys.mReserved;
       while (*psl) {
          const auto index = psl - GetInfo();
 
          if constexpr (CHECK_FOR_MATCH) {
-            if (keyswapper == GetRef<THIS>(index)) {
+            if ((not Fingerprints or prints[index] == print)
+            and keyswapper == GetRef<THIS>(index)) {
                // Neat, the value already exists - just return          
                return index;
             }
@@ -476,6 +599,9 @@ namespace Langulus::Anyness
             // The value we're inserting is closer to bucket, so swap   
             GetHandle<THIS>(index).Swap(keyswapper);
             ::std::swap(attempts, *psl);
+            if constexpr (Fingerprints)
+               ::std::swap(print, prints[index]);
+            OrderSwap<THIS>(index, insertedAt == mKeys.mReserved);
             if (insertedAt == mKeys.mReserved)
                insertedAt = index;
          }
@@ -495,10 +621,13 @@ namespace Langulus::Anyness
       const auto index = psl - GetInfo();
       GetHandle<THIS>(index).CreateWithIntent(Abandon(keyswapper));
 
+      OrderPlace<THIS>(index, insertedAt != mKeys.mReserved);
       if (insertedAt == mKeys.mReserved)
          insertedAt = index;
 
       *psl = attempts;
+      if constexpr (Fingerprints)
+         prints[index] = print;
       ++mKeys.mCount;
       return insertedAt;
    }
@@ -513,15 +642,22 @@ namespace Langulus::Anyness
    Offset BlockSet::InsertBlockInner(const Offset start, S<B>&& key) {
       BranchOut<THIS>();
 
+      // Fingerprint the key, if enabled - this hashes it again         
+      InfoType print {};
+      if constexpr (Fingerprints)
+         print = GetFingerprint(key->GetHash());
+
       // Get the starting index based on the key hash                   
       auto psl = GetInfo() + start;
       const auto pslEnd = GetInfoEnd();
+      const auto prints = GetFingerprints();
       InfoType attempts {1};
       Offset insertedAt = mKeys.mReserved;
       while (*psl) {
          const auto index = psl - GetInfo();
          if constexpr (CHECK_FOR_MATCH) {
-            if (GetHandle<THIS>(index) == *key) {
+            if ((not Fingerprints or prints[index] == print)
+            and GetHandle<THIS>(index) == *key) {
                // Neat, the key already exists - just return            
                return index;
             }
@@ -531,6 +667,9 @@ namespace Langulus::Anyness
             // The pair we're inserting is closer to bucket, so swap    
             GetHandle<THIS>(index).Swap(key.Forward());
             ::std::swap(attempts, *psl);
+            if constexpr (Fingerprints)
+               ::std::swap(print, prints[index]);
+            OrderSwap<THIS>(index, insertedAt == mKeys.mReserved);
             if (insertedAt == mKeys.mReserved)
                insertedAt = index;
          }
@@ -550,6 +689,7 @@ namespace Langulus::Anyness
       // We're moving only a single element, so no chance of overlap    
       const auto index = psl - GetInfo();
       GetHandle<THIS>(index).CreateWithIntent(key.Forward());
+      OrderPlace<THIS>(index, insertedAt != mKeys.mReserved);
       if (insertedAt == mKeys.mReserved)
          insertedAt = index;
 
@@ -559,6 +699,8 @@ namespace Langulus::Anyness
       }
 
       *psl = attempts;
+      if constexpr (Fingerprints)
+         prints[index] = print;
       ++mKeys.mCount;
       return insertedAt;
    }
@@ -32,6 +32,46 @@ namespace Langulus::Anyness
 
       if (   (CT::Deep<A> and keys.IsDeep())
       or (not CT::Deep<A> and keys.template CastsTo<A, true>())) {
+         if constexpr (THIS::Ordered) {
+            // Follow the insertion order, instead of the slots         
+            auto& keysLocal = DecvqCast(keys);
+            auto index = GetNextIndex<THIS, REVERSE>(GetReserved());
+            while (index != GetReserved()) {
+               ++executions;
+
+               if constexpr (CT::Bool<R>) {
+                  if (not f(keysLocal.template Get<A>(index)))
+                     return Loop::Break;
+               }
+               else if constexpr (CT::Exact<R, LoopControl>) {
+                  const R loop = f(keysLocal.template Get<A>(index));
+
+                  switch (loop.mControl) {
+                  case LoopControl::Break:
+                  case LoopControl::NextLoop:
+                     return loop;
+                  case LoopControl::Continue:
+                     break;
+                  case LoopControl::Repeat:
+                     continue;
+                  case LoopControl::Discard:
+                     if constexpr (CT::Mutable<THIS>) {
+                        // Discard is allowed only if THIS is mutable   
+                        index = const_cast<BlockSet*>(this)
+                           ->template DiscardInner<THIS, REVERSE>(index);
+                        continue;
+                     }
+                     else break;
+                  }
+               }
+               else f(keysLocal.template Get<A>(index));
+
+               index = GetNextIndex<THIS, REVERSE>(index);
+            }
+
+            return Loop::Continue;
+         }
+
          Count index = 0;
          if (mKeys.mType->mIsSparse) {
             // Iterate using pointers of A                              
@@ -91,28 +131,24 @@ namespace Langulus::Anyness
          "Non constant iterator for constant memory block");
 
       Count counter = 0;
-      auto info = REVERSE ? mInfo + GetReserved() - 1 : mInfo;
-      const auto infoEnd = REVERSE ? mInfo - 1 : mInfo + GetReserved();
-      const auto next = [&info] {
-         if constexpr (REVERSE)  --info;
-         else                    ++info;
-      };
+      if (IsEmpty())
+         return counter;
 
-      while (info != infoEnd) {
-         if (not *info) {
-            next();
-            continue;
-         }
+      auto index = GetNextIndex<THIS, REVERSE>(GetReserved());
+      const auto next = [this, &index] {
+         index = GetNextIndex<THIS, REVERSE>(index);
+      };
 
+      while (index != GetReserved()) {
          ++counter;
 
          if constexpr (CT::Bool<R>) {
-            if (not call(mKeys.GetElement(info - mInfo)))
+            if (not call(mKeys.GetElement(index)))
                return counter;
             next();
          }
          else if constexpr (CT::Exact<R, LoopControl>) {
-            const R loop = call(mKeys.GetElement(info - mInfo));
+            const R loop = call(mKeys.GetElement(index));
 
             switch (loop) {
             case LoopControl::Break:
@@ -126,10 +162,8 @@ namespace Langulus::Anyness
             case LoopControl::Discard:
                if constexpr (CT::Mutable<THIS>) {
                   // Discard is allowed only if THIS is mutable         
-                  const_cast<BlockSet*>(this)
-                     ->template RemoveInner<THIS>(info - mInfo);
-                  if constexpr (REVERSE)
-                     next();
+                  index = const_cast<BlockSet*>(this)
+                     ->template DiscardInner<THIS, REVERSE>(index);
                }
                else {
                   // ...otherwise it acts like a Loop::Continue         
@@ -139,7 +173,7 @@ namespace Langulus::Anyness
             }
          }
          else {
-            call(mKeys.GetElement(info - mInfo));
+            call(mKeys.GetElement(index));
             next();
          }
       }
@@ -207,6 +241,60 @@ namespace Langulus::Anyness
       return result;
    }
 
+   /// Get the slot of the element that follows another one in iteration      
+   /// order. Unordered sets follow the slots, while ordered sets follow the  
+   /// order in which elements were inserted                                  
+   ///   @tparam REVERSE - whether to step backwards                          
+   ///   @param index - the slot to step from, use the reserved count to get  
+   ///                  the first element (or the last one, if REVERSE)       
+   ///   @return the next slot, or the reserved count if there are no more    
+   template<CT::Set THIS, bool REVERSE> LANGULUS(INLINED)
+   Offset BlockSet::GetNextIndex(Offset index) const noexcept {
+      if constexpr (THIS::Ordered) {
+         if constexpr (REVERSE)  return GetOrderPrev(index);
+         else                    return GetOrderNext(index);
+      }
+      else if constexpr (REVERSE) {
+         while (index--) {
+            if (mInfo[index])
+               return index;
+         }
+         return GetReserved();
+      }
+      else {
+         // The sentinel guarantees that this loop ends                 
+         index = index == GetReserved() ? 0 : index + 1;
+         while (not mInfo[index])
+            ++index;
+         return index;
+      }
+   }
+
+   /// Remove an element while iterating, and get the one that follows        
+   ///   @tparam REVERSE - whether iteration is backwards                     
+   ///   @param index - the slot of the element to remove                     
+   ///   @return the slot of the next element, or the reserved count if none  
+   template<CT::Set THIS, bool REVERSE>
+   Offset BlockSet::DiscardInner(const Offset index) {
+      if constexpr (THIS::Ordered) {
+         // The following element might get shifted back by the removal 
+         const auto next = GetNextIndex<THIS, REVERSE>(index);
+         RemoveInner<THIS>(index);
+         return next == GetReserved() ? next : GetShiftedIndex(index, next);
+      }
+      else {
+         // Moving forward stays on the same slot, because the removal  
+         // might have shifted the next element into it                 
+         RemoveInner<THIS>(index);
+         if constexpr (REVERSE)
+            return GetNextIndex<THIS, true>(index);
+         else if (mInfo[index])
+            return index;
+         else
+            return GetNextIndex<THIS>(index);
+      }
+   }
+
    /// Get iterator to first element                                          
    ///   @return an iterator to the first element, or end if empty            
    template<CT::Set SET> LANGULUS(INLINED)
@@ -214,13 +302,14 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return end();
 
-      // Seek first valid info, or hit sentinel at the end              
-      auto info = GetInfo();
-      while (not *info)
-         ++info;
-
-      const auto offset = info - GetInfo();
-      return {info, GetInfoEnd(), GetRaw<SET>(offset)};
+      // Seek first valid info, or the first inserted element if        
+      // ordered                                                        
+      const auto offset = GetNextIndex<SET>(GetReserved());
+      return {
+         GetInfo() + offset, GetInfoEnd(),
+         GetRaw<SET>(offset),
+         GetOrderLink<SET>(offset)
+      };
    }
 
    /// Get iterator to the last element                                       
@@ -230,13 +319,14 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return end();
 
-      // Seek first valid info in reverse, until one past first is met  
-      auto info = GetInfoEnd();
-      while (info >= GetInfo() and not *--info)
-         ;
-
-      const auto offset = info - GetInfo();
-      return {info, GetInfoEnd(), GetRaw<SET>(offset)};
+      // Seek first valid info in reverse, or the last inserted element 
+      // if ordered                                                     
+      const auto offset = GetNextIndex<SET, true>(GetReserved());
+      return {
+         GetInfo() + offset, GetInfoEnd(),
+         GetRaw<SET>(offset),
+         GetOrderLink<SET>(offset)
+      };
    }
 
    /// Get iterator to first element                                          
@@ -246,13 +336,14 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return end();
 
-      // Seek first valid info, or hit sentinel at the end              
-      auto info = GetInfo();
-      while (not *info)
-         ++info;
-
-      const auto offset = info - GetInfo();
-      return {info, GetInfoEnd(), GetRaw<SET>(offset)};
+      // Seek first valid info, or the first inserted element if        
+      // ordered                                                        
+      const auto offset = GetNextIndex<SET>(GetReserved());
+      return {
+         GetInfo() + offset, GetInfoEnd(),
+         GetRaw<SET>(offset),
+         GetOrderLink<SET>(offset)
+      };
    }
 
    /// Get iterator to the last valid element                                 
@@ -262,13 +353,14 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return end();
 
-      // Seek first valid info in reverse, until one past first is met  
-      auto info = GetInfoEnd();
-      while (info >= GetInfo() and not *--info)
-         ;
-
-      const auto offset = info - GetInfo();
-      return {info, GetInfoEnd(), GetRaw<SET>(offset)};
+      // Seek first valid info in reverse, or the last inserted element 
+      // if ordered                                                     
+      const auto offset = GetNextIndex<SET, true>(GetReserved());
+      return {
+         GetInfo() + offset, GetInfoEnd(),
+         GetRaw<SET>(offset),
+         GetOrderLink<SET>(offset)
+      };
    }
    
    
@@ -280,37 +372,52 @@ namespace Langulus::Anyness
    ///   @param info - the info pointer                                       
    ///   @param sentinel - the end of info pointers                           
    ///   @param key - pointer/block to the key element                        
+   ///   @param order - the insertion order link, if set is ordered           
    template<class SET> LANGULUS(INLINED)
    constexpr BlockSet::Iterator<SET>::Iterator(
-      const InfoType* info, 
-      const InfoType* sentinel, 
-      const InnerT&   key
+      const InfoType*  info, 
+      const InfoType*  sentinel, 
+      const InnerT&    key,
+      const OrderType* order
    ) noexcept
       : mInfo {info}
       , mSentinel {sentinel}
-      , mKey {key} {}
+      , mKey {key}
+      , mOrder {order} {}
 
    /// Construct from end point                                               
    template<class SET> LANGULUS(INLINED)
    constexpr BlockSet::Iterator<SET>::Iterator(const A::IteratorEnd&) noexcept
       : mInfo {}
       , mSentinel {}
-      , mKey {} {}
+      , mKey {}
+      , mOrder {} {}
 
    /// Prefix increment operator                                              
    /// Moves pointers to the right, unless end has been reached               
+   /// Ordered sets follow the insertion order links instead, and reach the   
+   /// sentinel when the anchor is reached                                    
    ///   @return the modified iterator                                        
    template<class SET> LANGULUS(INLINED)
    constexpr BlockSet::Iterator<SET>& BlockSet::Iterator<SET>::operator ++ () noexcept {
       if (mInfo == mSentinel)
          return *this;
 
-      // Seek next valid info, or hit sentinel at the end               
-      const auto previous = mInfo;
-      while (not *++mInfo)
-         ;
+      if constexpr (SET::Ordered) {
+         // Links are relative, so just follow them                     
+         const auto offset = static_cast<::std::ptrdiff_t>(*mOrder);
+         mOrder += offset;
+         mInfo += offset;
+         mKey += offset;
+      }
+      else {
+         // Seek next valid info, or hit sentinel at the end            
+         const auto previous = mInfo;
+         while (not *++mInfo)
+            ;
 
-      mKey += mInfo - previous;
+         mKey += mInfo - previous;
+      }
       return *this;
    }
 
@@ -363,7 +470,7 @@ namespace Langulus::Anyness
    /// Implicitly convert to a constant iterator                              
    template<class SET> LANGULUS(INLINED)
    constexpr BlockSet::Iterator<SET>::operator Iterator<const SET>() const noexcept requires Mutable {
-      return {mInfo, mSentinel, mKey};
+      return {mInfo, mSentinel, mKey, mOrder};
    }
 
 } // namespace Langulus::Anyness
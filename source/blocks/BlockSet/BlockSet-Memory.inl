@@ -103,51 +103,51 @@ namespace Langulus::Anyness
 
       // If reached, then keys are newly allocated                      
       ZeroMemory(mInfo, count);
-      if (not old.mKeys) {
-         // There are no old values, the previous set was empty         
-         // Just do an early return right here                          
-         return;
-      }
+      OrderReset<THIS>();
 
-      // If reached, then keys moved - reinsert all keys to rehash     
+      // If reached, then keys moved - reinsert all keys to rehash -    
+      // ordered sets reinsert them in the order they were originally   
+      // inserted, to retain it                                         
       mKeys.mCount = 0;
       
-      auto key = old.GetHandle<THIS>(0);
       const auto hashmask = GetReserved() - 1;
-      const auto oldInfoEnd = old.GetInfoEnd();
-      while (old.mInfo != oldInfoEnd) {
-         if (*old.mInfo) {
-            if constexpr (CT::Typed<THIS>) {
-               InsertInner<THIS, false>(
-                  GetBucket(hashmask, key.Get()),
-                  Abandon(key)
-               );
-               key.FreeInner();
-            }
-            else {
-               InsertBlockInner<THIS, false>(
-                  GetBucketUnknown(hashmask, key),
-                  Abandon(key)
-               );
+      const auto oldEnd = old.GetReserved();
+      auto index = old.IsEmpty() ? oldEnd : old.GetNextIndex<THIS>(oldEnd);
+
+      while (index != oldEnd) {
+         auto key = old.GetHandle<THIS>(index);
+
+         if constexpr (CT::Typed<THIS>) {
+            InsertInner<THIS, false>(
+               GetBucket(hashmask, key.Get()),
+               Abandon(key)
+            );
+            key.FreeInner();
+         }
+         else {
+            InsertBlockInner<THIS, false>(
+               GetBucketUnknown(hashmask, key),
+               Abandon(key)
+            );
 
-               if (key)
-                  key.FreeInner();
-               else
-                  key.mCount = 1;
-            }
+            if (key)
+               key.FreeInner();
+            else
+               key.mCount = 1;
          }
 
-         ++key;
-         ++old.mInfo;
+         index = old.GetNextIndex<THIS>(index);
       }
 
       // Free the old allocations                                       
       if (old.mKeys.mEntry and old.mKeys.mEntry != mKeys.mEntry) {
-         // Not reusing, so either deallocate, or dereference           
-         if (old.mKeys.mEntry->GetUses() > 1)
-            const_cast<Allocation*>(old.mKeys.mEntry)->Free();
-         else
-            Allocator::Deallocate(const_cast<Allocation*>(old.mKeys.mEntry));
+         // Not reusing, so dereference, and deallocate if this turns   
+         // out to be the last reference - elements were already moved  
+         const auto entry = const_cast<Allocation*>(old.mKeys.mEntry);
+         if (not entry->Free()) {
+            entry->Keep();
+            Allocator::Deallocate(entry);
+         }
       }
    }
 
@@ -163,10 +163,59 @@ namespace Langulus::Anyness
          return;
 
       // Allocate/Reallocate the keys and info                          
-      if (IsAllocated() and GetUses() == 1)
-         AllocateData<THIS, true>(count);
-      else
-         AllocateData<THIS, false>(count);
+      // Ordered sets are always reinserted into fresh memory, because  
+      // rehashing in place doesn't retain the insertion order          
+      if constexpr (not THIS::Ordered) {
+         if (IsAllocated() and GetUses() == 1) {
+            AllocateData<THIS, true>(count);
+            return;
+         }
+      }
+
+      AllocateData<THIS, false>(count);
+   }
+
+   /// Rebuild an ordered set, that was transferred from an unordered one     
+   /// The elements are reinserted in the order they're stored in, which      
+   /// becomes their insertion order. The transferred memory is released      
+   /// afterwards                                                             
+   ///   @attention assumes THIS is ordered, and set is not empty             
+   template<CT::Set THIS>
+   void BlockSet::Reorder() {
+      static_assert(THIS::Ordered, "Reordering an unordered set");
+      LANGULUS_ASSUME(DevAssumes, not IsEmpty(), "Reordering an empty set");
+
+      BlockSet old = *this;
+      AllocateFresh<THIS>(old.GetReserved());
+      ZeroMemory(mInfo, GetReserved());
+      mInfo[GetReserved()] = 1;
+      OrderReset<THIS>();
+      mKeys.mCount = 0;
+
+      // The old memory might be shared or disowned, so elements are    
+      // always referred, and never moved                               
+      const auto hashmask = GetReserved() - 1;
+      for (Offset index = 0; index < old.GetReserved(); ++index) {
+         if (not old.mInfo[index])
+            continue;
+
+         auto key = old.GetHandle<THIS>(index);
+         if constexpr (CT::Typed<THIS>) {
+            InsertInner<THIS, false>(
+               GetBucket(hashmask, key.Get()),
+               Refer(key)
+            );
+         }
+         else {
+            InsertBlockInner<THIS, false>(
+               GetBucketUnknown(hashmask, key),
+               Refer(key)
+            );
+         }
+      }
+
+      // Dereference, or destroy the old elements                       
+      old.Free<THIS>();
    }
    
    /// Reference memory block once                                            
@@ -201,10 +250,7 @@ namespace Langulus::Anyness
       }
       else {
          // Dereference memory                                          
-         if (not IsEmpty())
-            GetValues<THIS>().template FreeInner<false>(mInfo);
-
-         const_cast<Allocation*>(mKeys.mEntry)->Free();
+         GetValues<THIS>().FreeShared(mInfo);
       }
 
       mKeys.mEntry = nullptr;
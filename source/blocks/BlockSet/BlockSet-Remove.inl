@@ -74,21 +74,26 @@ namespace Langulus::Anyness
       ++key;
 
       *(psl++) = 0;
+      OrderUnlink<THIS>(index);
 
       // And shift backwards, until a zero or 1 is reached              
       // That way we move every entry that is far from its start        
       // closer to it. Moving is costly, unless you use pointers        
+      const auto prints = GetFingerprints();
       try_again:
       while (*psl > 1) {
          psl[-1] = (*psl) - 1;
+         const Offset i = psl - GetInfo();
+         if constexpr (Fingerprints)
+            prints[i - 1] = prints[i];
+         OrderMove<THIS>(i, i - 1);
 
          #if LANGULUS_COMPILER_GCC()
             #pragma GCC diagnostic push
             #pragma GCC diagnostic ignored "-Wplacement-new"
          #endif
 
-         (key--).CreateWithIntent(Abandon(key));
-         key.FreeInner();
+         (key--).RelocateFrom(key);
          ++key;
 
          #if LANGULUS_COMPILER_GCC()
@@ -104,12 +109,14 @@ namespace Langulus::Anyness
          const auto last = mKeys.mReserved - 1;
          psl = GetInfo();
          GetInfo()[last] = (*psl) - 1;
+         if constexpr (Fingerprints)
+            prints[last] = prints[0];
+         OrderMove<THIS>(0, last);
 
          // Shift first entry to the back                               
          key = GetHandle<THIS>(0);
          auto lastkey = GetHandle<THIS>(last);
-         lastkey.CreateWithIntent(Abandon(key));
-         key.FreeInner();
+         lastkey.RelocateFrom(key);
          ++key;
 
          *(psl++) = 0;
@@ -122,6 +129,25 @@ namespace Langulus::Anyness
       --mKeys.mCount;
    }
 
+   /// Find where a slot ended up, after an element was removed. Elements     
+   /// that followed the removed one in its cluster are shifted one slot back 
+   ///   @param removed - the slot of the removed element                     
+   ///   @param index - the slot, as it was before the removal                
+   ///   @return the slot after the removal                                   
+   LANGULUS(INLINED)
+   Offset BlockSet::GetShiftedIndex(const Offset removed, const Offset index) const noexcept {
+      // After shifting, the first empty slot marks the cluster's end   
+      const auto hashmask = GetReserved() - 1;
+      auto empty = removed;
+      while (mInfo[empty])
+         empty = (empty + 1) & hashmask;
+
+      const auto distance = (index - removed) & hashmask;
+      if (distance and distance <= ((empty - removed) & hashmask))
+         return (index - 1) & hashmask;
+      return index;
+   }
+
    /// Clears all data, but doesn't deallocate                                
    template<CT::Set THIS> LANGULUS(INLINED)
    void BlockSet::Clear() {
@@ -134,15 +160,15 @@ namespace Langulus::Anyness
 
          // Clear all info to zero                                      
          ZeroMemory(mInfo, GetReserved());
+         OrderReset<THIS>();
          mKeys.mCount = 0;
       }
       else {
          // Data is used from multiple locations, don't change data     
          // We're forced to dereference and reset memory pointers       
-         GetValues<THIS>().template FreeInner<false>(mInfo);
+         GetValues<THIS>().FreeShared(mInfo);
 
          mInfo = nullptr;
-         const_cast<Allocation*>(mKeys.mEntry)->Free();
          mKeys.ResetMemory();
       }
    }
@@ -161,10 +187,7 @@ namespace Langulus::Anyness
          }
          else {
             // Data is used from multiple locations, just deref values  
-            if (not IsEmpty())
-               GetValues<THIS>().template FreeInner<false>(mInfo);
-
-            const_cast<Allocation*>(mKeys.mEntry)->Free();
+            GetValues<THIS>().FreeShared(mInfo);
          }
 
          mInfo = nullptr;
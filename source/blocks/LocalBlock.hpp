@@ -0,0 +1,80 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Block.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Local block                                                          
+   ///                                                                        
+   ///   A single element of type T, kept in a local allocation on the stack, 
+   /// and interfaced as a type-erased Block through GetBlock(). Used by      
+   /// type-erased maps and sets to hold the key and value while inserting,   
+   /// so that neither them, nor the robin-hood swaps, have to allocate.      
+   ///   Elements bigger than LANGULUS_LOCAL_HANDLE_SIZE are allocated on the 
+   /// heap instead. The element is destroyed with the local block.           
+   ///                                                                        
+   template<class T>
+   class LocalBlock {
+      static_assert(CT::NotHandle<T>, "Local blocks can't contain handles");
+
+      // Sparse elements need room for their entry, too                 
+      static constexpr Offset Bytes = CT::Sparse<T>
+         ? sizeof(void*) * 2 : sizeof(T);
+
+      LocalAllocation<Bytes <= LANGULUS_LOCAL_HANDLE_SIZE ? Bytes : 0> mLocal;
+      Block<> mBlock;
+
+   public:
+      LocalBlock(DMeta, auto&&);
+      LocalBlock(const LocalBlock&) = delete;
+      LocalBlock(LocalBlock&&) = delete;
+      ~LocalBlock();
+
+      LocalBlock& operator = (const LocalBlock&) = delete;
+      LocalBlock& operator = (LocalBlock&&) = delete;
+
+      NOD() Block<>& GetBlock() noexcept;
+   };
+
+
+   /// Create the element inside the local block                              
+   ///   @attention assumes T is binary compatible with the provided type     
+   ///   @param type - the type of the container we're inserting into         
+   ///   @param value - the value to construct with, with or without intent   
+   template<class T>
+   LocalBlock<T>::LocalBlock(DMeta type, auto&& value)
+      : mBlock {DataState::Default, type} {
+      using S = IntentOf<decltype(value)>;
+      if (not mBlock.AllocateLocal(mLocal, 1))
+         mBlock.AllocateFresh(mBlock.RequestSize(1));
+
+      mBlock.template GetHandle<T>().CreateWithIntent(S::Nest(value));
+      mBlock.mCount = 1;
+   }
+
+   /// Destroy the element, and release the memory if it wasn't local         
+   template<class T>
+   LocalBlock<T>::~LocalBlock() {
+      if (mBlock.mCount)
+         mBlock.FreeInner();
+      if (mBlock.mEntry != mLocal.GetEntry())
+         Allocator::Deallocate(const_cast<Allocation*>(mBlock.mEntry));
+   }
+
+   /// Interface the element as a type-erased block                           
+   ///   @return the block, that can be swapped with container elements       
+   template<class T> LANGULUS(INLINED)
+   Block<>& LocalBlock<T>::GetBlock() noexcept {
+      return mBlock;
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,81 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Bytes.hpp"
+#include <cstdio>
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Streaming binary deserializer                                        
+   ///                                                                        
+   ///   Deserializes what Bytes::Serialize produces, but pulls the bytes     
+   /// from a source in chunks, instead of requiring the whole payload in     
+   /// memory. Consumed bytes are discarded whenever more are pulled, so      
+   /// peak memory is bounded by the chunk size plus the deserialized data.   
+   /// Large POD arrays are copied straight into their destination, in        
+   /// pieces of Block::StreamPiece bytes.                                    
+   ///   The source is either a FILE*, opened for binary reading, or any      
+   /// callable, that fills a buffer and returns the number of bytes it       
+   /// wrote, or zero at the end of the stream. File descriptors can be       
+   /// streamed by wrapping read() in such a callable.                        
+   ///   @attention callable sources are referenced, not copied, so they      
+   ///      must outlive the stream                                           
+   ///                                                                        
+   class ByteStream : Bytes {
+   public:
+      static constexpr Count DefaultChunk = 64 * 1024;
+
+   private:
+      using Source = Count(*)(void*, Byte*, Count);
+
+      // Fills a buffer from the context, returns the number of bytes   
+      Source mSource;
+      // The file, or the callable, that is read from                   
+      void* mContext;
+      // The minimum number of bytes to pull at once                    
+      Count mChunk;
+      // The stream offset of the first byte, that is still in memory   
+      Offset mOrigin = 0;
+      // The stream offset, at which the next payload begins            
+      Offset mRead = 0;
+
+      static const Byte* Load(Block<Byte>&, Offset, Count);
+
+   public:
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      ByteStream(const ByteStream&) = delete;
+      ByteStream(ByteStream&&) = delete;
+      ByteStream(::std::FILE*, Count = DefaultChunk);
+
+      template<class F> requires (not CT::Sparse<F>
+        and requires (F& f, Byte* to, Count count) {
+           {f(to, count)} -> ::std::convertible_to<Count>;
+        })
+      ByteStream(F&, Count = DefaultChunk);
+
+      ByteStream& operator = (const ByteStream&) = delete;
+      ByteStream& operator = (ByteStream&&) = delete;
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() Offset GetOffset() const noexcept;
+      NOD() Count GetBuffered() const noexcept;
+
+      ///                                                                     
+      ///   Deserialization                                                   
+      ///                                                                     
+      NOD() Count Deserialize(CT::Data auto&);
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,114 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "ByteStream.hpp"
+#include "Bytes.inl"
+
+
+namespace Langulus::Anyness
+{
+
+   /// Stream from a file                                                     
+   ///   @param file - the file to read from, must be opened in binary mode   
+   ///   @param chunk - the minimum number of bytes to read at once           
+   LANGULUS(INLINED)
+   ByteStream::ByteStream(::std::FILE* file, const Count chunk)
+      : mSource {[](void* context, Byte* to, Count count) -> Count {
+           return ::std::fread(to, 1, count, static_cast<::std::FILE*>(context));
+        }}
+      , mContext {file}
+      , mChunk {chunk} {
+      LANGULUS_ASSERT(file, Access, "Can't stream from a null file");
+   }
+
+   /// Stream from a callable source                                          
+   ///   @param source - fills a buffer, returns the number of bytes written  
+   ///      or zero, when there's nothing more to read                        
+   ///   @param chunk - the minimum number of bytes to read at once           
+   template<class F> requires (not CT::Sparse<F>
+     and requires (F& f, Byte* to, Count count) {
+        {f(to, count)} -> ::std::convertible_to<Count>;
+     }) LANGULUS(INLINED)
+   ByteStream::ByteStream(F& source, const Count chunk)
+      : mSource {[](void* context, Byte* to, Count count) -> Count {
+           return (*static_cast<F*>(context))(to, count);
+        }}
+      , mContext {&source}
+      , mChunk {chunk} {}
+
+   /// Get the stream offset, at which the next payload begins                
+   ///   @return the number of bytes deserialized so far                      
+   LANGULUS(INLINED)
+   Offset ByteStream::GetOffset() const noexcept {
+      return mRead;
+   }
+
+   /// Get the number of bytes the stream currently holds in memory           
+   ///   @return the size of the buffer                                       
+   LANGULUS(INLINED)
+   Count ByteStream::GetBuffered() const noexcept {
+      return mReserved;
+   }
+
+   /// The loader, used by Block::DeserializeBinary                           
+   /// Bytes before the requested offset are never read again, so they are    
+   /// discarded, before pulling more bytes into the buffer                   
+   ///   @param block - the stream                                            
+   ///   @param start - stream offset of the first requested byte             
+   ///   @param count - number of requested bytes                             
+   ///   @return a pointer to the requested bytes                             
+   inline const Byte* ByteStream::Load(Block<Byte>& block, Offset start, Count count) {
+      auto& self = static_cast<ByteStream&>(block);
+      LANGULUS_ASSUME(DevAssumes, start >= self.mOrigin,
+         "Streams can't be rewound");
+
+      const auto end = self.mOrigin + self.mCount;
+      if (start + count <= end)
+         return self.mRaw + (start - self.mOrigin);
+
+      LANGULUS_ASSERT(start <= end, Access,
+         "Streams can't skip bytes");
+
+      // Move the bytes, that are still needed, to the front            
+      const auto kept = end - start;
+      if (kept)
+         ::std::memmove(self.mRaw, self.mRaw + (start - self.mOrigin), kept);
+      self.mCount = kept;
+      self.mOrigin = start;
+
+      // Pull at least a chunk, or as much as requested                 
+      const auto size = ::std::max(count, self.mChunk);
+      if (self.mReserved < size)
+         self.AllocateMore(size);
+
+      while (self.mCount < count) {
+         const auto pulled = self.mSource(self.mContext,
+            self.mRaw + self.mCount, self.mReserved - self.mCount);
+         LANGULUS_ASSERT(pulled, Access, "Unexpected end of stream");
+         self.mCount += pulled;
+      }
+
+      return self.mRaw;
+   }
+
+   /// Deserialize the next payload in the stream                             
+   ///   @param result - [out] data/container to deserialize into             
+   ///   @return the number of parsed bytes, including the header             
+   Count ByteStream::Deserialize(CT::Data auto& result) {
+      const auto start = mRead;
+      Environment env;
+      env.mOrigin = start;
+      ::std::memcpy(&env.mHeader, Load(*this, start, sizeof(Header)), sizeof(Header));
+      LANGULUS_ASSERT(env.mHeader.mVersion == Header::Version, Convert,
+         "Unsupported binary version ", env.mHeader.mVersion);
+
+      mRead = Base::DeserializeBinary<void>(result, env, start + sizeof(Header), &Load);
+      return mRead - start;
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -76,6 +76,7 @@ namespace Langulus::Anyness
    struct Bytes : Block<Byte> {
       using Base = Block<Byte>;
       static constexpr bool Ownership = true;
+      using CTTI_Relocatable = Bytes;
 
       LANGULUS(DEEP) false;
       LANGULUS(ACT_AS) Bytes;
@@ -166,6 +167,7 @@ namespace Langulus::Anyness
       ///                                                                     
       ///   Deserialization                                                   
       ///                                                                     
+      template<bool VIEW = false>
       NOD() Count Deserialize(CT::Data auto&) const;
 
       ///                                                                     
@@ -334,11 +334,27 @@ namespace Langulus::Anyness
    }
    
    /// Deserialize a byte container to a desired type                         
+   ///   @tparam VIEW - true to reference dense POD, texts and bytes in this  
+   ///      container, instead of copying them - if this container doesn't    
+   ///      own its memory, the memory must outlive the result, and only      
+   ///      views into a MappedFile take authority, when changed              
    ///   @tparam result - [out] data/container to deserialize into            
-   ///   @return the number of parsed bytes                                   
+   ///   @return the number of parsed bytes, including the header             
+   template<bool VIEW>
    Count Bytes::Deserialize(CT::Data auto& result) const {
-      Header header;
-      return Base::DeserializeBinary<void>(result, header);
+      Environment env;
+      env.mView = VIEW;
+      LANGULUS_ASSERT(mCount >= sizeof(Header), Convert,
+         "Binary data is too small to contain a header");
+      ::std::memcpy(&env.mHeader, GetRaw(), sizeof(Header));
+      LANGULUS_ASSERT(env.mHeader.mVersion == Header::Version, Convert,
+         "Unsupported binary version ", env.mHeader.mVersion);
+
+      // Most definitions are data types, so reserve for them upfront   
+      // Each one takes at least two bytes, which caps corrupted counts 
+      env.DefinitionsOf<DMeta>().reserve(::std::min(
+         static_cast<Count>(env.mHeader.mDefinitionCount), mCount / 2));
+      return Base::DeserializeBinary<void>(result, env, sizeof(Header));
    }
 
    /// Byte container can always be represented by a type-erased one          
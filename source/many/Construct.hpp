@@ -34,6 +34,7 @@ namespace Langulus::Anyness
 
    public:
       static constexpr bool Ownership = true;
+      using CTTI_Relocatable = Construct;
 
       constexpr Construct() noexcept = default;
       Construct(const Construct&) noexcept;
@@ -51,6 +51,7 @@ namespace Langulus::Anyness
 
    public:
       static constexpr bool Ownership = true;
+      using CTTI_Relocatable = Many;
 
       ///                                                                     
       ///   Construction                                                      
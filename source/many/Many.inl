@@ -19,6 +19,9 @@
 #include "../blocks/Block/Block-Insert.inl"
 #include "../blocks/Block/Block-Convert.inl"
 #include "../blocks/Block/Block-Compare.inl"
+#include "../blocks/Block/Block-Sort.inl"
+#include "../blocks/Block/Block-Parallel.inl"
+#include "../blocks/Block/Block-Compress.inl"
 #include "../blocks/Block/Block-Describe.inl"
 
 
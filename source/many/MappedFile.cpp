@@ -0,0 +1,189 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "MappedFile.hpp"
+#include <string>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+#include <algorithm>
+
+#if defined(_WIN32)
+   #define WIN32_LEAN_AND_MEAN
+   #define NOMINMAX
+   #include <windows.h>
+#else
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+
+namespace Langulus::Anyness
+{
+   namespace
+   {
+
+      /// Ranges of all mapped files, shared by all threads                   
+      /// Mappings never overlap, so ranges are kept sorted by their start,   
+      /// and a lookup is a binary search                                     
+      struct MappedRanges {
+         using Range = ::std::pair<const Byte*, Count>;
+
+         // Number of ranges, so that lookups don't lock, while nothing 
+         // is mapped, which is most of the time                        
+         ::std::atomic<Count> mCount {0};
+         // Lookups only read the ranges, so they can share the lock    
+         ::std::shared_mutex mMutex;
+         ::std::vector<Range> mRanges;
+
+         /// Get the first range, that starts after some memory               
+         ///   @param at - the memory to search for                           
+         ///   @return the iterator to the range                              
+         auto After(const Byte* at) const noexcept {
+            return ::std::upper_bound(mRanges.begin(), mRanges.end(), at,
+               [](const Byte* lhs, const Range& rhs) {
+                  return ::std::less<const Byte*> {}(lhs, rhs.first);
+               });
+         }
+      };
+
+      /// Get the mapped ranges, created on first use                         
+      /// They are never destroyed, so that static mappings can be unmapped   
+      ///   @return the mapped ranges                                         
+      MappedRanges& GetMappedRanges() {
+         static const auto ranges = new MappedRanges;
+         return *ranges;
+      }
+
+   } // anonymous namespace
+
+   /// Check if memory is inside a MappedFile                                 
+   ///   @param memory - the memory to check                                  
+   ///   @return true if memory is inside any mapping                         
+   bool IsMapped(const void* memory) noexcept {
+      if (not memory)
+         return false;
+
+      auto& mapped = GetMappedRanges();
+      if (not mapped.mCount.load(::std::memory_order_acquire))
+         return false;
+
+      // Only the range, that starts right before the memory, can       
+      // contain it                                                     
+      const auto at = static_cast<const Byte*>(memory);
+      const ::std::shared_lock lock {mapped.mMutex};
+      const auto after = mapped.After(at);
+      if (after == mapped.mRanges.begin())
+         return false;
+
+      const auto [raw, count] = *(after - 1);
+      return at < raw + count;
+   }
+
+   /// Map a file into memory                                                 
+   /// Empty files are valid, but nothing is mapped for them                  
+   ///   @param path - the file to map                                        
+   MappedFile::MappedFile(const Token& path) {
+      const ::std::string filename {path};
+
+   #if defined(_WIN32)
+      const auto file = ::CreateFileA(filename.c_str(), GENERIC_READ,
+         FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      LANGULUS_ASSERT(file != INVALID_HANDLE_VALUE, Access,
+         "Can't open file `", path, '`');
+
+      LARGE_INTEGER size;
+      if (not ::GetFileSizeEx(file, &size)) {
+         ::CloseHandle(file);
+         LANGULUS_OOPS(Access, "Can't get the size of file `", path, '`');
+      }
+
+      if (not size.QuadPart) {
+         ::CloseHandle(file);
+         return;
+      }
+
+      // The view keeps both the mapping and the file alive, so their   
+      // handles aren't needed after it is created                      
+      const auto mapping = ::CreateFileMappingA(
+         file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+      ::CloseHandle(file);
+      LANGULUS_ASSERT(mapping, Access, "Can't map file `", path, '`');
+
+      const auto memory = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+      ::CloseHandle(mapping);
+      LANGULUS_ASSERT(memory, Access, "Can't map file `", path, '`');
+      mRaw = static_cast<Byte*>(memory);
+      mCount = static_cast<Count>(size.QuadPart);
+   #else
+      const auto file = ::open(filename.c_str(), O_RDONLY);
+      LANGULUS_ASSERT(file >= 0, Access, "Can't open file `", path, '`');
+
+      struct stat info;
+      if (::fstat(file, &info) != 0) {
+         ::close(file);
+         LANGULUS_OOPS(Access, "Can't get the size of file `", path, '`');
+      }
+
+      if (info.st_size <= 0) {
+         ::close(file);
+         return;
+      }
+
+      // The mapping keeps the file alive, so it can be closed          
+      const auto size = static_cast<Count>(info.st_size);
+      const auto memory = ::mmap(nullptr, size,
+         PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+      ::close(file);
+      LANGULUS_ASSERT(memory != MAP_FAILED, Access, "Can't map file `", path, '`');
+      mRaw = static_cast<Byte*>(memory);
+      mCount = size;
+   #endif
+
+      // Register the mapping, so that views into it can be told apart  
+      // from other static blocks - see Block::BranchOut                
+      try {
+         auto& mapped = GetMappedRanges();
+         const ::std::unique_lock lock {mapped.mMutex};
+         mapped.mRanges.emplace(mapped.After(mRaw), mRaw, mCount);
+         mapped.mCount.store(mapped.mRanges.size(), ::std::memory_order_release);
+      }
+      catch (...) {
+         Unmap();
+         throw;
+      }
+   }
+
+   /// Unmap the file, if mapped                                              
+   void MappedFile::Unmap() noexcept {
+      if (not mRaw)
+         return;
+
+      {
+         auto& mapped = GetMappedRanges();
+         const ::std::unique_lock lock {mapped.mMutex};
+         const auto after = mapped.After(mRaw);
+         if (after != mapped.mRanges.begin() and (after - 1)->first == mRaw) {
+            mapped.mRanges.erase(after - 1);
+            mapped.mCount.store(mapped.mRanges.size(), ::std::memory_order_release);
+         }
+      }
+
+   #if defined(_WIN32)
+      ::UnmapViewOfFile(mRaw);
+   #else
+      ::munmap(mRaw, mCount);
+   #endif
+      mRaw = nullptr;
+      mCount = 0;
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
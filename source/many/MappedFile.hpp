@@ -0,0 +1,63 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Bytes.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   A file, mapped into memory                                           
+   ///                                                                        
+   ///   Exposes the contents of a file as Bytes, without reading them, so    
+   /// that serialized data can be deserialized with zero copies - dense POD, 
+   /// texts and bytes are referenced in the mapping, and pages are loaded    
+   /// by the system only when they're accessed. Pages are mapped copy-on-    
+   /// write, so that nothing is ever written back to the file.               
+   ///   The mapped bytes are out of jurisdiction, so containers, that        
+   /// reference them, take authority over their elements before they are     
+   /// changed in any way.                                                    
+   ///   @attention containers, that reference the mapping, must not outlive  
+   ///      it - copy them, if you need them for longer                       
+   ///                                                                        
+   class MappedFile {
+      // The first mapped byte                                          
+      Byte* mRaw {};
+      // The number of mapped bytes                                     
+      Count mCount {};
+
+      LANGULUS_API(ANYNESS) void Unmap() noexcept;
+
+   public:
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      constexpr MappedFile() noexcept = default;
+      MappedFile(const MappedFile&) = delete;
+      MappedFile(MappedFile&&) noexcept;
+      LANGULUS_API(ANYNESS) explicit MappedFile(const Token&);
+      ~MappedFile();
+
+      MappedFile& operator = (const MappedFile&) = delete;
+      MappedFile& operator = (MappedFile&&) noexcept;
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() Count GetCount() const noexcept;
+      NOD() bool IsEmpty() const noexcept;
+      NOD() Bytes GetBytes() const;
+
+      ///                                                                     
+      ///   Deserialization                                                   
+      ///                                                                     
+      NOD() Count Deserialize(CT::Data auto&) const;
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,76 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "MappedFile.hpp"
+#include "Bytes.inl"
+
+
+namespace Langulus::Anyness
+{
+
+   /// Move constructor                                                       
+   ///   @param other - the mapping to move, left empty                       
+   LANGULUS(INLINED)
+   MappedFile::MappedFile(MappedFile&& other) noexcept
+      : mRaw {other.mRaw}
+      , mCount {other.mCount} {
+      other.mRaw = nullptr;
+      other.mCount = 0;
+   }
+
+   /// Unmap the file                                                         
+   LANGULUS(INLINED)
+   MappedFile::~MappedFile() {
+      Unmap();
+   }
+
+   /// Move assignment                                                        
+   ///   @param rhs - the mapping to move, left empty                         
+   ///   @return a reference to this mapping                                  
+   LANGULUS(INLINED)
+   MappedFile& MappedFile::operator = (MappedFile&& rhs) noexcept {
+      if (this != &rhs) {
+         Unmap();
+         mRaw = rhs.mRaw;
+         mCount = rhs.mCount;
+         rhs.mRaw = nullptr;
+         rhs.mCount = 0;
+      }
+      return *this;
+   }
+
+   /// Get the size of the file                                               
+   ///   @return the number of mapped bytes                                   
+   LANGULUS(INLINED)
+   Count MappedFile::GetCount() const noexcept {
+      return mCount;
+   }
+
+   /// Check if nothing is mapped                                             
+   ///   @return true if the file is empty, or no file was mapped             
+   LANGULUS(INLINED)
+   bool MappedFile::IsEmpty() const noexcept {
+      return not mCount;
+   }
+
+   /// Interface the mapped bytes, without copying them                       
+   ///   @return a static view of the mapping                                 
+   LANGULUS(INLINED)
+   Bytes MappedFile::GetBytes() const {
+      return Bytes::From(Disown(static_cast<const Byte*>(mRaw)), mCount);
+   }
+
+   /// Deserialize the file, referencing everything possible in place         
+   ///   @param result - [out] data/container to deserialize into             
+   ///   @return the number of parsed bytes, including the header             
+   LANGULUS(INLINED)
+   Count MappedFile::Deserialize(CT::Data auto& result) const {
+      return GetBytes().template Deserialize<true>(result);
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
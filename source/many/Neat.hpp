@@ -59,6 +59,7 @@ namespace Langulus::Anyness
       //LANGULUS(DEEP) true;
       static constexpr bool Ownership = true;
       static constexpr bool CTTI_Container = true;
+      using CTTI_Relocatable = Neat;
 
       ///                                                                     
       ///   Construction                                                      
@@ -1223,7 +1223,7 @@ namespace Langulus::Anyness
             if (group.IsValid())
                group.SerializeToText<void>(to);
             else
-               to += static_cast<OUT>(pair.mKey);
+               to += static_cast<CT::SerialItem<OUT>>(pair.mKey);
             separator = true;
          }
       }
@@ -1236,7 +1236,7 @@ namespace Langulus::Anyness
             if (trait.IsValid())
                trait.Serialize(to);
             else
-               to += static_cast<OUT>(pair.mKey);
+               to += static_cast<CT::SerialItem<OUT>>(pair.mKey);
             separator = true;
          }
       }
@@ -1250,7 +1250,7 @@ namespace Langulus::Anyness
             or not construct.GetCharge().IsDefault())
                construct.Serialize(to);
             else
-               to += static_cast<OUT>(pair.mKey);
+               to += static_cast<CT::SerialItem<OUT>>(pair.mKey);
             separator = true;
          }
       }
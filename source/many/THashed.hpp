@@ -0,0 +1,103 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Bytes.hpp"
+#include "../text/Text.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   A container with a cached hash                                       
+   ///                                                                        
+   ///   Wraps a Text, Bytes, or any other statically typed block, and keeps  
+   /// its hash after it's computed once, the same way Neat and Construct     
+   /// do. Useful for long keys, that are searched for repeatedly. The hash   
+   /// is reset by every mutating operation, that goes through the wrapper.   
+   ///   The wrapped container stays binary-compatible with Block, the cache  
+   /// lives next to it. Read-only access is unrestricted, but writing to     
+   /// the contents directly requires Edit(), which makes sure the memory is  
+   /// not shared with other containers, whose cached hashes would become     
+   /// invalid otherwise.                                                     
+   ///                                                                        
+   template<CT::Block T> requires (not CT::TypeErased<T>)
+   class THashed {
+      // The wrapped container                                          
+      T mData;
+      // The cached hash, zero if not computed yet                      
+      mutable Hash mHash;
+
+   public:
+      static constexpr bool Ownership = true;
+
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      constexpr THashed() = default;
+      THashed(const THashed&) = default;
+      THashed(THashed&&) noexcept;
+
+      template<class T1, class...TN>
+      requires (::std::constructible_from<T, T1, TN...>
+           and not CT::Similar<Deref<T1>, THashed<T>>)
+      THashed(T1&&, TN&&...);
+
+      THashed& operator = (const THashed&) = default;
+      THashed& operator = (THashed&&) noexcept;
+
+      template<class T1> requires (::std::assignable_from<T&, T1>
+           and not CT::Similar<Deref<T1>, THashed<T>>)
+      THashed& operator = (T1&&);
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() constexpr const T& Get() const noexcept;
+      NOD() constexpr const T* operator -> () const noexcept;
+      NOD() constexpr operator const T& () const noexcept;
+      NOD() constexpr bool IsHashed() const noexcept;
+
+      NOD() T& Edit();
+
+      ///                                                                     
+      ///   Comparison                                                        
+      ///                                                                     
+      NOD() Hash GetHash() const;
+
+      bool operator == (const THashed&) const;
+      template<class T1> requires (requires (const T& a, const T1& b) { a == b; }
+           and not CT::Similar<Deref<T1>, THashed<T>>)
+      bool operator == (const T1&) const;
+
+      ///                                                                     
+      ///   Insertion                                                         
+      ///                                                                     
+      template<class T1> requires requires (T& a, T1&& b) { a << Forward<T1>(b); }
+      THashed& operator << (T1&&);
+      template<class T1> requires requires (T& a, T1&& b) { a >> Forward<T1>(b); }
+      THashed& operator >> (T1&&);
+      template<class T1> requires requires (T& a, T1&& b) { a += Forward<T1>(b); }
+      THashed& operator += (T1&&);
+
+      NOD() T Extend(Count);
+
+      ///                                                                     
+      ///   Removal                                                           
+      ///                                                                     
+      void Clear();
+      void Reset();
+   };
+
+   /// Text with a cached hash                                                
+   using HashedText = THashed<Text>;
+
+   /// Bytes with a cached hash                                               
+   using HashedBytes = THashed<Bytes>;
+
+} // namespace Langulus::Anyness
\ No newline at end of file
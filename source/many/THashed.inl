@@ -0,0 +1,193 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "THashed.hpp"
+#include "Bytes.inl"
+#include "../text/Text.inl"
+
+#define TEMPLATE()   template<CT::Block T> requires (not CT::TypeErased<T>)
+#define TME()        THashed<T>
+
+
+namespace Langulus::Anyness
+{
+
+   /// Move constructor                                                       
+   /// The moved container is left empty, so its hash is reset, too           
+   ///   @param other - the container to move                                 
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::THashed(THashed&& other) noexcept
+      : mData {::std::move(other.mData)}
+      , mHash {other.mHash} {
+      other.mHash = {};
+   }
+
+   /// Construct the wrapped container from any arguments it accepts          
+   ///   @param t1 - first argument                                           
+   ///   @param tn - the rest of the arguments                                
+   TEMPLATE() template<class T1, class...TN>
+   requires (::std::constructible_from<T, T1, TN...>
+        and not CT::Similar<Deref<T1>, THashed<T>>) LANGULUS(INLINED)
+   TME()::THashed(T1&& t1, TN&&...tn)
+      : mData (Forward<T1>(t1), Forward<TN>(tn)...) {}
+
+   /// Move assignment                                                        
+   ///   @param rhs - the container to move                                   
+   ///   @return a reference to this container                                
+   TEMPLATE() LANGULUS(INLINED)
+   TME()& TME()::operator = (THashed&& rhs) noexcept {
+      mData = ::std::move(rhs.mData);
+      mHash = rhs.mHash;
+      rhs.mHash = {};
+      return *this;
+   }
+
+   /// Assign anything the wrapped container accepts                          
+   ///   @param rhs - the value to assign                                     
+   ///   @return a reference to this container                                
+   TEMPLATE() template<class T1> requires (::std::assignable_from<T&, T1>
+        and not CT::Similar<Deref<T1>, THashed<T>>) LANGULUS(INLINED)
+   TME()& TME()::operator = (T1&& rhs) {
+      mData = Forward<T1>(rhs);
+      mHash = {};
+      return *this;
+   }
+
+   /// Get the wrapped container for reading                                  
+   ///   @return a constant reference to the container                        
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   constexpr const T& TME()::Get() const noexcept {
+      return mData;
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   constexpr const T* TME()::operator -> () const noexcept {
+      return &mData;
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   constexpr TME()::operator const T& () const noexcept {
+      return mData;
+   }
+
+   /// Check if the hash is currently cached                                  
+   ///   @return true if GetHash() won't need to hash the contents            
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   constexpr bool TME()::IsHashed() const noexcept {
+      return static_cast<bool>(mHash);
+   }
+
+   /// Get the wrapped container for writing                                  
+   /// Resets the cached hash, and branches out, if memory is shared, so      
+   /// that other containers (and their cached hashes) are not affected       
+   ///   @attention the hash is reset only once - don't keep the reference    
+   ///      around, when hashing the container in between writes              
+   ///   @return a mutable reference to the container                         
+   TEMPLATE() LANGULUS(INLINED)
+   T& TME()::Edit() {
+      if (mData.GetUses() > 1) {
+         T branched {Copy(mData)};
+         mData = ::std::move(branched);
+      }
+
+      mHash = {};
+      return mData;
+   }
+
+   /// Get the hash of the contents, computing it only if not cached          
+   ///   @return the hash                                                     
+   TEMPLATE() LANGULUS(INLINED)
+   Hash TME()::GetHash() const {
+      if (not mHash)
+         mHash = mData.GetHash();
+      return mHash;
+   }
+
+   /// Compare with another container with a cached hash                      
+   /// Hashes are compared first, if both are already cached, which rejects   
+   /// most mismatches without touching the contents                          
+   ///   @param rhs - the container to compare with                           
+   ///   @return true if contents are the same                                
+   TEMPLATE() LANGULUS(INLINED)
+   bool TME()::operator == (const THashed& rhs) const {
+      if (mHash and rhs.mHash and mHash != rhs.mHash)
+         return false;
+      return mData == rhs.mData;
+   }
+
+   /// Compare contents with anything the wrapped container compares with     
+   ///   @param rhs - the value to compare with                               
+   ///   @return true if contents are the same                                
+   TEMPLATE() template<class T1> requires (requires (const T& a, const T1& b) { a == b; }
+        and not CT::Similar<Deref<T1>, THashed<T>>) LANGULUS(INLINED)
+   bool TME()::operator == (const T1& rhs) const {
+      return mData == rhs;
+   }
+
+   /// Insert at the back of the contents                                     
+   ///   @param rhs - what to insert                                          
+   ///   @return a reference to this container for chaining                   
+   TEMPLATE() template<class T1>
+   requires requires (T& a, T1&& b) { a << Forward<T1>(b); } LANGULUS(INLINED)
+   TME()& TME()::operator << (T1&& rhs) {
+      mData << Forward<T1>(rhs);
+      mHash = {};
+      return *this;
+   }
+
+   /// Insert at the front of the contents                                    
+   ///   @param rhs - what to insert                                          
+   ///   @return a reference to this container for chaining                   
+   TEMPLATE() template<class T1>
+   requires requires (T& a, T1&& b) { a >> Forward<T1>(b); } LANGULUS(INLINED)
+   TME()& TME()::operator >> (T1&& rhs) {
+      mData >> Forward<T1>(rhs);
+      mHash = {};
+      return *this;
+   }
+
+   /// Concatenate to the contents                                            
+   ///   @param rhs - what to concatenate                                     
+   ///   @return a reference to this container for chaining                   
+   TEMPLATE() template<class T1>
+   requires requires (T& a, T1&& b) { a += Forward<T1>(b); } LANGULUS(INLINED)
+   TME()& TME()::operator += (T1&& rhs) {
+      mData += Forward<T1>(rhs);
+      mHash = {};
+      return *this;
+   }
+
+   /// Extend the contents, and get the new region for writing                
+   ///   @attention the hash is reset only once - fill the region before      
+   ///      hashing the container again                                       
+   ///   @param count - the number of elements to extend by                   
+   ///   @return the extended region                                          
+   TEMPLATE() LANGULUS(INLINED)
+   T TME()::Extend(const Count count) {
+      mHash = {};
+      return mData.Extend(count);
+   }
+
+   /// Destroy the contents, but keep the memory                              
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Clear() {
+      mData.Clear();
+      mHash = {};
+   }
+
+   /// Destroy the contents and release memory                                
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Reset() {
+      mData.Reset();
+      mHash = {};
+   }
+
+} // namespace Langulus::Anyness
+
+#undef TEMPLATE
+#undef TME
\ No newline at end of file
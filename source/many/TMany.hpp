@@ -56,6 +56,7 @@ namespace Langulus::Anyness
 
    public:
       static constexpr bool Ownership = true;
+      using CTTI_Relocatable = TMany;
       static constexpr bool Sequential = Base::Sequential;
       static constexpr bool TypeErased = Base::TypeErased;
       static constexpr bool Sparse = Base::Sparse;
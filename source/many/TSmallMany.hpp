@@ -0,0 +1,122 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TMany.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   TSmallMany                                                           
+   ///                                                                        
+   ///   A sequential container, that keeps up to N elements inside itself,   
+   /// and allocates only when it has to grow beyond that. Once it spills,    
+   /// all elements are moved into a regular TMany, and it behaves just like  
+   /// one until reset.                                                       
+   ///   Unlike TMany, this container is not binary-compatible with Block,    
+   /// because the inline elements have no memory entry to be referenced by.  
+   /// Use GetView() to interface its contents as a Block without ownership,  
+   /// or convert it to TMany, if the elements have to outlive the container. 
+   /// Hashing and comparison are consistent with TMany, so both can be used  
+   /// interchangeably as search keys.                                        
+   ///                                                                        
+   template<CT::Data T, Count N>
+   class TSmallMany {
+      static_assert(N > 0, "Inline capacity must be at least one element");
+
+      // Elements, while they fit inside the container                  
+      alignas(T) Byte mInline[sizeof(T) * N];
+      // Number of inline elements                                      
+      Count mInlineCount {};
+      // Elements, after the container has spilled                      
+      TMany<T> mHeap;
+
+      // Moving can't throw, if elements are relocated bytewise         
+      static constexpr bool NothrowMove = CT::Relocatable<T>
+         or ::std::is_nothrow_move_constructible_v<T>;
+
+      T* GetInline() noexcept;
+      T const* GetInline() const noexcept;
+      void Spill(Count);
+      void DestroyInline() noexcept;
+      void Swap(TSmallMany&) noexcept(NothrowMove);
+
+   public:
+      static constexpr Count InlineCapacity = N;
+
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      constexpr TSmallMany() noexcept {}
+      TSmallMany(const TSmallMany&);
+      TSmallMany(TSmallMany&&) noexcept(NothrowMove);
+      TSmallMany(const T*, Count);
+      ~TSmallMany();
+
+      TSmallMany& operator = (const TSmallMany&);
+      TSmallMany& operator = (TSmallMany&&) noexcept(NothrowMove);
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() constexpr bool IsInline() const noexcept;
+      NOD() Count GetCount() const noexcept;
+      NOD() Count GetReserved() const noexcept;
+      NOD() bool IsEmpty() const noexcept;
+      NOD() explicit operator bool() const noexcept;
+
+      ///                                                                     
+      ///   Indexing                                                          
+      ///                                                                     
+      NOD() T*       GetRaw() noexcept;
+      NOD() T const* GetRaw() const noexcept;
+      NOD() T&       operator [] (Offset) IF_UNSAFE(noexcept);
+      NOD() T const& operator [] (Offset) const IF_UNSAFE(noexcept);
+      NOD() T&       Last() IF_UNSAFE(noexcept);
+      NOD() T const& Last() const IF_UNSAFE(noexcept);
+
+      NOD() T*       begin() noexcept;
+      NOD() T const* begin() const noexcept;
+      NOD() T*       end() noexcept;
+      NOD() T const* end() const noexcept;
+
+      NOD() Block<T> GetView() const noexcept;
+
+      ///                                                                     
+      ///   Comparison                                                        
+      ///                                                                     
+      NOD() Hash GetHash() const;
+
+      bool operator == (const TSmallMany&) const;
+      bool operator == (const CT::Block auto&) const;
+
+      ///                                                                     
+      ///   Insertion                                                         
+      ///                                                                     
+      template<class...A> requires ::std::constructible_from<T, A...>
+      T& Emplace(A&&...);
+
+      TSmallMany& operator << (const T&);
+      TSmallMany& operator << (T&&);
+
+      void Reserve(Count);
+
+      ///                                                                     
+      ///   Removal                                                           
+      ///                                                                     
+      void Clear();
+      void Reset();
+
+      ///                                                                     
+      ///   Conversion                                                        
+      ///                                                                     
+      NOD() operator TMany<T> () const;
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,411 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TSmallMany.hpp"
+#include "TMany.inl"
+
+#define TEMPLATE()   template<CT::Data T, Count N>
+#define TME()        TSmallMany<T, N>
+
+
+namespace Langulus::Anyness
+{
+
+   /// Copy constructor                                                       
+   /// Inline elements are copied, spilled elements are referenced, exactly   
+   /// like copying a TMany would do                                          
+   ///   @param other - the container to copy                                 
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TSmallMany(const TSmallMany& other)
+      : mHeap {other.mHeap} {
+      if (not other.IsInline())
+         return;
+
+      try {
+         for (auto& element : other) {
+            new (GetInline() + mInlineCount) T (element);
+            ++mInlineCount;
+         }
+      }
+      catch (...) {
+         // The destructor won't be called for this container           
+         DestroyInline();
+         throw;
+      }
+   }
+
+   /// Move constructor                                                       
+   ///   @param other - the container to move                                 
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TSmallMany(TSmallMany&& other) noexcept(NothrowMove)
+      : mHeap {::std::move(other.mHeap)} {
+      if (not IsInline())
+         return;
+
+      if constexpr (CT::Relocatable<T>) {
+         CopyMemory(mInline, other.mInline, sizeof(T) * other.mInlineCount);
+         mInlineCount = other.mInlineCount;
+      }
+      else {
+         try {
+            for (auto& element : other) {
+               new (GetInline() + mInlineCount) T (::std::move(element));
+               ++mInlineCount;
+            }
+         }
+         catch (...) {
+            // The destructor won't be called for this container        
+            DestroyInline();
+            throw;
+         }
+
+         other.DestroyInline();
+      }
+
+      other.mInlineCount = 0;
+   }
+
+   /// Copy a contiguous range of elements                                    
+   ///   @param elements - the first element                                  
+   ///   @param count - number of elements to copy                            
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TSmallMany(const T* elements, const Count count) {
+      Reserve(count);
+      for (Count i = 0; i < count; ++i)
+         *this << elements[i];
+   }
+
+   /// Destroy inline elements, dereference spilled ones                      
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::~TSmallMany() {
+      DestroyInline();
+   }
+
+   /// Copy assignment                                                        
+   /// The copy is made before anything is released, so this container        
+   /// remains intact, if copying an element throws                           
+   ///   @param rhs - the container to copy                                   
+   ///   @return a reference to this container                                
+   TEMPLATE() LANGULUS(INLINED)
+   TME()& TME()::operator = (const TSmallMany& rhs) {
+      if (&rhs == this)
+         return *this;
+
+      TSmallMany copy {rhs};
+      return *this = ::std::move(copy);
+   }
+
+   /// Move assignment                                                        
+   /// The new contents are moved in before the old ones are released, so     
+   /// this container remains intact, if moving an element throws             
+   ///   @param rhs - the container to move                                   
+   ///   @return a reference to this container                                
+   TEMPLATE() LANGULUS(INLINED)
+   TME()& TME()::operator = (TSmallMany&& rhs) noexcept(NothrowMove) {
+      if (&rhs == this)
+         return *this;
+
+      TSmallMany moved {::std::move(rhs)};
+      Swap(moved);
+      return *this;
+   }
+
+   /// Get the inline storage, interpreted as elements                        
+   ///   @return a pointer to the first inline element                        
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T* TME()::GetInline() noexcept {
+      return ::std::launder(reinterpret_cast<T*>(mInline));
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T const* TME()::GetInline() const noexcept {
+      return ::std::launder(reinterpret_cast<T const*>(mInline));
+   }
+
+   /// Destroy all inline elements                                            
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::DestroyInline() noexcept {
+      if constexpr (not ::std::is_trivially_destructible_v<T>) {
+         for (Count i = 0; i < mInlineCount; ++i)
+            GetInline()[i].~T();
+      }
+
+      mInlineCount = 0;
+   }
+
+   /// Swap the contents of two containers                                    
+   ///   @param other - the container to swap with                            
+   TEMPLATE()
+   void TME()::Swap(TSmallMany& other) noexcept(NothrowMove) {
+      ::std::swap(mHeap, other.mHeap);
+
+      if constexpr (CT::Relocatable<T>) {
+         alignas(T) Byte temporary[sizeof(T) * N];
+         CopyMemory(temporary, mInline, sizeof(T) * mInlineCount);
+         CopyMemory(mInline, other.mInline, sizeof(T) * other.mInlineCount);
+         CopyMemory(other.mInline, temporary, sizeof(T) * mInlineCount);
+         ::std::swap(mInlineCount, other.mInlineCount);
+      }
+      else {
+         // Swap the common elements, then move the rest over to the    
+         // container with less elements                                
+         const bool less = mInlineCount < other.mInlineCount;
+         auto& to   = less ? *this : other;
+         auto& from = less ? other : *this;
+         const auto common = to.mInlineCount;
+
+         for (Count i = 0; i < common; ++i) {
+            using ::std::swap;
+            swap(to.GetInline()[i], from.GetInline()[i]);
+         }
+
+         while (to.mInlineCount < from.mInlineCount) {
+            new (to.GetInline() + to.mInlineCount)
+               T (::std::move(from.GetInline()[to.mInlineCount]));
+            ++to.mInlineCount;
+         }
+
+         for (Count i = common; i < from.mInlineCount; ++i)
+            from.GetInline()[i].~T();
+         from.mInlineCount = common;
+      }
+   }
+
+   /// Move all inline elements to the heap                                   
+   /// Elements are moved into a separate container, that replaces the heap   
+   /// only after all moves succeed, so inline elements remain owned by this  
+   /// container, if a move throws                                            
+   ///   @param count - the number of elements to reserve on the heap         
+   TEMPLATE()
+   void TME()::Spill(const Count count) {
+      LANGULUS_ASSUME(DevAssumes, IsInline(), "Container already spilled");
+      TMany<T> heap;
+      heap.Reserve(::std::max(count, N * 2));
+      for (Count i = 0; i < mInlineCount; ++i)
+         heap << ::std::move(GetInline()[i]);
+
+      DestroyInline();
+      mHeap = ::std::move(heap);
+   }
+
+   /// Check if elements are still contained inside the container             
+   ///   @return true if container hasn't allocated                           
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   constexpr bool TME()::IsInline() const noexcept {
+      return not mHeap.IsAllocated();
+   }
+
+   /// Get the number of initialized elements                                 
+   ///   @return the number of elements                                       
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   Count TME()::GetCount() const noexcept {
+      return IsInline() ? mInlineCount : mHeap.GetCount();
+   }
+
+   /// Get the number of elements that fit without allocating                 
+   ///   @return the number of reserved elements                              
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   Count TME()::GetReserved() const noexcept {
+      return IsInline() ? N : mHeap.GetReserved();
+   }
+
+   /// Check if container has no elements                                     
+   ///   @return true if empty                                                
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   bool TME()::IsEmpty() const noexcept {
+      return GetCount() == 0;
+   }
+
+   /// Check if container has any elements                                    
+   ///   @return true if not empty                                            
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   TME()::operator bool() const noexcept {
+      return not IsEmpty();
+   }
+
+   /// Get the contiguous elements, wherever they currently are               
+   ///   @return a pointer to the first element                               
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T* TME()::GetRaw() noexcept {
+      return IsInline() ? GetInline() : mHeap.GetRaw();
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T const* TME()::GetRaw() const noexcept {
+      return IsInline() ? GetInline() : mHeap.GetRaw();
+   }
+
+   /// Access an element                                                      
+   ///   @param index - the index of the element                              
+   ///   @return a reference to the element                                   
+   TEMPLATE() LANGULUS(INLINED)
+   T& TME()::operator [] (const Offset index) IF_UNSAFE(noexcept) {
+      LANGULUS_ASSUME(UserAssumes, index < GetCount(), "Index out of range");
+      return GetRaw()[index];
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   T const& TME()::operator [] (const Offset index) const IF_UNSAFE(noexcept) {
+      LANGULUS_ASSUME(UserAssumes, index < GetCount(), "Index out of range");
+      return GetRaw()[index];
+   }
+
+   /// Access the last element                                                
+   ///   @return a reference to the last element                              
+   TEMPLATE() LANGULUS(INLINED)
+   T& TME()::Last() IF_UNSAFE(noexcept) {
+      LANGULUS_ASSUME(UserAssumes, not IsEmpty(), "Container is empty");
+      return GetRaw()[GetCount() - 1];
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   T const& TME()::Last() const IF_UNSAFE(noexcept) {
+      LANGULUS_ASSUME(UserAssumes, not IsEmpty(), "Container is empty");
+      return GetRaw()[GetCount() - 1];
+   }
+
+   /// Iteration                                                              
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T* TME()::begin() noexcept {
+      return GetRaw();
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T const* TME()::begin() const noexcept {
+      return GetRaw();
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T* TME()::end() noexcept {
+      return GetRaw() + GetCount();
+   }
+
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   T const* TME()::end() const noexcept {
+      return GetRaw() + GetCount();
+   }
+
+   /// Interface the elements as a Block, without ownership                   
+   ///   @attention the view is invalidated as soon as the container changes  
+   ///   @return the block view                                               
+   TEMPLATE() LANGULUS(INLINED)
+   Block<T> TME()::GetView() const noexcept {
+      return MakeBlock(const_cast<T*>(GetRaw()), GetCount());
+   }
+
+   /// Hash the elements, the same way a TMany with the same elements would   
+   ///   @return the hash                                                     
+   TEMPLATE() LANGULUS(INLINED)
+   Hash TME()::GetHash() const {
+      return GetView().GetHash();
+   }
+
+   /// Compare with another small container                                   
+   ///   @param rhs - the container to compare with                           
+   ///   @return true if both containers have the same elements               
+   TEMPLATE() LANGULUS(INLINED)
+   bool TME()::operator == (const TSmallMany& rhs) const {
+      return GetView() == rhs.GetView();
+   }
+
+   /// Compare with any block                                                 
+   ///   @param rhs - the block to compare with                               
+   ///   @return true if the block has the same elements                      
+   TEMPLATE() LANGULUS(INLINED)
+   bool TME()::operator == (const CT::Block auto& rhs) const {
+      return GetView() == rhs;
+   }
+
+   /// Construct an element at the back of the container                      
+   ///   @param arguments - arguments for the element's constructor           
+   ///   @return a reference to the new element                               
+   TEMPLATE() template<class...A> requires ::std::constructible_from<T, A...>
+   LANGULUS(INLINED) T& TME()::Emplace(A&&...arguments) {
+      if (IsInline()) {
+         if (mInlineCount < N) {
+            const auto element = new (GetInline() + mInlineCount)
+               T (Forward<A>(arguments)...);
+            ++mInlineCount;
+            return *element;
+         }
+
+         // Arguments might refer to inline elements, so construct the  
+         // new element before they're moved to the heap                
+         T element (Forward<A>(arguments)...);
+         Spill(N * 2);
+         mHeap << ::std::move(element);
+      }
+      else mHeap.Emplace(IndexBack, Forward<A>(arguments)...);
+      return mHeap.Last();
+   }
+
+   /// Copy an element to the back of the container                           
+   ///   @param element - the element to copy                                 
+   ///   @return a reference to this container for chaining                   
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   TME()& TME()::operator << (const T& element) {
+      Emplace(element);
+      return *this;
+   }
+
+   /// Move an element to the back of the container                           
+   ///   @param element - the element to move                                 
+   ///   @return a reference to this container for chaining                   
+   TEMPLATE() LANGULUS(ALWAYS_INLINED)
+   TME()& TME()::operator << (T&& element) {
+      Emplace(::std::move(element));
+      return *this;
+   }
+
+   /// Make sure there's room for a number of elements, spilling to the heap  
+   /// only if they won't fit inside                                          
+   ///   @param count - the number of elements to reserve                     
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Reserve(const Count count) {
+      if (IsInline()) {
+         if (count > N)
+            Spill(count);
+      }
+      else mHeap.Reserve(count);
+   }
+
+   /// Destroy all elements, but keep any allocated memory                    
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Clear() {
+      if (IsInline())
+         DestroyInline();
+      else
+         mHeap.Clear();
+   }
+
+   /// Destroy all elements and release memory, going back to inline storage  
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Reset() {
+      DestroyInline();
+      mHeap.Reset();
+   }
+
+   /// Copy the elements into a TMany                                         
+   /// If the container has spilled, the memory is simply referenced          
+   ///   @return the new container                                            
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::operator TMany<T> () const {
+      if (not IsInline())
+         return mHeap;
+
+      TMany<T> result;
+      result.Reserve(mInlineCount);
+      for (auto& element : *this)
+         result << element;
+      return result;
+   }
+
+} // namespace Langulus::Anyness
+
+#undef TEMPLATE
+#undef TME
\ No newline at end of file
@@ -22,6 +22,7 @@ namespace Langulus::Anyness
       LANGULUS_BASES(Trait);
 
       using TraitType = TRAIT;
+      using CTTI_Relocatable = TRAIT;
 
       template<class T>
       using Tag = RTTI::Tag<T, TRAIT>;
@@ -72,6 +72,8 @@ namespace Langulus::Anyness
       LANGULUS(ACT_AS) Trait;
       LANGULUS_BASES(A::Trait);
 
+      using CTTI_Relocatable = Trait;
+
       ///                                                                     
       ///   Construction & Assignment                                         
       ///                                                                     
@@ -25,6 +25,7 @@ namespace Langulus::Anyness
       friend struct BlockMap;
       static constexpr bool Ownership = true;
       static constexpr bool Ordered = ORDERED;
+      using CTTI_Relocatable = Map;
 
       using Key = void;
       using Value = void;
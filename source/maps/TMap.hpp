@@ -37,13 +37,14 @@ namespace Langulus::Anyness
 
    ///                                                                        
    /// A hashmap implementation, using the Robin Hood algorithm               
+   /// The ENGINE decides how lookups walk the table, see Engine              
    ///                                                                        
-   template<CT::Data K, CT::Data V, bool ORDERED>
+   template<CT::Data K, CT::Data V, bool ORDERED, Engine ENGINE>
    struct TMap : Map<ORDERED> {
       using Key = K;
       using Value = V;
       using Base = Map<ORDERED>;
-      using Self = TMap<K, V, ORDERED>;
+      using Self = TMap<K, V, ORDERED, ENGINE>;
       using Pair = TPair<K, V>;
       using PairRef = TPair<const K&, V&>;
       using PairConstRef = TPair<const K&, const V&>;
@@ -52,6 +53,9 @@ namespace Langulus::Anyness
       LANGULUS(TYPED)     Pair;
       LANGULUS_BASES(Map<ORDERED>);
 
+      static constexpr Engine Probing = ENGINE;
+      using CTTI_Relocatable = TMap;
+
    protected:
       static_assert(CT::Comparable<K, K>,
          "Map's key type must be equality-comparable to itself");
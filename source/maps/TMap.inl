@@ -10,8 +10,8 @@
 #include "Map.inl"
 #include "../pairs/TPair.inl"
 
-#define TEMPLATE()   template<CT::Data K, CT::Data V, bool ORDERED>
-#define TABLE()      TMap<K, V, ORDERED>
+#define TEMPLATE()   template<CT::Data K, CT::Data V, bool ORDERED, Engine ENGINE>
+#define TABLE()      TMap<K, V, ORDERED, ENGINE>
 
 
 namespace Langulus::Anyness
@@ -7,6 +7,16 @@
 ///                                                                           
 #pragma once
 #include <RTTI/Meta.hpp>
+#include <atomic>
+
+/// Make reference counting of allocations thread-safe                        
+/// Allows for sharing containers across threads, at the cost of using        
+/// atomic operations on each Keep/Free                                       
+#ifdef LANGULUS_ENABLE_FEATURE_ATOMIC_REFERENCES
+   #define LANGULUS_FEATURE_ATOMIC_REFERENCES() 1
+#else
+   #define LANGULUS_FEATURE_ATOMIC_REFERENCES() 0
+#endif
 
 
 namespace Langulus::Anyness
@@ -38,13 +48,14 @@ namespace Langulus::Anyness
    protected:
       // Allocated bytes for this chunk                                 
       Offset mAllocatedBytes;
-      // The number of references to this memory                        
+      // The number of references to this memory. Always accessed       
+      // atomically if ATOMIC_REFERENCES feature is enabled             
       Count mReferences;
       union {
          // This pointer has two uses, depending on mReferences         
          // If mReferences > 0, it refers to the pool that owns the     
          //    allocation, or	handle for std::free() if MANAGED_MEMORY  
-         //    feature is not enabled                                   
+         //    feature is not enabled (null, if owned by an Arena)      
          // If mReferences == 0, it refers to the next free entry to be 
          //    reused                                                   
          Pool* mPool;
@@ -81,8 +92,34 @@ namespace Langulus::Anyness
 
       constexpr void Keep() noexcept;
       constexpr void Keep(Count) noexcept;
-      constexpr void Free() noexcept;
-      constexpr void Free(Count) noexcept;
+      constexpr Count Free() noexcept;
+      constexpr Count Free(Count) noexcept;
+   };
+
+
+   ///                                                                        
+   ///   Allocation on the stack                                              
+   ///                                                                        
+   ///   An allocation record, followed by BYTES of usable memory, that all   
+   /// live on the stack. Blocks can use the entry like any other, as long as 
+   /// they don't outlive it. The entry is never deallocated - whoever puts   
+   /// elements inside is responsible for destroying them.                    
+   ///                                                                        
+   template<Offset BYTES>
+   class LocalAllocation {
+      alignas(Alignment) Byte mMemory[Allocation::GetSize() + BYTES];
+
+   public:
+      static constexpr Offset Capacity = BYTES;
+
+      LocalAllocation() noexcept;
+      LocalAllocation(const LocalAllocation&) = delete;
+      LocalAllocation(LocalAllocation&&) = delete;
+      LocalAllocation& operator = (const LocalAllocation&) = delete;
+      LocalAllocation& operator = (LocalAllocation&&) = delete;
+
+      NOD() Allocation* GetEntry() noexcept;
+      NOD() const Allocation* GetEntry() const noexcept;
    };
 
 } // namespace Langulus::Anyness
@@ -97,6 +97,12 @@ namespace Langulus::Anyness
    ///   @return true if entry has any references                             
    LANGULUS(INLINED)
    constexpr Count Allocation::GetUses() const noexcept {
+      #if LANGULUS_FEATURE(ATOMIC_REFERENCES)
+         if (not ::std::is_constant_evaluated()) {
+            return ::std::atomic_ref<Count> {const_cast<Count&>(mReferences)}
+               .load(::std::memory_order_acquire);
+         }
+      #endif
       return mReferences;
    }
 
@@ -161,27 +167,70 @@ namespace Langulus::Anyness
    /// Reference the entry once                                               
    LANGULUS(INLINED)
    constexpr void Allocation::Keep() noexcept {
-      ++mReferences;
+      Keep(1);
    }
 
    /// Reference the entry 'c' times                                          
+   ///   @attention new references can only be made from existing ones, so    
+   ///      relaxed ordering is sufficient in atomic mode                     
    ///   @param c - the number of references to add                           
    LANGULUS(INLINED)
    constexpr void Allocation::Keep(Count c) noexcept {
+      #if LANGULUS_FEATURE(ATOMIC_REFERENCES)
+         if (not ::std::is_constant_evaluated()) {
+            ::std::atomic_ref<Count> {mReferences}
+               .fetch_add(c, ::std::memory_order_relaxed);
+            return;
+         }
+      #endif
       mReferences += c;
    }
 
    /// Dereference the entry once                                             
+   ///   @return the number of remaining references                           
    LANGULUS(INLINED)
-   constexpr void Allocation::Free() noexcept {
-      --mReferences;
+   constexpr Count Allocation::Free() noexcept {
+      return Free(1);
    }
 
    /// Dereference the entry 'c' times                                        
+   ///   @attention in atomic mode, all changes made through this reference   
+   ///      are released, so that whoever frees last sees them                
    ///   @param c - the number of references to remove                        
+   ///   @return the number of remaining references                           
    LANGULUS(INLINED)
-   constexpr void Allocation::Free(Count c) noexcept {
+   constexpr Count Allocation::Free(Count c) noexcept {
+      #if LANGULUS_FEATURE(ATOMIC_REFERENCES)
+         if (not ::std::is_constant_evaluated()) {
+            return ::std::atomic_ref<Count> {mReferences}
+               .fetch_sub(c, ::std::memory_order_acq_rel) - c;
+         }
+      #endif
       mReferences -= c;
+      return mReferences;
+   }
+
+
+   /// Place the allocation record at the start of the buffer                 
+   /// It has no pool, like entries that are owned by an arena, but it is     
+   /// never handed to the allocator anyway                                   
+   template<Offset BYTES> LANGULUS(INLINED)
+   LocalAllocation<BYTES>::LocalAllocation() noexcept {
+      new (mMemory) Allocation {BYTES, nullptr};
+   }
+
+   /// Get the allocation record                                              
+   ///   @return the entry, that blocks can use                               
+   template<Offset BYTES> LANGULUS(INLINED)
+   Allocation* LocalAllocation<BYTES>::GetEntry() noexcept {
+      return reinterpret_cast<Allocation*>(mMemory);
+   }
+
+   /// Get the allocation record (const)                                      
+   ///   @return the entry, that blocks can use                               
+   template<Offset BYTES> LANGULUS(INLINED)
+   const Allocation* LocalAllocation<BYTES>::GetEntry() const noexcept {
+      return reinterpret_cast<const Allocation*>(mMemory);
    }
 
 } // namespace Langulus::Fractalloc
@@ -0,0 +1,145 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Allocation.hpp"
+#include <cstdlib>
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Monotonic memory arena                                               
+   ///                                                                        
+   ///   While an arena is alive, it is installed as the allocation backend   
+   /// of the thread that created it. Allocator::Allocate then just bumps a   
+   /// pointer inside the arena's chunks, and Allocator::Deallocate does      
+   /// nothing for memory that came from an arena - all of it is released at  
+   /// once, when the arena is reset or destroyed. Arenas nest, destroying    
+   /// one reinstalls the arena that was current before it.                   
+   ///   Meant for the many short-lived containers, that die together, like   
+   /// the temporaries produced while handling a single request. Containers   
+   /// that outlive the arena must not keep memory, that was allocated from   
+   /// it - this includes lazily initialized static containers.               
+   ///                                                                        
+   class Arena {
+      /// Each chunk is prefixed with this header, followed by padding, so    
+      /// that the first allocation inside is correctly aligned               
+      struct Chunk {
+         Chunk* mPrevious;
+      };
+
+      // The last allocated chunk, linked to the previous ones          
+      Chunk* mChunks {};
+      // Where the next allocation will be placed                       
+      Byte* mCursor {};
+      // The end of the last allocated chunk                            
+      Byte* mEnd {};
+      // The number of bytes to allocate for each new chunk             
+      Offset mChunkSize;
+      // The arena that was installed before this one                   
+      Arena* mPreviousArena;
+
+      static inline thread_local Arena* sCurrent {};
+
+      /// Allocate a new chunk, big enough for at least 'bytes' bytes         
+      ///   @param bytes - the number of bytes required                       
+      ///   @return true if chunk was allocated                               
+      bool Grow(const Offset bytes) noexcept {
+         const auto size = ::std::max(mChunkSize, bytes);
+         const auto base = static_cast<Byte*>(
+            ::std::malloc(sizeof(Chunk) + Alignment + size));
+         if (not base) UNLIKELY()
+            return false;
+
+         const auto chunk = reinterpret_cast<Chunk*>(base);
+         chunk->mPrevious = mChunks;
+         mChunks = chunk;
+
+         // Align cursor to the alignment LANGULUS was built with       
+         mCursor = reinterpret_cast<Byte*>(
+            (reinterpret_cast<Offset>(base + sizeof(Chunk)) + Alignment)
+            & ~(Alignment - Offset {1})
+         );
+         mEnd = mCursor + size;
+         return true;
+      }
+
+   public:
+      static constexpr Offset DefaultChunkSize = 64 * 1024;
+
+      /// Create an arena and install it for the current thread               
+      ///   @param chunkSize - the number of bytes to allocate at once        
+      Arena(const Offset chunkSize = DefaultChunkSize) noexcept
+         : mChunkSize {::std::max(chunkSize, Allocation::GetMinAllocation())}
+         , mPreviousArena {sCurrent} {
+         sCurrent = this;
+      }
+
+      Arena(const Arena&) = delete;
+      Arena(Arena&&) = delete;
+      Arena& operator = (const Arena&) = delete;
+      Arena& operator = (Arena&&) = delete;
+
+      /// Release all memory, and reinstall the previous arena                
+      ~Arena() {
+         LANGULUS_ASSUME(DevAssumes, sCurrent == this,
+            "Arenas must be destroyed in reverse order of creation, "
+            "and on the same thread they were created on");
+         Reset();
+         sCurrent = mPreviousArena;
+      }
+
+      /// Get the arena installed for the current thread                      
+      ///   @return the arena, or nullptr if allocating from the heap         
+      NOD() LANGULUS(INLINED)
+      static Arena* GetCurrent() noexcept {
+         return sCurrent;
+      }
+
+      /// Check if nothing was allocated since the arena was made or reset    
+      ///   @return true if the arena has no chunks                           
+      NOD() LANGULUS(INLINED)
+      bool IsEmpty() const noexcept {
+         return not mChunks;
+      }
+
+      /// Place an allocation at the cursor, growing the arena if required    
+      ///   @param size - the number of client bytes to allocate              
+      ///   @return the new entry, or nullptr if out of memory                
+      NOD() LANGULUS(INLINED)
+      Allocation* Allocate(const Offset size) noexcept {
+         // Keep the cursor aligned for the next allocation             
+         const auto bytes = (Allocation::GetNewAllocationSize(size)
+            + Alignment - 1) & ~(Alignment - Offset {1});
+         if (static_cast<Offset>(mEnd - mCursor) < bytes) UNLIKELY() {
+            if (not Grow(bytes))
+               return nullptr;
+         }
+
+         // A missing pool marks entries that are owned by an arena     
+         const auto entry = reinterpret_cast<Allocation*>(mCursor);
+         mCursor += bytes;
+         new (entry) Allocation {size, nullptr};
+         return entry;
+      }
+
+      /// Release all chunks at once                                          
+      ///   @attention any memory allocated from the arena becomes invalid    
+      void Reset() noexcept {
+         while (mChunks) {
+            const auto previous = mChunks->mPrevious;
+            ::std::free(mChunks);
+            mChunks = previous;
+         }
+
+         mCursor = mEnd = nullptr;
+      }
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -6,12 +6,30 @@
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
 #pragma once
-#include "Allocation.hpp"
+#include "Arena.hpp"
+#include <cstring>
 
 
 namespace Langulus::Anyness
 {
    
+   /// Place an entry at the correctly aligned place inside a heap chunk      
+   ///   @param base - the chunk, as returned by std::malloc                  
+   ///   @param size - the number of client bytes the entry will hold         
+   ///   @return the placed entry                                             
+   template<AllocationPrimitive T>
+   T* AlignedPlace(void* base, Offset size) noexcept {
+      // Align pointer to the alignment LANGULUS was built with         
+      auto ptr = reinterpret_cast<T*>(
+         (reinterpret_cast<Offset>(base) + Alignment)
+         & ~(Alignment - Offset {1})
+      );
+
+      // Place the entry there                                          
+      new (ptr) T {size, base};
+      return ptr;
+   }
+
    /// MSVC will likely never support std::aligned_alloc, so we use           
    /// a custom portable routine that's almost the same                       
    /// https://stackoverflow.com/questions/62962839                           
@@ -27,22 +45,137 @@ namespace Langulus::Anyness
       const auto base = ::std::malloc(finalSize);
       if (not base) UNLIKELY()
          return nullptr;
+      return AlignedPlace<T>(base, size);
+   }
 
-      // Align pointer to the alignment LANGULUS was built with         
-      auto ptr = reinterpret_cast<T*>(
-         (reinterpret_cast<Offset>(base) + Alignment)
-         & ~(Alignment - Offset {1})
-      );
 
-      // Place the entry there                                          
-      new (ptr) T {size, base};
-      return ptr;
-   }
+   ///                                                                        
+   ///   Per-thread cache of small heap chunks                                
+   ///                                                                        
+   ///   Requests for up to LargestClass client bytes are rounded up to a     
+   /// power-of-two size class, starting at SmallestClass. When deallocated,  
+   /// such chunks aren't freed, but pushed to the free list of their class,  
+   /// and popped by the next allocation of that class. Each thread has its   
+   /// own lists, so there's no locking, nor atomics involved. A chunk may    
+   /// be released on another thread than the one that allocated it - it is   
+   /// simply cached by the releasing thread. Lists are capped, and chunks    
+   /// beyond the cap are freed right away                                    
+   ///                                                                        
+   struct SizeClasses {
+      static constexpr Offset SmallestClass = 16;
+      static constexpr Offset LargestClass = 4096;
+      static constexpr Offset ClassCount = Inner::FastLog2(LargestClass)
+                                         - Inner::FastLog2(SmallestClass) + 1;
+      static constexpr Count MaxCachedChunks = 64;
+
+   private:
+      /// Cached chunks are linked through their first bytes                  
+      struct FreeChunk {
+         FreeChunk* mNext;
+      };
+
+      /// The free lists of a single thread                                   
+      struct Lists {
+         FreeChunk* mFree[ClassCount];
+         Count mCached[ClassCount];
+         bool mClosed;
+      };
+
+      static inline thread_local constinit Lists sThread {};
+
+      /// Releases all chunks cached by a thread, when the thread ends. Any   
+      /// chunk deallocated after that is just freed                          
+      struct Drain {
+         ~Drain() {
+            for (Offset c = 0; c < ClassCount; ++c) {
+               while (sThread.mFree[c]) {
+                  const auto next = sThread.mFree[c]->mNext;
+                  ::std::free(sThread.mFree[c]);
+                  sThread.mFree[c] = next;
+               }
+               sThread.mCached[c] = 0;
+            }
+            sThread.mClosed = true;
+         }
+      };
+
+   public:
+      /// Check if a number of client bytes is served by a size class         
+      NOD() LANGULUS(INLINED)
+      static constexpr bool IsPooled(const Offset size) noexcept {
+         return size <= LargestClass;
+      }
+
+      /// Get the size class for a number of client bytes                     
+      ///   @attention assumes IsPooled(size)                                 
+      NOD() LANGULUS(INLINED)
+      static constexpr Offset GetClass(const Offset size) noexcept {
+         return Inner::FastLog2(Roof2(::std::max(size, SmallestClass)))
+              - Inner::FastLog2(SmallestClass);
+      }
+
+      /// Get the number of client bytes, that fit in a size class            
+      NOD() LANGULUS(INLINED)
+      static constexpr Offset GetClassSize(const Offset c) noexcept {
+         return SmallestClass << c;
+      }
+
+      /// Get the number of chunks the current thread has cached for a class  
+      ///   @param c - the size class                                         
+      ///   @return the number of cached chunks                               
+      NOD() LANGULUS(INLINED)
+      static Count GetCachedCount(const Offset c) noexcept {
+         return sThread.mCached[c];
+      }
+
+      /// Check if the cache of the current thread has already been drained,  
+      /// which happens when the thread ends                                  
+      ///   @return true if chunks are no longer cached by this thread        
+      NOD() LANGULUS(INLINED)
+      static bool IsClosed() noexcept {
+         return sThread.mClosed;
+      }
+
+      /// Pop a cached chunk of the current thread                            
+      ///   @param c - the size class                                         
+      ///   @return the chunk, or nullptr if none is cached                   
+      NOD() LANGULUS(INLINED)
+      static void* Take(const Offset c) noexcept {
+         const auto chunk = sThread.mFree[c];
+         if (chunk) {
+            sThread.mFree[c] = chunk->mNext;
+            --sThread.mCached[c];
+         }
+         return chunk;
+      }
+
+      /// Push a chunk to the cache of the current thread                     
+      ///   @param c - the size class                                         
+      ///   @param base - the chunk, as returned by std::malloc               
+      ///   @return false if the chunk wasn't cached, and should be freed     
+      NOD() LANGULUS(INLINED)
+      static bool Give(const Offset c, void* base) noexcept {
+         if (sThread.mClosed or sThread.mCached[c] == MaxCachedChunks)
+            return false;
+
+         // Make sure the cache is drained when the thread ends         
+         [[maybe_unused]] static thread_local Drain drain;
+
+         const auto chunk = static_cast<FreeChunk*>(base);
+         chunk->mNext = sThread.mFree[c];
+         sThread.mFree[c] = chunk;
+         ++sThread.mCached[c];
+         return true;
+      }
+   };
 
 
    ///                                                                        
    ///   A mockup of a memory manager                                         
    ///                                                                        
+   ///   Allocates from the heap, unless an Arena is installed for the        
+   /// current thread, in which case memory is bumped from the arena          
+   ///                                                                        
    struct Allocator {
       /// No state when MANAGED_MEMORY feature is disabled                    
       struct State {
@@ -52,6 +185,23 @@ namespace Langulus::Anyness
       NOD() LANGULUS(INLINED)
       static Allocation* Allocate(DMeta, Offset size) IF_UNSAFE(noexcept) {
          LANGULUS_ASSUME(DevAssumes, size, "Zero allocation is not allowed");
+         if (const auto arena = Arena::GetCurrent())
+            return arena->Allocate(size);
+
+         if (SizeClasses::IsPooled(size)) {
+            // Small chunks are reused from the thread's cache, or      
+            // allocated with the full capacity of their class          
+            const auto c = SizeClasses::GetClass(size);
+            if (const auto cached = SizeClasses::Take(c))
+               return AlignedPlace<Allocation>(cached, size);
+
+            const auto entry = AlignedAllocate<Allocation>(
+               SizeClasses::GetClassSize(c));
+            if (entry)
+               entry->mAllocatedBytes = size;
+            return entry;
+         }
+
          return AlignedAllocate<Allocation>(size);
       }
 
@@ -69,6 +219,78 @@ namespace Langulus::Anyness
          return Allocator::Allocate(nullptr, size);
       }
 
+      /// Resize an allocation, carrying its contents over                    
+      /// Unlike Reallocate, contents are moved bytewise via std::realloc,    
+      /// which extends the chunk in place when it can, and remaps pages      
+      /// of big chunks instead of copying them. Use only on trivially        
+      /// relocatable data - the previous entry can't be used afterwards      
+      ///   @attention contents are kept relative to the block start, so views
+      ///      starting inside the allocation must not be relocated           
+      ///   @param size - the new number of client bytes                      
+      ///   @param previous - the entry to resize                             
+      ///   @return the resized entry, or nullptr if out of memory, in        
+      ///      which case the previous entry remains intact                   
+      NOD() LANGULUS(INLINED)
+      static Allocation* Relocate(Offset size, Allocation* previous) IF_UNSAFE(noexcept) {
+         LANGULUS_ASSUME(DevAssumes, previous,
+            "Relocating nullptr");
+         LANGULUS_ASSUME(DevAssumes, size,
+            "Zero relocation is not allowed");
+         LANGULUS_ASSUME(DevAssumes, previous->mReferences == 1,
+            "Relocating an allocation used from multiple places");
+
+         const auto previousSize = previous->GetAllocatedSize();
+         if (SizeClasses::IsPooled(size) and SizeClasses::IsPooled(previousSize)
+         and SizeClasses::GetClass(size) == SizeClasses::GetClass(previousSize)
+         and previous->mPool) {
+            // The chunk already has the capacity of the class          
+            previous->mAllocatedBytes = size;
+            return previous;
+         }
+
+         if (not previous->mPool or SizeClasses::IsPooled(size)
+         or SizeClasses::IsPooled(previousSize)) {
+            // Arena memory can't be resized in place, and pooled       
+            // chunks must keep the capacity of their class, so just    
+            // copy the contents to a new allocation                    
+            const auto entry = Allocator::Allocate(nullptr, size);
+            if (entry) {
+               ::std::memcpy(entry->GetBlockStart(), previous->GetBlockStart(),
+                  ::std::min(size, previousSize));
+               Allocator::Deallocate(previous);
+            }
+            return entry;
+         }
+
+         const auto oldBase = static_cast<Byte*>(previous->mPool);
+         const auto oldShift = reinterpret_cast<Byte*>(previous) - oldBase;
+         const auto kept = ::std::min(
+            Allocation::GetNewAllocationSize(size),
+            previous->GetTotalSize()
+         );
+
+         const auto finalSize = Allocation::GetNewAllocationSize(size) + Alignment;
+         const auto base = static_cast<Byte*>(::std::realloc(oldBase, finalSize));
+         if (not base) UNLIKELY()
+            return nullptr;
+
+         // Align pointer to the alignment LANGULUS was built with      
+         // realloc doesn't care about it, so if the new chunk happens  
+         // to be aligned differently, the entry and contents are       
+         // shifted to the correct place                                
+         auto ptr = reinterpret_cast<Allocation*>(
+            (reinterpret_cast<Offset>(base) + Alignment)
+            & ~(Alignment - Offset {1})
+         );
+
+         if (reinterpret_cast<Byte*>(ptr) - base != oldShift)
+            ::std::memmove(ptr, base + oldShift, kept);
+
+         ptr->mAllocatedBytes = size;
+         ptr->mPool = base;
+         return ptr;
+      }
+
       LANGULUS(INLINED)
       static void Deallocate(Allocation* entry) IF_UNSAFE(noexcept) {
          LANGULUS_ASSUME(DevAssumes, entry,
@@ -80,7 +302,14 @@ namespace Langulus::Anyness
          LANGULUS_ASSUME(DevAssumes, entry->mReferences == 1,
             "Deallocating an allocation used from multiple places");
 
-         ::std::free(entry->mPool);
+         // Arena memory is released all at once, with the arena        
+         if (not entry->mPool)
+            return;
+
+         const auto size = entry->GetAllocatedSize();
+         if (not SizeClasses::IsPooled(size)
+         or not SizeClasses::Give(SizeClasses::GetClass(size), entry->mPool))
+            ::std::free(entry->mPool);
       }
 
       static constexpr const Allocation* Find(DMeta, const void*) noexcept {
@@ -32,6 +32,14 @@ namespace Langulus
       template<class...T>
       concept NotHandle = ((not Handle<T>) and ...);
 
+      /// Check if T can be inserted into type-erased containers through a    
+      /// local handle on the stack, as if the containers were typed. T must  
+      /// be dense, statically typed, not an array or a handle, and no bigger 
+      /// than LANGULUS_LOCAL_HANDLE_SIZE bytes                               
+      template<class...T>
+      concept LocalHandleable = ((Dense<T> and NotHandle<T> and not Array<T>
+          and not TypeErased<T> and sizeof(T) <= LANGULUS_LOCAL_HANDLE_SIZE) and ...);
+
    } // namespace Langulus::CT
 
 } // namespace Langulus
@@ -118,10 +126,13 @@ namespace Langulus::Anyness
       void Assign(const Type&, AllocType = nullptr) noexcept requires (Embedded and Mutable);
       void AssignWithIntent(auto&&, DMeta = {}) requires Mutable;
       void Swap(CT::Handle auto&, DMeta = {}) requires Mutable;
+      void RelocateFrom(CT::Handle auto&, DMeta = {}) requires Mutable;
       NOD() bool Compare(const auto&, DMeta = {}) const;
 
       template<bool RESET = false, bool DEALLOCATE = true>
       void FreeInner(DMeta = {}) requires Mutable;
+      template<bool DEALLOCATE = true>
+      static void FreeSparse(const Type&, AllocType, DMeta = {}) requires Sparse;
 
       // Prefix operators                                               
       auto operator ++ () noexcept -> Handle& requires Embedded;
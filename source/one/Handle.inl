@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Handle.hpp"
+#include <algorithm>
 
 #define TEMPLATE()   template<class T, bool EMBED>
 #define HAND()       Handle<T, EMBED>
@@ -116,9 +117,14 @@ namespace Langulus::Anyness
       if constexpr (Sparse and not Embedded) {
          // THIS IS THE ONLY CASE WHERE A HANDLE EXERCISES OWNERSHIP    
          if (mEntry) {
-            const_cast<Allocation*>(mEntry)->Free();
-            if constexpr (CT::Referencable<Deptr<T>>)
-               DecvqCast(mValue)->Reference(-1);
+            if constexpr (not TypeErased)
+               FreeSparse(mValue, mEntry);
+            else if (not const_cast<Allocation*>(mEntry)->Free()) {
+               // The handle turned out to be the last owner, but the   
+               // type isn't known here, so only memory can be released 
+               const_cast<Allocation*>(mEntry)->Keep();
+               Allocator::Deallocate(const_cast<Allocation*>(mEntry));
+            }
          }
       }
    }
@@ -481,10 +487,19 @@ namespace Langulus::Anyness
    ///      type-erased                                                       
    TEMPLATE() LANGULUS(INLINED)
    void HAND()::Swap(CT::Handle auto& rhs, DMeta type) requires Mutable {
+      using RHS = Deref<decltype(rhs)>;
+
       if constexpr (Sparse) {
          std::swap(Get(), rhs.Get());
          std::swap(GetEntry(), rhs.GetEntry());
       }
+      else if constexpr (not TypeErased and CT::Relocatable<T>
+      and CT::Exact<T, TypeOf<RHS>>) {
+         // Trivially relocatable values are just swapped bytewise      
+         const auto lhsBytes = reinterpret_cast<Byte*>(&Get());
+         ::std::swap_ranges(lhsBytes, lhsBytes + sizeof(T),
+            reinterpret_cast<Byte*>(&rhs.Get()));
+      }
       else {
          HandleLocal<T> tmp {Abandon(*this)};
          FreeInner<false, true>(type);
@@ -493,6 +508,33 @@ namespace Langulus::Anyness
       }
    }
 
+   /// Move the contents of another handle in this one, and destroy them at   
+   /// the other one. Trivially relocatable values are copied bytewise,       
+   /// without invoking any constructors or destructors                       
+   ///   @attention assumes this handle's contents are not initialized        
+   ///   @param rhs - the handle to relocate from                             
+   ///   @param type - type of the contained data, used only if handle is     
+   ///      type-erased                                                       
+   TEMPLATE() LANGULUS(INLINED)
+   void HAND()::RelocateFrom(CT::Handle auto& rhs, DMeta type) requires Mutable {
+      using RHS = Deref<decltype(rhs)>;
+
+      if constexpr (Embedded and RHS::Embedded and Dense and not TypeErased
+      and CT::Relocatable<T> and CT::Exact<T, TypeOf<RHS>>) {
+         // Local handles destroy their values when they go out of      
+         // scope, so only embedded ones are relocated this way         
+         CopyMemory(
+            reinterpret_cast<Byte*>(&Get()),
+            reinterpret_cast<const Byte*>(&rhs.Get()),
+            sizeof(T)
+         );
+      }
+      else {
+         CreateWithIntent(Abandon(rhs), type);
+         rhs.FreeInner(type);
+      }
+   }
+
    /// Compare the contents of the handle with content                        
    ///   @param rhs - data to compare against                                 
    ///   @param type - type of the contained data, used only if handle is     
@@ -527,44 +569,8 @@ namespace Langulus::Anyness
             LANGULUS_ASSUME(DevAssumes, meta->mIsSparse,
                "Provided meta must match T sparseness");
 
-            if (GetEntry()) {
-               if (1 == GetEntry()->GetUses()) {
-                  // This is the last occurence of that element         
-                  LANGULUS_ASSUME(DevAssumes, Get(), "Null pointer");
-
-                  if (meta->mDeptr->mIsSparse) {
-                     // Pointer to pointer                              
-                     // Release all nested indirection layers           
-                     HandleLocal<void*> {Get()}.FreeInner(meta->mDeptr);
-                  }
-                  else if (meta->mDestructor) {
-                     // Pointer to a complete, destroyable dense        
-                     // Call the destructor                             
-                     if (meta->mReference) {
-                        if (meta->mReference(Get(), -1) == 0)
-                           meta->mDestructor(Get());
-                     }
-                     else meta->mDestructor(Get());
-                  }
-
-                  if constexpr (DEALLOCATE)
-                     Allocator::Deallocate(const_cast<Allocation*>(GetEntry()));
-               }
-               else {
-                  // This element occurs in more than one place         
-                  // We're not allowed to deallocate the memory behind  
-                  // it, but we must call destructors if T is           
-                  // referencable, and its individual references have   
-                  // reached 0. This usually happens when elements from 
-                  // a THive are referenced.                            
-                  if (not meta->mDeptr->mIsSparse and meta->mReference) {
-                     if (meta->mReference(Get(), -1) == 0)
-                        meta->mDestructor(Get());
-                  }
-
-                  const_cast<Allocation*>(GetEntry())->Free();
-               }
-            }
+            if (GetEntry())
+               FreeSparse<DEALLOCATE>(Get(), GetEntry(), meta);
 
             if constexpr (RESET) {
                // Handle is dense and embedded, we should call remote   
@@ -579,50 +585,8 @@ namespace Langulus::Anyness
 
          if constexpr (Sparse) {
             // Handle is sparse, we should handle each indirection layer
-            if (GetEntry()) {
-               if (1 == GetEntry()->GetUses()) {
-                  // This is the last occurence of that element         
-                  LANGULUS_ASSUME(DevAssumes, Get(), "Null pointer");
-
-                  if constexpr (CT::Sparse<Deptr<T>>) {
-                     // Pointer to pointer                              
-                     // Release all nested indirection layers           
-                     HandleLocal<Deptr<T>> {*Get()}.FreeInner();
-                  }
-                  else if constexpr (not CT::Complete<DT> and not CT::Function<DT>) {
-                     // CT::Destroyable<DT> will fail silently if DT    
-                     // isn't defined yet, causing nasty leaks. So make 
-                     // it not-so-silent...                             
-                     static_assert(false, "Attempting to destroy an incomplete type");
-                  }
-                  else if constexpr (CT::Destroyable<DT>) {
-                     // Pointer to a complete, destroyable dense        
-                     // Call the destructor                             
-                     if constexpr (CT::Referencable<DT>) {
-                        if (DecvqCast(Get())->Reference(-1) == 0)
-                           Get()->~DT();
-                     }
-                     else Get()->~DT();
-                  }
-
-                  if constexpr (DEALLOCATE)
-                     Allocator::Deallocate(const_cast<Allocation*>(GetEntry()));
-               }
-               else {
-                  // This element occurs in more than one place         
-                  // We're not allowed to deallocate the memory behind  
-                  // it, but we must call destructors if T is           
-                  // referencable, and its individual references have   
-                  // reached 1. This usually happens when elements from 
-                  // a THive are referenced.                            
-                  if constexpr (CT::Dense<Deptr<T>> and CT::Referencable<DT>) {
-                     if (DecvqCast(Get())->Reference(-1) == 0)
-                        Get()->~DT();
-                  }
-
-                  const_cast<Allocation*>(GetEntry())->Free();
-               }
-            }
+            if (GetEntry())
+               FreeSparse<DEALLOCATE>(Get(), GetEntry());
 
             if constexpr (RESET) {
                const_cast<Type&>(Get()) = nullptr;
@@ -647,6 +611,118 @@ namespace Langulus::Anyness
       }
    }
 
+   /// Dereference a pointer, and destroy the element it points to, as well   
+   /// as deallocate its memory, if this was the last occurence of it         
+   /// Other occurences might be released on other threads at the same time,  
+   /// so the element is dereferenced while its memory is still kept alive,   
+   /// and if all other occurences turned out to be released meanwhile, the   
+   /// element is destroyed here after all                                    
+   ///   @tparam DEALLOCATE - are we allowed to deallocate the memory?        
+   ///   @param value - the pointer to dereference                            
+   ///   @param entry - the allocation the pointer points into                
+   ///   @param meta - type of the contained data, used only if handle is     
+   ///      type-erased                                                       
+   TEMPLATE() template<bool DEALLOCATE>
+   void HAND()::FreeSparse(const Type& value, AllocType entry, DMeta meta) requires Sparse {
+      const auto mutableEntry = const_cast<Allocation*>(entry);
+      const bool shared = 1 != entry->GetUses();
+
+      if constexpr (TypeErased) {
+         LANGULUS_ASSUME(DevAssumes, meta,
+            "Invalid type provided for type-erased handle");
+         LANGULUS_ASSUME(DevAssumes, meta->mIsSparse,
+            "Provided meta must match T sparseness");
+         const bool referencable = not meta->mDeptr->mIsSparse and meta->mReference;
+
+         if (shared) {
+            // This element occurs in more than one place               
+            // We're not allowed to deallocate the memory behind        
+            // it, but we must call destructors if T is                 
+            // referencable, and its individual references have         
+            // reached 0. This usually happens when elements from       
+            // a THive are referenced.                                  
+            if (referencable and meta->mReference(value, -1) == 0)
+               meta->mDestructor(value);
+
+            if (mutableEntry->Free())
+               return;
+
+            // All other occurences were released in the meantime,      
+            // so this turned out to be the last one after all          
+            mutableEntry->Keep();
+         }
+
+         // This is the last occurence of that element                  
+         LANGULUS_ASSUME(DevAssumes, value, "Null pointer");
+
+         if (meta->mDeptr->mIsSparse) {
+            // Pointer to pointer                                       
+            // Release all nested indirection layers                    
+            HandleLocal<void*> {value}.FreeInner(meta->mDeptr);
+         }
+         else if (meta->mDestructor) {
+            // Pointer to a complete, destroyable dense                 
+            // Call the destructor, unless already dereferenced above   
+            if (referencable) {
+               if (not shared and meta->mReference(value, -1) == 0)
+                  meta->mDestructor(value);
+            }
+            else meta->mDestructor(value);
+         }
+      }
+      else {
+         using DT = Decay<T>;
+         constexpr bool referencable = CT::Dense<Deptr<T>> and CT::Referencable<DT>;
+
+         if (shared) {
+            // This element occurs in more than one place               
+            // We're not allowed to deallocate the memory behind        
+            // it, but we must call destructors if T is                 
+            // referencable, and its individual references have         
+            // reached 0. This usually happens when elements from       
+            // a THive are referenced.                                  
+            if constexpr (referencable) {
+               if (DecvqCast(value)->Reference(-1) == 0)
+                  value->~DT();
+            }
+
+            if (mutableEntry->Free())
+               return;
+
+            // All other occurences were released in the meantime,      
+            // so this turned out to be the last one after all          
+            mutableEntry->Keep();
+         }
+
+         // This is the last occurence of that element                  
+         LANGULUS_ASSUME(DevAssumes, value, "Null pointer");
+
+         if constexpr (CT::Sparse<Deptr<T>>) {
+            // Pointer to pointer                                       
+            // Release all nested indirection layers                    
+            HandleLocal<Deptr<T>> {*value}.FreeInner();
+         }
+         else if constexpr (not CT::Complete<DT> and not CT::Function<DT>) {
+            // CT::Destroyable<DT> will fail silently if DT isn't       
+            // defined yet, causing nasty leaks. So make it             
+            // not-so-silent...                                         
+            static_assert(false, "Attempting to destroy an incomplete type");
+         }
+         else if constexpr (CT::Destroyable<DT>) {
+            // Pointer to a complete, destroyable dense                 
+            // Call the destructor, unless already dereferenced above   
+            if constexpr (referencable) {
+               if (not shared and DecvqCast(value)->Reference(-1) == 0)
+                  value->~DT();
+            }
+            else value->~DT();
+         }
+      }
+
+      if constexpr (DEALLOCATE)
+         Allocator::Deallocate(mutableEntry);
+   }
+
 } // namespace Langulus::Anyness
 
 #undef TEMPLATE
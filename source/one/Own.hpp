@@ -96,6 +96,7 @@ namespace Langulus::Anyness
       LANGULUS(TYPED) T;
 
       static constexpr bool Ownership = true;
+      using CTTI_Relocatable = Conditional<CT::Relocatable<T>, Own, void>;
 
       ///                                                                     
       ///   Construction                                                      
@@ -32,6 +32,8 @@ namespace Langulus::Anyness
       void ResetInner();
 
    public:
+      using CTTI_Relocatable = Ref;
+
       ///                                                                     
       ///   Construction                                                      
       ///                                                                     
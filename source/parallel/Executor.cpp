@@ -0,0 +1,243 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Executor.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace Langulus::Anyness::Parallel
+{
+
+   /// A single job, split into chunks                                        
+   struct Job {
+      Task mTask;
+      void* mContext;
+      ::std::atomic<Count> mRemaining;
+      ::std::mutex mErrorLock;
+      ::std::exception_ptr mError;
+
+      /// Execute a chunk, capturing the first exception                      
+      void Execute(Offset chunk) noexcept {
+         try { mTask(mContext, chunk); }
+         catch (...) {
+            ::std::scoped_lock lock {mErrorLock};
+            if (not mError)
+               mError = ::std::current_exception();
+         }
+
+         mRemaining.fetch_sub(1, ::std::memory_order_acq_rel);
+      }
+   };
+
+   /// A chunk waiting in a queue                                             
+   struct Chunk {
+      Job* mJob;
+      Offset mIndex;
+   };
+
+   /// Each worker has its own queue - workers pop from the back, thieves     
+   /// steal from the front, which reduces contention on the same end         
+   struct Queue {
+      ::std::mutex mLock;
+      ::std::deque<Chunk> mChunks;
+
+      bool Pop(Chunk& out) {
+         ::std::scoped_lock lock {mLock};
+         if (mChunks.empty())
+            return false;
+         out = mChunks.back();
+         mChunks.pop_back();
+         return true;
+      }
+
+      bool Steal(Chunk& out) {
+         ::std::scoped_lock lock {mLock};
+         if (mChunks.empty())
+            return false;
+         out = mChunks.front();
+         mChunks.pop_front();
+         return true;
+      }
+   };
+
+   /// Thread pool internals                                                  
+   struct ThreadPool::State {
+      ::std::vector<::std::thread> mWorkers;
+      // One queue per worker, plus one for external threads            
+      ::std::unique_ptr<Queue[]> mQueues;
+      Count mQueueCount;
+
+      ::std::mutex mSleepLock;
+      ::std::condition_variable mWake;
+      ::std::atomic<Count> mQueued {0};
+      bool mStop = false;
+
+      /// Find a chunk, starting from a given queue, and execute it           
+      ///   @param home - the queue to pop from first                         
+      ///   @return true if a chunk was executed                              
+      bool TryExecute(Offset home) {
+         Chunk chunk;
+         bool found = mQueues[home].Pop(chunk);
+         for (Offset i = 1; not found and i < mQueueCount; ++i)
+            found = mQueues[(home + i) % mQueueCount].Steal(chunk);
+
+         if (not found)
+            return false;
+
+         mQueued.fetch_sub(1, ::std::memory_order_relaxed);
+         chunk.mJob->Execute(chunk.mIndex);
+         return true;
+      }
+
+      /// Worker thread loop                                                  
+      ///   @param home - the queue that belongs to the worker                
+      void Work(Offset home) {
+         while (true) {
+            if (TryExecute(home))
+               continue;
+
+            ::std::unique_lock lock {mSleepLock};
+            mWake.wait(lock, [this] {
+               return mStop or mQueued.load(::std::memory_order_relaxed) > 0;
+            });
+
+            if (mStop)
+               return;
+         }
+      }
+
+      /// Wake all workers up, and wait for them to finish                    
+      void Stop() noexcept {
+         {
+            ::std::scoped_lock lock {mSleepLock};
+            mStop = true;
+         }
+
+         mWake.notify_all();
+         for (auto& worker : mWorkers)
+            worker.join();
+      }
+   };
+
+   /// Create a thread pool                                                   
+   ///   @param threads - number of threads to execute tasks with, including  
+   ///      the thread that calls Run(); zero to use all hardware threads     
+   ThreadPool::ThreadPool(Count threads) {
+      if (not threads)
+         threads = ::std::thread::hardware_concurrency();
+      if (not threads)
+         threads = 1;
+
+      // The state is owned here, until all workers have been started   
+      auto state = ::std::make_unique<State>();
+
+      // The calling thread always participates, so spawn one less      
+      state->mQueueCount = threads;
+      state->mQueues = ::std::make_unique<Queue[]>(threads);
+      state->mWorkers.reserve(threads - 1);
+
+      try {
+         for (Offset i = 1; i < threads; ++i)
+            state->mWorkers.emplace_back([s = state.get(), i] { s->Work(i); });
+      }
+      catch (...) {
+         // Workers that already started must be joined, before the     
+         // state they use is destroyed                                 
+         state->Stop();
+         throw;
+      }
+
+      mState = state.release();
+   }
+
+   /// Stop and join all workers                                              
+   ThreadPool::~ThreadPool() {
+      mState->Stop();
+      delete mState;
+   }
+
+   /// Get the number of threads that can execute tasks                       
+   ///   @return the number of workers plus the calling thread                
+   Count ThreadPool::GetConcurrency() const noexcept {
+      return mState->mQueueCount;
+   }
+
+   /// Execute a task for chunks [0; count), and block until all are done     
+   ///   @param count - the number of chunks                                  
+   ///   @param task - the task to execute for each chunk                     
+   ///   @param context - the context to pass to each task                    
+   void ThreadPool::Run(Count count, Task task, void* context) {
+      if (not count)
+         return;
+
+      Job job {task, context, count};
+
+      {
+         // Count the chunks before publishing them, so that a worker   
+         // that takes one right away can't make the counter underflow  
+         ::std::scoped_lock lock {mState->mSleepLock};
+         mState->mQueued.fetch_add(count, ::std::memory_order_relaxed);
+      }
+
+      // Spread the chunks evenly between the queues                    
+      for (Offset i = 0; i < count; ++i) {
+         auto& queue = mState->mQueues[i % mState->mQueueCount];
+         ::std::scoped_lock lock {queue.mLock};
+         queue.mChunks.push_back({&job, i});
+      }
+
+      mState->mWake.notify_all();
+
+      // Help out until our job is done - we might end up executing     
+      // chunks of other jobs, too, which is fine                       
+      while (job.mRemaining.load(::std::memory_order_acquire)) {
+         if (not mState->TryExecute(0))
+            ::std::this_thread::yield();
+      }
+
+      if (job.mError)
+         ::std::rethrow_exception(job.mError);
+   }
+
+
+   namespace
+   {
+
+      /// The default executor, created on first use                          
+      ///   @attention throws if the worker threads can't be started          
+      ThreadPool& GetDefaultExecutor() {
+         static ThreadPool pool;
+         return pool;
+      }
+
+      /// The installed executor                                              
+      ::std::atomic<Executor*> InstalledExecutor {nullptr};
+
+   } // anonymous namespace
+
+   /// Get the currently installed executor                                   
+   ///   @attention creating the default thread pool may throw                
+   ///   @return the installed executor, or the default thread pool           
+   Executor& GetExecutor() {
+      const auto installed = InstalledExecutor.load(::std::memory_order_acquire);
+      return installed ? *installed : GetDefaultExecutor();
+   }
+
+   /// Install an executor, that will be used by all parallel algorithms      
+   ///   @param executor - the executor to use, or nullptr to use the default 
+   void SetExecutor(Executor* executor) noexcept {
+      InstalledExecutor.store(executor, ::std::memory_order_release);
+   }
+
+} // namespace Langulus::Anyness::Parallel
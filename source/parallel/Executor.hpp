@@ -0,0 +1,129 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Config.hpp"
+
+
+namespace Langulus::Anyness::Parallel
+{
+
+   /// A task function, that is executed once for each chunk of a job         
+   ///   @param context - the job-specific context                            
+   ///   @param chunk - the index of the chunk to process                     
+   using Task = void(*)(void* context, Offset chunk);
+
+   /// Jobs with less elements than this are always executed serially         
+   constexpr Count SerialThreshold = 8192;
+
+   /// Minimum number of elements processed by a single chunk                 
+   constexpr Count MinimumGrain = 2048;
+
+
+   ///                                                                        
+   ///   Executor interface                                                   
+   ///                                                                        
+   ///   Parallel algorithms in Anyness don't spawn threads on their own, but 
+   /// dispatch chunks of work to an executor. Implement this interface to    
+   /// plug your own job system in, and install it via SetExecutor().         
+   ///   Keep in mind, that tasks may allocate memory, so your allocator must 
+   /// be thread-safe, when using a custom executor.                          
+   ///                                                                        
+   struct Executor {
+      virtual ~Executor() = default;
+
+      /// Get the number of threads that can execute tasks simultaneously,    
+      /// including the thread that calls Run()                               
+      NOD() virtual Count GetConcurrency() const noexcept = 0;
+
+      /// Execute a task for chunks [0; count), and block until all are done  
+      /// The calling thread should participate, so that Run() can be safely  
+      /// called from inside another task. If any task throws, the rest of    
+      /// the tasks are still executed, and the first exception is rethrown   
+      virtual void Run(Count count, Task, void* context) = 0;
+   };
+
+
+   ///                                                                        
+   ///   Work-stealing thread pool                                            
+   ///                                                                        
+   ///   The default executor. Each worker has its own queue of chunks - it   
+   /// takes from its back, and when out of work, steals from the front of    
+   /// other workers' queues. Chunks of a job are spread evenly between the   
+   /// queues, so that stealing is only needed to balance uneven chunks.      
+   ///                                                                        
+   class ThreadPool final : public Executor {
+      struct State;
+      State* mState;
+
+   public:
+      LANGULUS_API(ANYNESS) explicit ThreadPool(Count threads = 0);
+      ThreadPool(const ThreadPool&) = delete;
+      LANGULUS_API(ANYNESS) ~ThreadPool();
+
+      LANGULUS_API(ANYNESS) Count GetConcurrency() const noexcept override;
+      LANGULUS_API(ANYNESS) void Run(Count, Task, void*) override;
+   };
+
+   /// Get the currently installed executor                                   
+   ///   @attention creating the default thread pool on first use throws      
+   ///      std::system_error, if its worker threads can't be started         
+   ///   @return the installed executor, or the default thread pool           
+   LANGULUS_API(ANYNESS) Executor& GetExecutor();
+
+   /// Install an executor, that will be used by all parallel algorithms      
+   ///   @attention the executor must outlive all uses of the algorithms      
+   ///   @param executor - the executor to use, or nullptr to use the default 
+   LANGULUS_API(ANYNESS) void SetExecutor(Executor* executor) noexcept;
+
+   /// Calculate the number of chunks a job should be split into              
+   ///   @param count - the number of elements in the job                     
+   ///   @param grain - the minimum number of elements in a chunk             
+   ///   @return the number of chunks, 1 means job should run serially        
+   LANGULUS(INLINED)
+   Count GetChunkCount(Count count, Count grain = MinimumGrain) {
+      if (count < SerialThreshold)
+         return 1;
+
+      // Oversubscribe a bit, so that stealing can balance uneven loads 
+      const auto threads = GetExecutor().GetConcurrency();
+      if (threads < 2)
+         return 1;
+
+      const auto chunks = (count + grain - 1) / grain;
+      return chunks < threads * 4 ? chunks : threads * 4;
+   }
+
+   /// Get the first element of a chunk                                       
+   ///   @param count - the number of elements in the job                     
+   ///   @param chunks - the number of chunks in the job                      
+   ///   @param chunk - the chunk index                                       
+   ///   @return the offset of the first element in the chunk                 
+   LANGULUS(INLINED)
+   constexpr Offset GetChunkStart(Count count, Count chunks, Offset chunk) noexcept {
+      return static_cast<Offset>(
+         (static_cast<unsigned long long>(count) * chunk) / chunks);
+   }
+
+   /// Execute a callable for each chunk, using the installed executor        
+   ///   @param chunks - the number of chunks                                 
+   ///   @param call - the function to call for each chunk index              
+   LANGULUS(INLINED)
+   void Execute(Count chunks, auto&& call) {
+      if (chunks < 2) {
+         for (Offset i = 0; i < chunks; ++i)
+            call(i);
+         return;
+      }
+
+      using F = Deref<decltype(call)>;
+      GetExecutor().Run(chunks, [](void* context, Offset chunk) {
+         (*static_cast<F*>(context))(chunk);
+      }, const_cast<void*>(static_cast<const void*>(&call)));
+   }
+
+} // namespace Langulus::Anyness::Parallel
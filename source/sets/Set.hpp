@@ -25,6 +25,7 @@ namespace Langulus::Anyness
 
       static constexpr bool Ownership = true;
       static constexpr bool Ordered = ORDERED;
+      using CTTI_Relocatable = Set;
 
       ///                                                                     
       ///   Construction                                                      
@@ -111,6 +112,15 @@ namespace Langulus::Anyness
       ///                                                                     
       ///   Insertion                                                         
       ///                                                                     
+      template<class T1, class...TN>
+      Count Insert(T1&&, TN&&...);
+
+      template<class T1> requires CT::Set<Deint<T1>>
+      Count InsertBlock(T1&&);
+
+      template<class T1> requires CT::Block<Deint<T1>>
+      Count InsertBlock(T1&&);
+
       Set& operator << (CT::UnfoldInsertable auto&&);
       Set& operator >> (CT::UnfoldInsertable auto&&);
    };
@@ -271,6 +271,31 @@ namespace Langulus::Anyness
       return BlockSet::FindIt<Set>(key);
    }
 
+   /// Unfold-insert elements, with or without intents                        
+   ///   @param t1 - element, or array of elements, to insert                 
+   ///   @param tn... - the rest of the elements (optional)                   
+   ///   @return the number of inserted elements                              
+   TEMPLATE() template<class T1, class...TN> LANGULUS(INLINED)
+   Count TABLE()::Insert(T1&& t1, TN&&...tn) {
+      return BlockSet::Insert<Set>(Forward<T1>(t1), Forward<TN>(tn)...);
+   }
+
+   /// Insert all elements of a set, with or without intents                  
+   ///   @param t1 - the set to insert                                        
+   ///   @return number of inserted elements                                  
+   TEMPLATE() template<class T1> requires CT::Set<Deint<T1>> LANGULUS(INLINED)
+   Count TABLE()::InsertBlock(T1&& t1) {
+      return BlockSet::InsertBlock<Set>(Forward<T1>(t1));
+   }
+
+   /// Insert all elements of a block, with or without intents                
+   ///   @param t1 - the block to insert                                      
+   ///   @return number of inserted elements                                  
+   TEMPLATE() template<class T1> requires CT::Block<Deint<T1>> LANGULUS(INLINED)
+   Count TABLE()::InsertBlock(T1&& t1) {
+      return BlockSet::InsertBlock<Set>(Forward<T1>(t1));
+   }
+
    /// Insert an element/set/array in the set                                 
    ///   @attention << and >> do the same thing, as sets aren't sequential    
    ///   @param other - the data to insert                                    
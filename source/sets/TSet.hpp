@@ -48,6 +48,8 @@ namespace Langulus::Anyness
       LANGULUS(TYPED) T;
       LANGULUS_BASES(Set<ORDERED>);
 
+      using CTTI_Relocatable = TSet;
+
    protected:
       static_assert(CT::Comparable<T, T>,
          "Set's type must be equality-comparable to itself");
@@ -355,15 +355,38 @@ namespace Langulus::Anyness
       if (offset >= sentinel)
          return end();
 
-      RemoveInner<T>(offset--); //TODO what if map shrinks, offset might become invalid? Doesn't shrink for now
+      if constexpr (ORDERED) {
+         // The previous element in insertion order might get shifted   
+         auto previous = GetOrderPrev(offset);
+         RemoveInner<TSet>(offset);
+
+         if (IsEmpty())
+            return end();
+
+         if (previous == sentinel)
+            previous = GetOrderNext(sentinel);
+         else
+            previous = GetShiftedIndex(offset, previous);
+         offset = previous;
+      }
+      else {
+         RemoveInner<TSet>(offset--); //TODO what if map shrinks, offset might become invalid? Doesn't shrink for now
+
+         if (IsEmpty())
+            return end();
       
-      while (offset < sentinel and 0 == mInfo[offset])
-         --offset;
+         while (offset < sentinel and 0 == mInfo[offset])
+            --offset;
 
-      if (offset >= sentinel)
-         offset = 0;
+         if (offset >= sentinel)
+            offset = 0;
+      }
 
-      return {mInfo + offset, index.mSentinel, &GetRaw<TSet>(offset)};
+      return {
+         mInfo + offset, GetInfoEnd(),
+         GetRaw<TSet>(offset),
+         GetOrderLink<TSet>(offset)
+      };
    }
 
    /// Erase a pair via key                                                   
@@ -424,7 +447,8 @@ namespace Langulus::Anyness
 
       return {
          GetInfo() + found, GetInfoEnd(),
-         GetRaw<TABLE()>(found)
+         GetRaw<TABLE()>(found),
+         GetOrderLink<TABLE()>(found)
       };
    }
 
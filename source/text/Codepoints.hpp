@@ -0,0 +1,74 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Text.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Validated UTF-8 view                                                 
+   ///                                                                        
+   ///   References the memory of a Text, after making sure it is valid       
+   /// UTF-8, so that it can be iterated codepoint by codepoint without any   
+   /// further checks. Codepoints can also be selected, which produces Text   
+   /// views over the original allocation, without copying any letters.       
+   ///   Grapheme clusters are not considered - that requires the Unicode     
+   /// character database, which is outside the scope of this library.        
+   ///                                                                        
+   class Codepoints {
+      // The validated text                                             
+      Text mText;
+
+   public:
+      ///                                                                     
+      ///   Codepoint iterator                                                
+      ///                                                                     
+      struct Iterator {
+         const Letter* mValue;
+         const Letter* mEnd;
+
+         NOD() char32_t operator * () const noexcept;
+         Iterator& operator ++ () noexcept;
+         Iterator  operator ++ (int) noexcept;
+         NOD() constexpr bool operator == (const Iterator&) const noexcept = default;
+      };
+
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      Codepoints() = default;
+      Codepoints(const Codepoints&) = default;
+      Codepoints(Codepoints&&) noexcept = default;
+      explicit Codepoints(const Text&);
+
+      Codepoints& operator = (const Codepoints&) = default;
+      Codepoints& operator = (Codepoints&&) noexcept = default;
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() const Text& GetText() const noexcept;
+      NOD() Count GetCount() const noexcept;
+      NOD() bool IsEmpty() const noexcept;
+
+      ///                                                                     
+      ///   Indexing                                                          
+      ///                                                                     
+      NOD() Text Select(Offset, Count) const;
+      NOD() Text Select(Offset) const;
+
+      ///                                                                     
+      ///   Iteration                                                         
+      ///                                                                     
+      NOD() Iterator begin() const noexcept;
+      NOD() Iterator end() const noexcept;
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,123 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Codepoints.hpp"
+#include "Text.inl"
+
+
+namespace Langulus::Anyness
+{
+
+   /// Reference a text as UTF-8                                              
+   ///   @param text - the text to validate and reference                     
+   ///   @throw Except::Convert if text isn't valid UTF-8                     
+   LANGULUS(INLINED)
+   Codepoints::Codepoints(const Text& text) {
+      LANGULUS_ASSERT(text.IsValidUTF8(), Convert, "Text isn't valid UTF-8");
+      mText = text;
+   }
+
+   /// Get the referenced text                                                
+   ///   @return the text                                                     
+   LANGULUS(INLINED)
+   const Text& Codepoints::GetText() const noexcept {
+      return mText;
+   }
+
+   /// Count the codepoints                                                   
+   ///   @return the number of codepoints                                     
+   LANGULUS(INLINED)
+   Count Codepoints::GetCount() const noexcept {
+      return Inner::CountCodepoints(
+         reinterpret_cast<const char*>(mText.GetRaw()), mText.GetCount());
+   }
+
+   /// Check if there are any codepoints                                      
+   ///   @return true if text is empty                                        
+   LANGULUS(INLINED)
+   bool Codepoints::IsEmpty() const noexcept {
+      return mText.IsEmpty();
+   }
+
+   /// Select a range of codepoints                                           
+   ///   @param start - index of the first codepoint                          
+   ///   @param count - number of codepoints, clamped to the available ones   
+   ///   @return new text that references the original memory                 
+   LANGULUS(INLINED)
+   Text Codepoints::Select(const Offset start, const Count count) const {
+      const auto raw = reinterpret_cast<const char*>(mText.GetRaw());
+      const auto from = Inner::SkipCodepoints(raw, mText.GetCount(), start);
+      LANGULUS_ASSERT(from < mText.GetCount() or (from == mText.GetCount() and not count),
+         Access, "Codepoint index out of range");
+
+      const auto to = from + Inner::SkipCodepoints(
+         raw + from, mText.GetCount() - from, count);
+      return mText.Select(from, to - from);
+   }
+
+   /// Select all codepoints after a codepoint                                
+   ///   @param start - index of the first codepoint                          
+   ///   @return new text that references the original memory                 
+   LANGULUS(INLINED)
+   Text Codepoints::Select(const Offset start) const {
+      const auto from = Inner::SkipCodepoints(
+         reinterpret_cast<const char*>(mText.GetRaw()), mText.GetCount(), start);
+      return mText.Select(from, mText.GetCount() - from);
+   }
+
+   /// Get an iterator to the first codepoint                                 
+   ///   @return the iterator                                                 
+   LANGULUS(INLINED)
+   Codepoints::Iterator Codepoints::begin() const noexcept {
+      return {mText.GetRaw(), mText.GetRaw() + mText.GetCount()};
+   }
+
+   /// Get an iterator past the last codepoint                                
+   ///   @return the iterator                                                 
+   LANGULUS(INLINED)
+   Codepoints::Iterator Codepoints::end() const noexcept {
+      const auto end = mText.GetRaw() + mText.GetCount();
+      return {end, end};
+   }
+
+   /// Decode the current codepoint                                           
+   ///   @return the codepoint                                                
+   LANGULUS(INLINED)
+   char32_t Codepoints::Iterator::operator * () const noexcept {
+      char32_t codepoint = 0;
+      (void) Inner::DecodeUTF8(
+         reinterpret_cast<const char*>(mValue), mEnd - mValue, codepoint);
+      return codepoint;
+   }
+
+   /// Move to the next codepoint                                             
+   /// The text is validated, so the size is known from the lead byte alone   
+   ///   @return a reference to this iterator                                 
+   LANGULUS(INLINED)
+   Codepoints::Iterator& Codepoints::Iterator::operator ++ () noexcept {
+      const auto lead = static_cast<Byte>(*mValue);
+      mValue += lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+      return *this;
+   }
+
+   LANGULUS(INLINED)
+   Codepoints::Iterator Codepoints::Iterator::operator ++ (int) noexcept {
+      const auto backup = *this;
+      operator ++ ();
+      return backup;
+   }
+
+   /// Get a validated UTF-8 view of the text, to iterate codepoints          
+   ///   @return the view, referencing this text's memory                     
+   ///   @throw Except::Convert if text isn't valid UTF-8                     
+   LANGULUS(INLINED)
+   Codepoints Text::GetCodepoints() const {
+      return Codepoints {*this};
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
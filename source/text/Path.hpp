@@ -22,6 +22,7 @@ namespace Langulus::Anyness
       LANGULUS_BASES(Text);
       LANGULUS_CONVERTS_FROM(Text);
 
+      using CTTI_Relocatable = Path;
       static constexpr char Separator = '/';
 
       using Text::Text;
@@ -0,0 +1,63 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Text.hpp"
+#include "../many/TSmallMany.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Small text container                                                 
+   ///                                                                        
+   ///   Keeps short texts, like names, keys and tokens, inside itself, and   
+   /// allocates only when they grow beyond InlineCapacity letters. It hashes 
+   /// and compares just like Text, so both can be used to search the same    
+   /// maps and sets. Convert it to Text, when a managed container is needed. 
+   ///                                                                        
+   struct SmallText : TSmallMany<Letter, 16> {
+      using Base = TSmallMany<Letter, 16>;
+
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      constexpr SmallText() noexcept = default;
+      SmallText(const SmallText&) = default;
+      SmallText(SmallText&&) noexcept = default;
+      SmallText(const Token&);
+      SmallText(const Letter*);
+      SmallText(const Text&);
+
+      SmallText& operator = (const SmallText&) = default;
+      SmallText& operator = (SmallText&&) noexcept = default;
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() operator Token () const noexcept;
+      NOD() Text GetView() const noexcept;
+
+      ///                                                                     
+      ///   Comparison                                                        
+      ///                                                                     
+      bool operator == (const SmallText&) const noexcept;
+      bool operator == (const CT::Text auto&) const noexcept;
+
+      ///                                                                     
+      ///   Concatenation                                                     
+      ///                                                                     
+      SmallText& operator += (const Token&);
+
+      ///                                                                     
+      ///   Conversion                                                        
+      ///                                                                     
+      NOD() operator Text () const;
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
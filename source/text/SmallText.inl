@@ -0,0 +1,86 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "SmallText.hpp"
+#include "Text.inl"
+#include "../many/TSmallMany.inl"
+
+
+namespace Langulus::Anyness
+{
+
+   /// Copy letters from a token                                              
+   ///   @param text - the letters to copy                                    
+   LANGULUS(INLINED)
+   SmallText::SmallText(const Token& text)
+      : Base {text.data(), static_cast<Count>(text.size())} {}
+
+   /// Copy letters from a null-terminated string                             
+   ///   @param text - the string to copy, can be nullptr                     
+   LANGULUS(INLINED)
+   SmallText::SmallText(const Letter* text)
+      : Base {text, text ? static_cast<Count>(::std::strlen(text)) : 0} {}
+
+   /// Copy letters from a text container                                     
+   ///   @param text - the text to copy                                       
+   LANGULUS(INLINED)
+   SmallText::SmallText(const Text& text)
+      : Base {text.GetRaw(), text.GetCount()} {}
+
+   /// Interface the letters as a token                                       
+   ///   @attention the token is invalidated as soon as the container changes 
+   ///   @return the token                                                    
+   LANGULUS(INLINED)
+   SmallText::operator Token () const noexcept {
+      return {GetRaw(), GetCount()};
+   }
+
+   /// Interface the letters as a Text, without ownership, and without        
+   /// null-terminator detection                                              
+   ///   @attention the view is invalidated as soon as the container changes  
+   ///   @return the text view                                                
+   LANGULUS(INLINED)
+   Text SmallText::GetView() const noexcept {
+      return MakeBlock<Text>(const_cast<Letter*>(GetRaw()), GetCount());
+   }
+
+   /// Compare with another small text                                        
+   ///   @param rhs - the text to compare with                                
+   ///   @return true if both texts have the same letters                     
+   LANGULUS(INLINED)
+   bool SmallText::operator == (const SmallText& rhs) const noexcept {
+      return static_cast<Token>(*this) == static_cast<Token>(rhs);
+   }
+
+   /// Compare with any kind of text                                          
+   ///   @param rhs - the text to compare with                                
+   ///   @return true if both texts have the same letters                     
+   LANGULUS(INLINED)
+   bool SmallText::operator == (const CT::Text auto& rhs) const noexcept {
+      return GetView() == rhs;
+   }
+
+   /// Append letters                                                         
+   ///   @param rhs - the letters to append                                   
+   ///   @return a reference to this container for chaining                   
+   LANGULUS(INLINED)
+   SmallText& SmallText::operator += (const Token& rhs) {
+      Reserve(GetCount() + static_cast<Count>(rhs.size()));
+      for (auto letter : rhs)
+         *this << letter;
+      return *this;
+   }
+
+   /// Copy the letters into a Text container                                 
+   ///   @return the new text                                                 
+   LANGULUS(INLINED)
+   SmallText::operator Text () const {
+      return Text {static_cast<Token>(*this)};
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,104 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "Symbol.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+
+namespace Langulus::Anyness
+{
+
+   namespace
+   {
+
+      /// The table is split into shards by hash, each with its own lock, so  
+      /// that threads interning different texts rarely contend               
+      constexpr Count SymbolShards = 64;
+
+      /// A part of the intern table                                          
+      struct SymbolShard {
+         ::std::shared_mutex mLock;
+         ::std::unordered_multimap<decltype(Hash::mHash), const Symbol::Entry*> mEntries;
+
+         /// Find an interned entry                                           
+         ///   @param token - the letters to search for                       
+         ///   @param hash - the hash of the letters                          
+         ///   @return the entry, or nullptr if not interned yet              
+         const Symbol::Entry* Find(const Token& token, Hash hash) const noexcept {
+            const auto [first, last] = mEntries.equal_range(hash.mHash);
+            for (auto it = first; it != last; ++it) {
+               if (it->second->mToken == token)
+                  return it->second;
+            }
+            return nullptr;
+         }
+      };
+
+      /// The global intern table                                             
+      struct SymbolTable {
+         SymbolShard mShards[SymbolShards];
+         ::std::atomic<Count> mCount {0};
+      };
+
+      /// Get the intern table, created on first use                          
+      /// It is intentionally never destroyed, so that symbols remain valid   
+      /// even while other static objects are being destroyed                 
+      ///   @return the intern table                                          
+      SymbolTable& GetSymbolTable() {
+         static const auto table = new SymbolTable;
+         return *table;
+      }
+
+   } // anonymous namespace
+
+   /// Find an interned text, or intern it, if not found                      
+   ///   @param token - the letters to intern, must not be empty              
+   ///   @param hash - the hash of the letters, as computed by Text           
+   ///   @return the interned entry                                           
+   const Symbol::Entry* Symbol::Intern(const Token& token, Hash hash) {
+      auto& table = GetSymbolTable();
+      auto& shard = table.mShards[hash.mHash % SymbolShards];
+
+      {
+         // Most texts are already interned, so look them up under a    
+         // shared lock first                                           
+         ::std::shared_lock lock {shard.mLock};
+         if (const auto found = shard.Find(token, hash))
+            return found;
+      }
+
+      ::std::unique_lock lock {shard.mLock};
+      if (const auto found = shard.Find(token, hash))
+         return found;
+
+      // Interned memory bypasses the allocator on purpose - it must    
+      // not come from an arena, and it is never released               
+      const auto size = token.size() * sizeof(Letter);
+      const auto memory = static_cast<Byte*>(
+         ::std::malloc(sizeof(Entry) + size));
+      LANGULUS_ASSERT(memory, Allocate, "Out of memory while interning text");
+
+      const auto letters = reinterpret_cast<Letter*>(memory + sizeof(Entry));
+      ::std::memcpy(letters, token.data(), size);
+      const auto entry = new (memory) Entry {hash, Token {letters, token.size()}};
+      shard.mEntries.emplace(hash.mHash, entry);
+      table.mCount.fetch_add(1, ::std::memory_order_relaxed);
+      return entry;
+   }
+
+   /// Get the number of distinct interned texts                              
+   ///   @return the number of interned texts                                 
+   Count Symbol::GetInternedCount() noexcept {
+      return GetSymbolTable().mCount.load(::std::memory_order_relaxed);
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
@@ -0,0 +1,86 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Text.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Interned immutable text                                              
+   ///                                                                        
+   ///   Each distinct text is stored only once, inside a global table, and   
+   /// a symbol is just a pointer to its interned entry. The entry's hash is  
+   /// computed once, when the text is interned, so hashing a symbol is a     
+   /// load, and comparing two symbols is a pointer comparison. Meant for     
+   /// texts that repeat a lot - map keys, names, identifiers, etc.           
+   ///   Interning is thread-safe. Interned texts are never released, so      
+   /// don't intern texts that are unbounded in variety, like user input.     
+   ///   Symbols hash exactly like the equivalent Text, and convert to and    
+   /// from it. They serialize as text.                                       
+   ///                                                                        
+   class Symbol {
+   public:
+      /// An interned text, followed by its letters                           
+      struct Entry {
+         Hash  mHash;
+         Token mToken;
+      };
+
+   private:
+      LANGULUS(NAME) "Symbol";
+      LANGULUS(POD) false;
+      LANGULUS_CONVERTS_TO(Text);
+
+      // The interned text, or nullptr if symbol is empty               
+      const Entry* mEntry {};
+
+      NOD() LANGULUS_API(ANYNESS)
+      static const Entry* Intern(const Token&, Hash);
+
+   public:
+      using CTTI_Relocatable = Symbol;
+
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      constexpr Symbol() noexcept = default;
+      constexpr Symbol(::std::nullptr_t) noexcept {}
+      Symbol(const Token&);
+      Symbol(const Letter*);
+      Symbol(const Text&);
+
+      NOD() LANGULUS_API(ANYNESS)
+      static Count GetInternedCount() noexcept;
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() constexpr Count GetCount() const noexcept;
+      NOD() constexpr bool IsEmpty() const noexcept;
+      NOD() constexpr explicit operator bool() const noexcept;
+      NOD() constexpr Letter const* GetRaw() const noexcept;
+
+      NOD() constexpr operator Token () const noexcept;
+
+      ///                                                                     
+      ///   Comparison                                                        
+      ///                                                                     
+      NOD() constexpr Hash GetHash() const noexcept;
+
+      constexpr bool operator == (const Symbol&) const noexcept;
+      bool operator == (const CT::Text auto&) const noexcept;
+
+      ///                                                                     
+      ///   Conversion                                                        
+      ///                                                                     
+      NOD() operator Text () const;
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
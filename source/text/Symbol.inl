@@ -0,0 +1,116 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Symbol.hpp"
+#include "Text.inl"
+
+
+namespace Langulus::Anyness
+{
+
+   /// Intern a token                                                         
+   /// The hash is computed here, the same way Text computes it, and then     
+   /// used to find the interned entry                                        
+   ///   @param text - the letters to intern                                  
+   LANGULUS(INLINED)
+   Symbol::Symbol(const Token& text) {
+      if (text.empty())
+         return;
+
+      const auto view = MakeBlock<Text>(
+         const_cast<Letter*>(text.data()), static_cast<Count>(text.size()));
+      mEntry = Intern(text, view.GetHash());
+   }
+
+   /// Intern a null-terminated string                                        
+   ///   @param text - the string to intern, can be nullptr                   
+   LANGULUS(INLINED)
+   Symbol::Symbol(const Letter* text)
+      : Symbol {text ? Token {text} : Token {}} {}
+
+   /// Intern the contents of a text container                                
+   /// Since the text container already knows its hash, interning it is       
+   /// just a lookup                                                          
+   ///   @param text - the text to intern                                     
+   LANGULUS(INLINED)
+   Symbol::Symbol(const Text& text) {
+      if (text.IsEmpty())
+         return;
+
+      mEntry = Intern(static_cast<Token>(text), text.GetHash());
+   }
+
+   /// Get the number of letters                                              
+   ///   @return the number of letters                                        
+   LANGULUS(INLINED)
+   constexpr Count Symbol::GetCount() const noexcept {
+      return mEntry ? static_cast<Count>(mEntry->mToken.size()) : 0;
+   }
+
+   /// Check if symbol is empty                                               
+   ///   @return true if symbol has no letters                                
+   LANGULUS(INLINED)
+   constexpr bool Symbol::IsEmpty() const noexcept {
+      return not mEntry;
+   }
+
+   /// Check if symbol has any letters                                        
+   ///   @return true if not empty                                            
+   LANGULUS(INLINED)
+   constexpr Symbol::operator bool() const noexcept {
+      return mEntry;
+   }
+
+   /// Get the interned letters                                               
+   ///   @attention letters are not null-terminated                           
+   ///   @return a pointer to the first letter, or nullptr if empty           
+   LANGULUS(INLINED)
+   constexpr Letter const* Symbol::GetRaw() const noexcept {
+      return mEntry ? mEntry->mToken.data() : nullptr;
+   }
+
+   /// Interface the interned letters as a token                              
+   /// Interned letters are never released, so the token is always valid      
+   ///   @return the token                                                    
+   LANGULUS(INLINED)
+   constexpr Symbol::operator Token () const noexcept {
+      return mEntry ? mEntry->mToken : Token {};
+   }
+
+   /// Get the hash, that was computed when the text was interned             
+   ///   @return the hash                                                     
+   LANGULUS(INLINED)
+   constexpr Hash Symbol::GetHash() const noexcept {
+      return mEntry ? mEntry->mHash : Hash {};
+   }
+
+   /// Compare two symbols                                                    
+   /// Equal texts are interned only once, so comparing pointers is enough    
+   ///   @param rhs - the symbol to compare with                              
+   ///   @return true if both symbols refer to the same text                  
+   LANGULUS(INLINED)
+   constexpr bool Symbol::operator == (const Symbol& rhs) const noexcept {
+      return mEntry == rhs.mEntry;
+   }
+
+   /// Compare with any kind of text, letter by letter                        
+   ///   @param rhs - the text to compare with                                
+   ///   @return true if the text has the same letters                        
+   LANGULUS(INLINED)
+   bool Symbol::operator == (const CT::Text auto& rhs) const noexcept {
+      return Text::From(Disown(GetRaw()), GetCount()) == rhs;
+   }
+
+   /// Copy the interned letters into a Text container                        
+   ///   @return the new text                                                 
+   LANGULUS(INLINED)
+   Symbol::operator Text () const {
+      return Text {static_cast<Token>(*this)};
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
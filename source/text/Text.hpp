@@ -207,6 +207,9 @@ namespace Langulus::A
 namespace Langulus::Anyness
 {
 
+   class Codepoints;
+
+
    ///                                                                        
    ///   Count-terminated UTF text container                                  
    ///                                                                        
@@ -222,6 +225,7 @@ namespace Langulus::Anyness
       using Base = Block<Letter>;
       static constexpr bool CTTI_TextTrait = true;
       static constexpr bool Ownership = true;
+      using CTTI_Relocatable = Text;
 
       LANGULUS(NAME) "Text";
       LANGULUS(DEEP) false;
@@ -255,9 +259,9 @@ namespace Langulus::Anyness
          static constexpr bool CriticalFailure = false;
          static constexpr bool SkipElements = true;
 
-         static bool BeginScope(const CT::Block auto&, Text&);
-         static bool EndScope(const CT::Block auto&, Text&);
-         static bool Separate(const CT::Block auto&, Text&);
+         static bool BeginScope(const CT::Block auto&, auto&);
+         static bool EndScope(const CT::Block auto&, auto&);
+         static bool Separate(const CT::Block auto&, auto&);
          
          using Rules = Types<
             Serial::Rule<Serial::Wrap, Serial::BasedOn, A::Code,Operator::OpenCode,      Operator::CloseCode>,
@@ -365,8 +369,10 @@ namespace Langulus::Anyness
       ///                                                                     
       ///   Removal                                                           
       ///                                                                     
-      NOD() Text Strip  (const CT::Text auto&) const;
-      NOD() Text Replace(const CT::Text auto& what, const CT::Text auto& with) const;
+      NOD() Text Strip  (const CT::Text auto&) const&;
+      NOD() Text Strip  (const CT::Text auto&) &&;
+      NOD() Text Replace(const CT::Text auto& what, const CT::Text auto& with) const&;
+      NOD() Text Replace(const CT::Text auto& what, const CT::Text auto& with) &&;
 
       ///                                                                     
       ///   Concatenation                                                     
@@ -392,6 +398,9 @@ namespace Langulus::Anyness
 
       void UnfoldInsert(auto&&);
 
+      NOD() Text ReplaceCopy(const Text&, const Text&) const;
+      NOD() bool ReplaceInPlace(const Text&, const Text&);
+
    public:
       ///                                                                     
       ///   Services                                                          
@@ -399,11 +408,6 @@ namespace Langulus::Anyness
       NOD() Text Lowercase() const;
       NOD() Text Uppercase() const;
 
-      #if LANGULUS_FEATURE(UNICODE)
-         NOD() TMany<char16_t> Widen16() const;
-         NOD() TMany<char32_t> Widen32() const;
-      #endif
-
       NOD() static Text Hex(const auto&);
       template<class...ARGS>
       NOD() static Text Template(const Token&, ARGS&&...);
@@ -412,6 +416,19 @@ namespace Langulus::Anyness
       template<class...ARGS>
       NOD() static constexpr auto TemplateCheck(const Token&, ARGS&&...);
 
+      ///                                                                     
+      ///   Unicode                                                           
+      ///                                                                     
+      NOD() bool IsValidUTF8() const noexcept;
+      NOD() Codepoints GetCodepoints() const;
+      NOD() TMany<char16_t> Widen16() const;
+      NOD() TMany<char32_t> Widen32() const;
+
+      template<class T> requires (CT::Exact<T, char16_t> or CT::Exact<T, char32_t>)
+      NOD() static Text Narrow(const T*, Count);
+      NOD() static Text Narrow(const TMany<char16_t>&);
+      NOD() static Text Narrow(const TMany<char32_t>&);
+
    protected:
       template<::std::size_t...N>
       static constexpr auto CheckPattern(const Token&, ::std::index_sequence<N...>);
@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Text.hpp"
+#include "TextKernels.hpp"
 #include "../many/TMany.inl"
 #include <charconv>
 #include <limits>
@@ -369,47 +370,97 @@ namespace Langulus::Anyness
       return Base::BlockAssign<Text>(Forward<T>(rhs));
    }
 
-   #if LANGULUS_FEATURE(UNICODE)
-      /// Widen the text container to the utf16                               
-      ///   @return the widened text container                                
-      TMany<char16_t> Text::Widen16() const {
-         if (IsEmpty())
-            return {};
-
-         TMany<char16_t> to;
-         to.AllocateFresh(to.RequestSize(mCount));
-         Count newCount = 0;
-         try {
-            newCount = utf8::utf8to16(begin(), end(), to.begin()) - to.begin();
-         }
-         catch (utf8::exception&) {
-            LANGULUS_THROW(Convert, "utf8 -> utf16 conversion error");
-         }
+   /// Check if text is valid UTF-8                                           
+   ///   @return true if all sequences are valid                              
+   LANGULUS(INLINED)
+   bool Text::IsValidUTF8() const noexcept {
+      const auto raw = reinterpret_cast<const char*>(GetRaw());
+      return Inner::ValidateUTF8(raw, mCount) == mCount;
+   }
 
-         to.Trim(newCount);
-         return to;
-      }
+   /// Widen the text container to UTF-16                                     
+   ///   @return the widened text container                                   
+   ///   @throw Except::Convert if text isn't valid UTF-8                     
+   inline TMany<char16_t> Text::Widen16() const {
+      if (IsEmpty())
+         return {};
 
-      /// Widen the text container to the utf32                               
-      ///   @return the widened text container                                
-      TMany<char32_t> Text::Widen32() const {
-         if (IsEmpty())
-            return {};
-
-         TMany<char32_t> to;
-         to.AllocateFresh(to.RequestSize(mCount));
-         Count newCount = 0;
-         try {
-            newCount = utf8::utf8to32(begin(), end(), to.begin()) - to.begin();
-         }
-         catch (utf8::exception&) {
-            LANGULUS_THROW(Convert, "utf8 -> utf16 conversion error");
-         }
+      // A UTF-16 code unit is never produced from less than a byte     
+      TMany<char16_t> to;
+      Count written;
+      const auto raw = reinterpret_cast<const char*>(GetRaw());
+      const auto valid = Inner::WidenUTF8(
+         to.Extend(mCount).GetRaw(), raw, mCount, written);
+      LANGULUS_ASSERT(valid == mCount, Convert, "utf8 -> utf16 conversion error");
+
+      to.Trim(written);
+      return to;
+   }
+
+   /// Widen the text container to UTF-32                                     
+   ///   @return the widened text container                                   
+   ///   @throw Except::Convert if text isn't valid UTF-8                     
+   inline TMany<char32_t> Text::Widen32() const {
+      if (IsEmpty())
+         return {};
+
+      TMany<char32_t> to;
+      Count written;
+      const auto raw = reinterpret_cast<const char*>(GetRaw());
+      const auto valid = Inner::WidenUTF8(
+         to.Extend(mCount).GetRaw(), raw, mCount, written);
+      LANGULUS_ASSERT(valid == mCount, Convert, "utf8 -> utf32 conversion error");
+
+      to.Trim(written);
+      return to;
+   }
+
+   /// Narrow UTF-16 or UTF-32 text to UTF-8                                  
+   ///   @param from - the UTF-16 or UTF-32 text                              
+   ///   @param count - number of elements                                    
+   ///   @return the narrowed text container                                  
+   ///   @throw Except::Convert if text isn't valid UTF-16 or UTF-32          
+   template<class T> requires (CT::Exact<T, char16_t> or CT::Exact<T, char32_t>)
+   Text Text::Narrow(const T* from, const Count count) {
+      if (not count)
+         return {};
 
-         to.Trim(newCount);
-         return to;
+      // A UTF-16 code unit never produces more than three bytes, and   
+      // a UTF-32 code unit never produces more than four               
+      Text to;
+      Count written;
+      const auto valid = Inner::NarrowToUTF8(reinterpret_cast<char*>(
+         to.Extend(count * (sizeof(T) == 2 ? 3 : 4)).GetRaw()), from, count, written);
+      if constexpr (sizeof(T) == 2) {
+         LANGULUS_ASSERT(valid == count, Convert,
+            "utf16 -> utf8 conversion error");
       }
-   #endif
+      else {
+         LANGULUS_ASSERT(valid == count, Convert,
+            "utf32 -> utf8 conversion error");
+      }
+
+      to.Trim(written);
+      return to;
+   }
+
+   /// Narrow a UTF-16 text container to UTF-8                                
+   ///   @param from - the UTF-16 text                                        
+   ///   @return the narrowed text container                                  
+   ///   @throw Except::Convert if text isn't valid UTF-16                    
+   LANGULUS(INLINED)
+   Text Text::Narrow(const TMany<char16_t>& from) {
+      return Narrow(from.GetRaw(), from.GetCount());
+   }
+
+   /// Narrow a UTF-32 text container to UTF-8                                
+   ///   @param from - the UTF-32 text                                        
+   ///   @return the narrowed text container                                  
+   ///   @throw Except::Convert if text isn't valid UTF-32                    
+   LANGULUS(INLINED)
+   Text Text::Narrow(const TMany<char32_t>& from) {
+      return Narrow(from.GetRaw(), from.GetCount());
+   }
       
    /// Count the number of newline characters                                 
    ///   @return the number of newline characters + 1, or zero if empty       
@@ -418,13 +469,8 @@ namespace Langulus::Anyness
       if (IsEmpty())
          return 0;
 
-      Count lines = 1;
-      for (Count i = 0; i < mCount; ++i) {
-         if ((*this)[i] == '\n')
-            ++lines;
-      }
-
-      return lines;
+      return 1 + Inner::CountByte(
+         reinterpret_cast<const char*>(GetRaw()), mCount, '\n');
    }
 
    /// Terminate text so that it ends with a zero character at the end        
@@ -456,8 +502,23 @@ namespace Langulus::Anyness
             return *this;
          }
 
-         Base previousBlock {*this};
          const auto request = RequestSize(mCount + 1);
+         #if not LANGULUS_FEATURE(MANAGED_MEMORY)
+            if (mRaw == mEntry->GetBlockStart()) {
+               // Letters are carried over by the system allocator, in  
+               // place if the chunk can be extended                    
+               const auto entry = Allocator::Relocate(
+                  request.mByteSize, const_cast<Allocation*>(mEntry));
+               LANGULUS_ASSERT(entry, Allocate, "Out of memory");
+               mutableThis->mEntry = entry;
+               mutableThis->mRaw = const_cast<Byte*>(mEntry->GetBlockStart());
+               mutableThis->mReserved = request.mElementCount;
+               mutableThis->GetRaw()[mCount] = '\0';
+               return *this;
+            }
+         #endif
+
+         Base previousBlock {*this};
          mutableThis->mEntry = Allocator::Reallocate(
             request.mByteSize, const_cast<Allocation*>(mEntry));
          LANGULUS_ASSERT(mEntry, Allocate, "Out of memory");
@@ -491,9 +552,13 @@ namespace Langulus::Anyness
    ///   @return a new text container with all letter made lowercase          
    LANGULUS(INLINED)
    Text Text::Lowercase() const {
-      Text result = Clone(*this);
-      for (auto& i : result)
-         i = static_cast<Letter>(::std::tolower(i));
+      Text result;
+      if (IsEmpty())
+         return result;
+
+      Inner::ChangeCase<false>(
+         reinterpret_cast<char*>(result.Extend(mCount).GetRaw()),
+         reinterpret_cast<const char*>(GetRaw()), mCount);
       return result;
    }
 
@@ -501,9 +566,13 @@ namespace Langulus::Anyness
    ///   @return a new text container with all letter made uppercase          
    LANGULUS(INLINED)
    Text Text::Uppercase() const {
-      Text result = Clone(*this);
-      for (auto& i : result)
-         i = static_cast<Letter>(::std::toupper(i));
+      Text result;
+      if (IsEmpty())
+         return result;
+
+      Inner::ChangeCase<true>(
+         reinterpret_cast<char*>(result.Extend(mCount).GetRaw()),
+         reinterpret_cast<const char*>(GetRaw()), mCount);
       return result;
    }
 
@@ -539,109 +608,137 @@ namespace Langulus::Anyness
    /// Remove all instances of 'what' from the text container                 
    ///   @param what - the character/string to remove                         
    ///   @return a new container with the text stripped                       
-   Text Text::Strip(const CT::Text auto& what) const {
-      const Text pattern = Disowned(what);
-      if (IsEmpty() or pattern.IsEmpty())
-         return *this;
-
-      Text result;
-      result.Reserve(mCount);
-
-      Count copyStart = 0, copyEnd = 0;
-      for (Count i = 0; i <= mCount - pattern.mCount; ++i) {
-         const auto matches = CropInner(i, mCount - i).Matches(pattern);
-         if (matches == pattern.mCount) {
-            // Found a match, skip it                                   
-            // Copy any text that was skipped                           
-            const auto copy = copyEnd - copyStart;
-            if (copy) {
-               CopyMemory(
-                  result.GetRaw() + result.mCount,
-                  GetRaw() + copyStart,
-                  copy
-               );
-               result.mCount += copy;
-            }
-
-            copyStart = copyEnd = i + matches;
-            i += matches - 1;
-         }
-         else ++copyEnd;
-      }
-
-      // Account for any leftover                                       
-      const auto copy = copyEnd - copyStart;
-      if (copy) {
-         CopyMemory(
-            result.GetRaw() + result.mCount,
-            GetRaw() + copyStart,
-            copy
-         );
-         result.mCount += copy;
-      }
+   LANGULUS(INLINED)
+   Text Text::Strip(const CT::Text auto& what) const& {
+      return ReplaceCopy(Disowned(what), {});
+   }
 
-      return result;
+   /// Remove all instances of 'what' from a temporary text container         
+   /// Letters are removed in place, if the memory isn't shared               
+   ///   @param what - the character/string to remove                         
+   ///   @return the stripped container                                       
+   LANGULUS(INLINED)
+   Text Text::Strip(const CT::Text auto& what) && {
+      const Text pattern = Disowned(what);
+      if (ReplaceInPlace(pattern, {}))
+         return ::std::move(*this);
+      return ReplaceCopy(pattern, {});
    }
    
    /// Replace every occurence of 'what' with the provided string             
    ///   @param what - characters/strings to search for                       
    ///   @param with - characters/strings to replace with                     
    ///   @return a new container with the text replaced                       
-   Text Text::Replace(const CT::Text auto& what, const CT::Text auto& with) const {
+   LANGULUS(INLINED)
+   Text Text::Replace(const CT::Text auto& what, const CT::Text auto& with) const& {
+      return ReplaceCopy(Disowned(what), Disowned(with));
+   }
+
+   /// Replace every occurence of 'what' in a temporary text container        
+   /// Letters are replaced in place, if the memory isn't shared, and the     
+   /// replacement isn't longer than what it replaces                         
+   ///   @param what - characters/strings to search for                       
+   ///   @param with - characters/strings to replace with                     
+   ///   @return the container with the text replaced                         
+   LANGULUS(INLINED)
+   Text Text::Replace(const CT::Text auto& what, const CT::Text auto& with) && {
       const Text pattern = Disowned(what);
       const Text replacement = Disowned(with);
+      if (ReplaceInPlace(pattern, replacement))
+         return ::std::move(*this);
+      return ReplaceCopy(pattern, replacement);
+   }
+
+   /// Replace every occurence of a pattern, writing the result in a new      
+   /// container, that is allocated only once                                 
+   ///   @param pattern - the text to search for                              
+   ///   @param replacement - the text to replace it with, can be empty       
+   ///   @return the new text, or this text, if pattern wasn't found          
+   inline Text Text::ReplaceCopy(const Text& pattern, const Text& replacement) const {
       if (IsEmpty() or pattern.IsEmpty())
          return *this;
 
+      const auto raw = reinterpret_cast<const char*>(GetRaw());
+      const auto needle = reinterpret_cast<const char*>(pattern.GetRaw());
+      const auto next = [&](Offset from) noexcept {
+         return from + Inner::FindSubstring(
+            raw + from, mCount - from, needle, pattern.mCount);
+      };
+
+      const auto first = next(0);
+      if (first == mCount)
+         return *this;
+
+      // Count the matches, so that the exact size is known             
+      Count matches = 0;
+      for (auto at = first; at < mCount; at = next(at + pattern.mCount))
+         ++matches;
+
       Text result;
-      result.Reserve(mCount); // Not exact, but a good heuristic        
-
-      Count copyStart = 0, copyEnd = 0;
-      for (Count i = 0; i <= mCount - pattern.mCount; ++i) {
-         const auto matches = CropInner(i, mCount - i).Matches(pattern);
-
-         if (matches == pattern.mCount) {
-            // Found a match, replace it                                
-            const auto copy = copyEnd - copyStart;
-            auto segment = result.Extend(copy + replacement.mCount);
-
-            if (copy) {
-               CopyMemory(
-                  segment.GetRaw(),
-                  GetRaw() + copyStart,
-                  copy
-               );
-               CopyMemory(
-                  segment.GetRaw() + copy,
-                  replacement.GetRaw(),
-                  replacement.mCount
-               );
-            }
-            else CopyMemory(
-               segment.GetRaw(),
-               replacement.GetRaw(),
-               replacement.mCount
-            );
-
-            copyStart = copyEnd = i + matches;
-            i += matches - 1;
-         }
-         else ++copyEnd;
+      const auto size = mCount
+         - matches * pattern.mCount
+         + matches * replacement.mCount;
+      if (not size)
+         return result;
+
+      auto to = result.Extend(size).GetRaw();
+      Offset from = 0;
+      for (auto at = first; at < mCount; at = next(from)) {
+         CopyMemory(to, GetRaw() + from, at - from);
+         to += at - from;
+         CopyMemory(to, replacement.GetRaw(), replacement.mCount);
+         to += replacement.mCount;
+         from = at + pattern.mCount;
       }
 
-      // Account for any leftover                                       
-      const auto copy = copyEnd - copyStart;
-      if (copy) {
-         CopyMemory(
-            result.GetRaw() + result.mCount,
-            GetRaw() + copyStart,
-            copy
-         );
-         result.mCount += copy;
-      }
+      CopyMemory(to, GetRaw() + from, mCount - from);
       return result;
    }
 
+   /// Replace every occurence of a pattern, directly in this container       
+   /// Possible only if memory isn't shared, the replacement isn't longer     
+   /// than the pattern, and neither of them is inside this container         
+   ///   @param pattern - the text to search for                              
+   ///   @param replacement - the text to replace it with, can be empty       
+   ///   @return true if replaced in place, false if a copy is required       
+   inline bool Text::ReplaceInPlace(const Text& pattern, const Text& replacement) {
+      if (IsEmpty() or pattern.IsEmpty())
+         return true;
+
+      const auto inside = [&](const Text& text) noexcept {
+         return text.GetRaw() < GetRaw() + mCount
+            and GetRaw() < text.GetRaw() + text.mCount;
+      };
+
+      if (GetUses() != 1 or IsConstant()
+      or replacement.mCount > pattern.mCount
+      or inside(pattern) or inside(replacement))
+         return false;
+
+      const auto raw = GetRaw();
+      const auto needle = reinterpret_cast<const char*>(pattern.GetRaw());
+      const auto next = [&](Offset from) noexcept {
+         return from + Inner::FindSubstring(
+            reinterpret_cast<const char*>(raw) + from,
+            mCount - from, needle, pattern.mCount);
+      };
+
+      // Letters only move towards the front, so everything after the   
+      // current match is still intact, when searching for the next one 
+      Offset to = next(0), from = to;
+      for (auto at = to; at < mCount; at = next(from)) {
+         MoveMemory(raw + to, raw + from, at - from);
+         to += at - from;
+         CopyMemory(raw + to, replacement.GetRaw(), replacement.mCount);
+         to += replacement.mCount;
+         from = at + pattern.mCount;
+      }
+
+      MoveMemory(raw + to, raw + from, mCount - from);
+      mCount = to + (mCount - from);
+      return true;
+   }
+
    /// Extend the text container and return a referenced part of it           
    ///   @return a container that represents the extended part                
    LANGULUS(INLINED)
@@ -958,7 +1055,7 @@ namespace Langulus::Anyness
    ///   @param from - the data to serialize                                  
    ///   @param to - the serialized data                                      
    ///   @return the number of written characters                             
-   bool Text::SerializationRules::BeginScope(const CT::Block auto& from, Text& to) {
+   bool Text::SerializationRules::BeginScope(const CT::Block auto& from, auto& to) {
       const bool scoped = from.GetCount() > 1 or from.IsInvalid() or from.IsExecutable(); //TODO could check verb precedence to avoid scoping in some cases
       if (scoped) {
          if (from.IsPast())
@@ -976,7 +1073,7 @@ namespace Langulus::Anyness
    ///   @param from - the data to serialize                                  
    ///   @param to - the serialized data                                      
    ///   @return the number of written characters                             
-   bool Text::SerializationRules::EndScope(const CT::Block auto& from, Text& to) {
+   bool Text::SerializationRules::EndScope(const CT::Block auto& from, auto& to) {
       const bool scoped = from.GetCount() > 1 or from.IsInvalid() or from.IsExecutable(); //TODO could check verb precedence to avoid scoping in some cases
       if (scoped)
          to += Operator::CloseScope;
@@ -988,7 +1085,7 @@ namespace Langulus::Anyness
    ///   @param from - the data to serialize                                  
    ///   @param to - the serialized data                                      
    ///   @return the number of written characters                             
-   bool Text::SerializationRules::Separate(const CT::Block auto& from, Text& to) {
+   bool Text::SerializationRules::Separate(const CT::Block auto& from, auto& to) {
       const auto initial = to.GetCount();
       to += (from.IsOr() ? " or " : ", ");
       return to.GetCount() - initial;
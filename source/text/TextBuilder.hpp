@@ -0,0 +1,96 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Text.hpp"
+#include "../many/TMany.hpp"
+
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Chunked text builder                                                 
+   ///                                                                        
+   ///   Accumulates text in a chain of chunks, instead of a single           
+   /// contiguous container, so that large outputs, like serialized scenes,   
+   /// never relocate what's already written. Chunks start small and double   
+   /// in size up to ChunkSize, so short outputs don't waste memory. Long     
+   /// texts are appended by reference, when they own their memory, so no     
+   /// letters are copied at all. The builder is not a Text, but it follows   
+   /// Text's serialization rules, so it can be used as a serializer target.  
+   /// Join() concatenates all chunks into a single Text, and ForEachChunk()  
+   /// streams them to any sink, without joining.                             
+   ///                                                                        
+   struct TextBuilder {
+      LANGULUS(NAME) "TextBuilder";
+
+      /// Elements are serialized to Text, before being appended              
+      using Flat = Text;
+      using SerializationRules = Text::SerializationRules;
+      using Operator = Text::Operator;
+
+      /// Size of the first chunk in letters                                  
+      static constexpr Count FirstChunkSize = 256;
+
+      /// Largest size of a chunk in letters, and the minimal size of a text, 
+      /// that is appended by reference, instead of being copied              
+      static constexpr Count ChunkSize = 64 * 1024;
+
+   protected:
+      // All chunks, except the last one                                
+      TMany<Text> mChunks;
+      // The last chunk, where letters are appended                     
+      Text mLast;
+      // Number of letters in mChunks                                   
+      Count mFlushed = 0;
+
+   public:
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      TextBuilder() = default;
+      TextBuilder(const TextBuilder&) = default;
+      TextBuilder(TextBuilder&&) noexcept;
+      explicit TextBuilder(const Text&);
+      explicit TextBuilder(Text&&);
+
+      TextBuilder& operator = (const TextBuilder&) = default;
+      TextBuilder& operator = (TextBuilder&&) noexcept;
+
+      ///                                                                     
+      ///   Capsulation                                                       
+      ///                                                                     
+      NOD() Count GetCount() const noexcept;
+      NOD() Count GetChunkCount() const noexcept;
+      NOD() bool IsEmpty() const noexcept;
+
+      ///                                                                     
+      ///   Concatenation                                                     
+      ///                                                                     
+      template<class T>
+      requires (CT::Stringifiable<Deint<T>> or CT::Similar<Deint<T>, TextBuilder>)
+      TextBuilder& operator += (T&&);
+
+      ///                                                                     
+      ///   Joining                                                           
+      ///                                                                     
+      NOD() Text Join() const;
+      void ForEachChunk(auto&&) const;
+
+      ///                                                                     
+      ///   Removal                                                           
+      ///                                                                     
+      void Clear();
+      void Reset();
+
+   protected:
+      void Append(const Text&);
+      void Flush();
+   };
+
+} // namespace Langulus::Anyness
\ No newline at end of file
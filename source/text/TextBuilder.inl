@@ -0,0 +1,177 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TextBuilder.hpp"
+#include "Text.inl"
+
+
+namespace Langulus::Anyness
+{
+
+   /// Move constructor                                                       
+   ///   @param other - the builder to move                                   
+   LANGULUS(INLINED)
+   TextBuilder::TextBuilder(TextBuilder&& other) noexcept
+      : mChunks {::std::move(other.mChunks)}
+      , mLast {::std::move(other.mLast)}
+      , mFlushed {other.mFlushed} {
+      other.mFlushed = 0;
+   }
+
+   /// Start building from a copy of a text                                   
+   ///   @param other - the text to start with                                
+   LANGULUS(INLINED)
+   TextBuilder::TextBuilder(const Text& other)
+      : mLast {other} {}
+
+   /// Start building from a text                                             
+   ///   @param other - the text to start with                                
+   LANGULUS(INLINED)
+   TextBuilder::TextBuilder(Text&& other)
+      : mLast {::std::move(other)} {}
+
+   /// Move assignment                                                        
+   ///   @param rhs - the builder to move                                     
+   ///   @return a reference to this builder                                  
+   LANGULUS(INLINED)
+   TextBuilder& TextBuilder::operator = (TextBuilder&& rhs) noexcept {
+      mChunks = ::std::move(rhs.mChunks);
+      mLast = ::std::move(rhs.mLast);
+      mFlushed = rhs.mFlushed;
+      rhs.mFlushed = 0;
+      return *this;
+   }
+
+   /// Get the number of letters in all chunks                                
+   ///   @return the number of letters                                        
+   LANGULUS(INLINED)
+   Count TextBuilder::GetCount() const noexcept {
+      return mFlushed + mLast.GetCount();
+   }
+
+   /// Get the number of chunks, including the last one                       
+   ///   @return the number of chunks                                         
+   LANGULUS(INLINED)
+   Count TextBuilder::GetChunkCount() const noexcept {
+      return mChunks.GetCount() + (mLast.IsEmpty() ? 0 : 1);
+   }
+
+   /// Check if anything was appended                                         
+   ///   @return true if there are no letters in any chunk                    
+   LANGULUS(INLINED)
+   bool TextBuilder::IsEmpty() const noexcept {
+      return not GetCount();
+   }
+
+   /// Append anything that can be converted to text                          
+   /// Builders are appended chunk by chunk, by reference                     
+   ///   @param rhs - what to append                                          
+   ///   @return a reference to this builder for chaining                     
+   template<class T>
+   requires (CT::Stringifiable<Deint<T>> or CT::Similar<Deint<T>, TextBuilder>)
+   LANGULUS(INLINED)
+   TextBuilder& TextBuilder::operator += (T&& rhs) {
+      if constexpr (CT::Similar<Deint<T>, TextBuilder>) {
+         const TextBuilder& other = DeintCast(rhs);
+         if (&other == this)
+            return *this += TextBuilder {other};
+
+         other.ForEachChunk([this](const Text& chunk) {
+            Append(chunk);
+         });
+      }
+      else if constexpr (CT::TextBased<Deint<T>>)
+         Append(static_cast<const Text&>(DeintCast(rhs)));
+      else
+         Append(Text {Forward<T>(rhs)});
+      return *this;
+   }
+
+   /// Append a text to the last chunk, or reference it as a separate chunk   
+   ///   @param text - the text to append                                     
+   inline void TextBuilder::Append(const Text& text) {
+      const auto count = text.GetCount();
+      if (not count)
+         return;
+
+      if (count >= ChunkSize and text.GetAllocation()) {
+         // Long texts, that own their memory, are referenced           
+         Flush();
+         mChunks << text;
+         mFlushed += count;
+         return;
+      }
+
+      if (mLast.GetCount() + count > mLast.GetReserved()) {
+         // Instead of relocating the last chunk, start a new one,      
+         // twice as big as the previous one, up to the chunk size      
+         const auto next = ::std::clamp(
+            mLast.GetReserved() * 2, FirstChunkSize, ChunkSize);
+         Flush();
+         mLast.Reserve(::std::max(count, next));
+      }
+
+      mLast += text;
+   }
+
+   /// Push the last chunk to the chain of chunks, if not empty               
+   LANGULUS(INLINED)
+   void TextBuilder::Flush() {
+      if (mLast.IsEmpty())
+         return;
+
+      mFlushed += mLast.GetCount();
+      mChunks << ::std::move(mLast);
+   }
+
+   /// Join all chunks in a single contiguous text                            
+   /// Nothing is copied, if there is only a single chunk                     
+   ///   @return the joined text                                              
+   LANGULUS(INLINED)
+   Text TextBuilder::Join() const {
+      if (mChunks.IsEmpty())
+         return mLast;
+      if (mChunks.GetCount() == 1 and mLast.IsEmpty())
+         return mChunks[0];
+
+      Text result;
+      auto to = result.Extend(GetCount()).GetRaw();
+      ForEachChunk([&to](const Text& chunk) {
+         CopyMemory(to, chunk.GetRaw(), chunk.GetCount());
+         to += chunk.GetCount();
+      });
+      return result;
+   }
+
+   /// Pass all non-empty chunks in order to a sink, without joining them     
+   ///   @param sink - a function that accepts a const Text&                  
+   LANGULUS(INLINED)
+   void TextBuilder::ForEachChunk(auto&& sink) const {
+      for (auto& chunk : mChunks)
+         sink(chunk);
+      if (not mLast.IsEmpty())
+         sink(mLast);
+   }
+
+   /// Destroy all chunks, but keep the memory of the last one                
+   LANGULUS(INLINED)
+   void TextBuilder::Clear() {
+      mChunks.Reset();
+      mFlushed = 0;
+      mLast.Clear();
+   }
+
+   /// Destroy all chunks and release memory                                  
+   LANGULUS(INLINED)
+   void TextBuilder::Reset() {
+      mChunks.Reset();
+      mFlushed = 0;
+      mLast.Reset();
+   }
+
+} // namespace Langulus::Anyness
\ No newline at end of file
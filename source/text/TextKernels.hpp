@@ -0,0 +1,427 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Vectorize.hpp"
+
+
+namespace Langulus::Anyness::Inner
+{
+
+   /// Change the case of ASCII letters, leaving all other bytes intact       
+   /// Equivalent to std::tolower/std::toupper in the default "C" locale      
+   ///   @tparam UPPER - true to make letters uppercase, false for lowercase  
+   ///   @param to - [out] where to write the result, can be the same as from 
+   ///   @param from - the letters to convert                                 
+   ///   @param count - number of letters                                     
+   template<bool UPPER>
+   void ChangeCase(char* to, const char* from, const Count count) noexcept {
+      constexpr char first = UPPER ? 'a' : 'A';
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         // Shift the letters to change to the bottom of the signed     
+         // range, so that a single signed comparison finds them        
+         const auto shift = _mm_set1_epi8(static_cast<char>(-128 - first));
+         const auto limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+         const auto flip = _mm_set1_epi8(0x20);
+
+         for (; i + 16 <= count; i += 16) {
+            const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+            const auto letters = _mm_cmplt_epi8(_mm_add_epi8(x, shift), limit);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i),
+               _mm_xor_si128(x, _mm_and_si128(letters, flip)));
+         }
+      #endif
+
+      for (; i < count; ++i) {
+         const auto c = from[i];
+         to[i] = (c >= first and c < first + 26) ? static_cast<char>(c ^ 0x20) : c;
+      }
+   }
+
+   /// Count the occurences of a byte                                         
+   ///   @param data - the bytes to search in                                 
+   ///   @param count - number of bytes                                       
+   ///   @param what - the byte to count                                      
+   ///   @return the number of matching bytes                                 
+   inline Count CountByte(const char* data, const Count count, const char what) noexcept {
+      Count result = 0;
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         const auto pattern = _mm_set1_epi8(what);
+         for (; i + 16 <= count; i += 16) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            result += ::std::popcount(static_cast<unsigned>(
+               _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, pattern))));
+         }
+      #endif
+
+      for (; i < count; ++i)
+         result += data[i] == what;
+      return result;
+   }
+
+   /// Find the first occurence of a substring                                
+   /// Candidates are filtered by comparing both the first and the last byte  
+   /// of the needle with 16 positions at once, and only the surviving ones   
+   /// are compared in full - this skips most of the haystack in practice     
+   ///   @param haystack - the text to search in                              
+   ///   @param count - number of letters in the haystack                     
+   ///   @param needle - the text to search for, must not be empty            
+   ///   @param size - number of letters in the needle                        
+   ///   @return the offset of the match, or count if not found               
+   inline Offset FindSubstring(
+      const char* haystack, const Count count, const char* needle, const Count size
+   ) noexcept {
+      if (size > count)
+         return count;
+      if (size == 1) {
+         return FindBitwise<1>(reinterpret_cast<const Byte*>(haystack),
+            count, reinterpret_cast<const Byte*>(needle));
+      }
+
+      const auto last = count - size;
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         const auto head = _mm_set1_epi8(needle[0]);
+         const auto tail = _mm_set1_epi8(needle[size - 1]);
+
+         for (; i + 16 <= last + 1; i += 16) {
+            const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+            const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + size - 1));
+            auto mask = static_cast<unsigned>(_mm_movemask_epi8(
+               _mm_and_si128(_mm_cmpeq_epi8(a, head), _mm_cmpeq_epi8(b, tail))));
+
+            while (mask) {
+               const auto at = i + ::std::countr_zero(mask);
+               if (0 == ::std::memcmp(haystack + at + 1, needle + 1, size - 2))
+                  return at;
+               mask &= mask - 1;
+            }
+         }
+      #endif
+
+      for (; i <= last; ++i) {
+         if (haystack[i] == needle[0] and haystack[i + size - 1] == needle[size - 1]
+         and 0 == ::std::memcmp(haystack + i + 1, needle + 1, size - 2))
+            return i;
+      }
+
+      return count;
+   }
+
+   /// Decode a single UTF-8 sequence                                         
+   /// Strict - rejects overlong forms, surrogates, codepoints above U+10FFFF 
+   /// and truncated sequences, as required by the Unicode standard           
+   ///   @param from - the sequence to decode                                 
+   ///   @param count - number of bytes available in the sequence             
+   ///   @param codepoint - [out] the decoded codepoint                       
+   ///   @return the size of the sequence in bytes, or zero if invalid        
+   inline Count DecodeUTF8(const char* from, const Count count, char32_t& codepoint) noexcept {
+      const auto lead = static_cast<Byte>(from[0]);
+      if (lead < 0x80) {
+         codepoint = lead;
+         return 1;
+      }
+
+      // The second byte has a narrower range for some lead bytes       
+      Byte low = 0x80, high = 0xBF;
+      Count size;
+      char32_t result;
+
+      if (lead < 0xC2)
+         return 0;
+      else if (lead < 0xE0) {
+         size = 2;
+         result = lead & 0x1F;
+      }
+      else if (lead < 0xF0) {
+         size = 3;
+         result = lead & 0x0F;
+         if (lead == 0xE0)       low = 0xA0;
+         else if (lead == 0xED)  high = 0x9F;
+      }
+      else if (lead < 0xF5) {
+         size = 4;
+         result = lead & 0x07;
+         if (lead == 0xF0)       low = 0x90;
+         else if (lead == 0xF4)  high = 0x8F;
+      }
+      else return 0;
+
+      if (size > count)
+         return 0;
+
+      for (Offset i = 1; i < size; ++i) {
+         const auto next = static_cast<Byte>(from[i]);
+         if (next < low or next > high)
+            return 0;
+
+         result = (result << 6) | (next & 0x3F);
+         low = 0x80;
+         high = 0xBF;
+      }
+
+      codepoint = result;
+      return size;
+   }
+
+   /// Get the number of bytes, up to which all bytes are ASCII               
+   /// Checks 16 bytes at once, so that plain text is skipped quickly         
+   ///   @param from - the bytes to check                                     
+   ///   @param count - number of bytes                                       
+   ///   @return the offset of the first 16-byte chunk with non-ASCII bytes   
+   inline Offset SkipASCII(const char* from, const Count count) noexcept {
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         for (; i + 16 <= count; i += 16) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+            if (_mm_movemask_epi8(chunk))
+               break;
+         }
+      #endif
+
+      return i;
+   }
+
+   /// Validate UTF-8 text                                                    
+   ///   @param from - the text to validate                                   
+   ///   @param count - number of bytes                                       
+   ///   @return the offset of the first invalid sequence, or count if valid  
+   inline Offset ValidateUTF8(const char* from, const Count count) noexcept {
+      Offset i = 0;
+      char32_t unused;
+
+      while (i < count) {
+         i += SkipASCII(from + i, count - i);
+
+         // Decode at least one chunk's worth, before trying to skip    
+         // ASCII again - mixed text would otherwise be checked twice   
+         const auto stop = i + 16 < count ? i + 16 : count;
+         while (i < stop) {
+            const auto size = DecodeUTF8(from + i, count - i, unused);
+            if (not size)
+               return i;
+            i += size;
+         }
+      }
+
+      return count;
+   }
+
+   /// Count the codepoints in valid UTF-8 text                               
+   /// Counts all bytes, that aren't continuation bytes (0x80-0xBF), which    
+   /// are exactly the ones below -64, when interpreted as signed             
+   ///   @param from - the text, must be valid UTF-8                          
+   ///   @param count - number of bytes                                       
+   ///   @return the number of codepoints                                     
+   inline Count CountCodepoints(const char* from, const Count count) noexcept {
+      Count result = 0;
+      Offset i = 0;
+
+      #if LANGULUS_ANYNESS_SSE2()
+         const auto limit = _mm_set1_epi8(-65);
+         for (; i + 16 <= count; i += 16) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+            result += ::std::popcount(static_cast<unsigned>(
+               _mm_movemask_epi8(_mm_cmpgt_epi8(chunk, limit))));
+         }
+      #endif
+
+      for (; i < count; ++i)
+         result += static_cast<signed char>(from[i]) > -65;
+      return result;
+   }
+
+   /// Get the byte offset of a codepoint in valid UTF-8 text                 
+   ///   @param from - the text, must be valid UTF-8                          
+   ///   @param count - number of bytes                                       
+   ///   @param codepoints - number of codepoints to skip                     
+   ///   @return the byte offset, or count if there are less codepoints       
+   inline Offset SkipCodepoints(const char* from, const Count count, Count codepoints) noexcept {
+      Offset i = 0;
+      for (; i < count; ++i) {
+         if (static_cast<signed char>(from[i]) > -65 and not codepoints--)
+            return i;
+      }
+      return count;
+   }
+
+   /// Transcode UTF-8 to UTF-16 or UTF-32, validating it in the process      
+   /// ASCII chunks are widened 16 bytes at a time                            
+   ///   @tparam T - char16_t or char32_t                                     
+   ///   @param to - [out] where to write, must have room for count elements  
+   ///   @param from - the UTF-8 text                                         
+   ///   @param count - number of bytes                                       
+   ///   @param written - [out] number of elements written                    
+   ///   @return the offset of the first invalid sequence, or count if valid  
+   template<class T> requires (CT::Exact<T, char16_t> or CT::Exact<T, char32_t>)
+   Offset WidenUTF8(T* to, const char* from, const Count count, Count& written) noexcept {
+      Offset i = 0;
+      written = 0;
+
+      while (i < count) {
+         #if LANGULUS_ANYNESS_SSE2()
+            const auto ascii = SkipASCII(from + i, count - i);
+            const auto zero = _mm_setzero_si128();
+            for (const auto end = i + ascii; i < end; i += 16, written += 16) {
+               const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+               const auto lo = _mm_unpacklo_epi8(chunk, zero);
+               const auto hi = _mm_unpackhi_epi8(chunk, zero);
+               const auto out = reinterpret_cast<__m128i*>(to + written);
+
+               if constexpr (sizeof(T) == 2) {
+                  _mm_storeu_si128(out + 0, lo);
+                  _mm_storeu_si128(out + 1, hi);
+               }
+               else {
+                  _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(lo, zero));
+                  _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+                  _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+                  _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+               }
+            }
+         #endif
+
+         const auto stop = i + 16 < count ? i + 16 : count;
+         while (i < stop) {
+            char32_t codepoint;
+            const auto size = DecodeUTF8(from + i, count - i, codepoint);
+            if (not size)
+               return i;
+            i += size;
+
+            if constexpr (sizeof(T) == 2) {
+               if (codepoint >= 0x10000) {
+                  // Encode as a surrogate pair                         
+                  codepoint -= 0x10000;
+                  to[written++] = static_cast<T>(0xD800 + (codepoint >> 10));
+                  to[written++] = static_cast<T>(0xDC00 + (codepoint & 0x3FF));
+                  continue;
+               }
+            }
+
+            to[written++] = static_cast<T>(codepoint);
+         }
+      }
+
+      return count;
+   }
+
+   /// Encode a single codepoint as UTF-8                                     
+   ///   @attention assumes the codepoint is a valid scalar value             
+   ///   @param to - [out] where to write, must have room for four bytes      
+   ///   @param codepoint - the codepoint to encode                           
+   ///   @return the size of the sequence in bytes                            
+   inline Count EncodeUTF8(char* to, const char32_t codepoint) noexcept {
+      if (codepoint < 0x80) {
+         to[0] = static_cast<char>(codepoint);
+         return 1;
+      }
+      else if (codepoint < 0x800) {
+         to[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+         to[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+         return 2;
+      }
+      else if (codepoint < 0x10000) {
+         to[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+         to[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+         to[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+         return 3;
+      }
+
+      to[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+      to[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+      to[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+      to[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+      return 4;
+   }
+
+   /// Transcode UTF-16 or UTF-32 to UTF-8, validating it in the process      
+   /// Rejects unpaired surrogates, and codepoints above U+10FFFF. ASCII      
+   /// chunks are narrowed 16 elements at a time                              
+   ///   @tparam T - char16_t or char32_t                                     
+   ///   @param to - [out] where to write, must have room for three bytes     
+   ///      per element if T is char16_t, or four bytes if T is char32_t      
+   ///   @param from - the UTF-16 or UTF-32 text                              
+   ///   @param count - number of elements                                    
+   ///   @param written - [out] number of bytes written                       
+   ///   @return the offset of the first invalid element, or count if valid   
+   template<class T> requires (CT::Exact<T, char16_t> or CT::Exact<T, char32_t>)
+   Offset NarrowToUTF8(char* to, const T* from, const Count count, Count& written) noexcept {
+      Offset i = 0;
+      written = 0;
+
+      while (i < count) {
+         #if LANGULUS_ANYNESS_SSE2()
+            // Elements below 0x80 are packed into bytes, as long as    
+            // whole chunks of them are found                           
+            const auto limit = _mm_set1_epi16(0x7F);
+            for (; i + 16 <= count; i += 16, written += 16) {
+               const auto in = reinterpret_cast<const __m128i*>(from + i);
+               __m128i lo, hi;
+               if constexpr (sizeof(T) == 2) {
+                  lo = _mm_loadu_si128(in + 0);
+                  hi = _mm_loadu_si128(in + 1);
+               }
+               else {
+                  // Saturate to 16 bits first - anything too big for   
+                  // that is way above the ASCII limit anyway           
+                  lo = _mm_packs_epi32(_mm_loadu_si128(in + 0), _mm_loadu_si128(in + 1));
+                  hi = _mm_packs_epi32(_mm_loadu_si128(in + 2), _mm_loadu_si128(in + 3));
+               }
+
+               // Signed comparison, so that elements saturated to the  
+               // negative range are caught, too                        
+               const auto above = _mm_or_si128(
+                  _mm_cmpgt_epi16(lo, limit), _mm_cmplt_epi16(lo, _mm_setzero_si128()));
+               const auto aboveHi = _mm_or_si128(
+                  _mm_cmpgt_epi16(hi, limit), _mm_cmplt_epi16(hi, _mm_setzero_si128()));
+               if (_mm_movemask_epi8(_mm_or_si128(above, aboveHi)))
+                  break;
+
+               _mm_storeu_si128(reinterpret_cast<__m128i*>(to + written),
+                  _mm_packus_epi16(lo, hi));
+            }
+         #endif
+
+         // Encode at least one chunk's worth, before trying to narrow  
+         // ASCII again - mixed text would otherwise be checked twice   
+         const auto stop = i + 16 < count ? i + 16 : count;
+         while (i < stop) {
+            char32_t codepoint = static_cast<char32_t>(from[i]);
+            if (codepoint >= 0xD800 and codepoint < 0xE000) {
+               if constexpr (sizeof(T) == 2) {
+                  // Only a high surrogate, followed by a low one, is   
+                  // valid, and the pair encodes a single codepoint     
+                  if (codepoint >= 0xDC00 or i + 1 == count)
+                     return i;
+                  const char32_t low = from[i + 1];
+                  if (low < 0xDC00 or low >= 0xE000)
+                     return i;
+
+                  codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                  ++i;
+               }
+               else return i;
+            }
+            else if (codepoint > 0x10FFFF)
+               return i;
+
+            written += EncodeUTF8(to + written, codepoint);
+            ++i;
+         }
+      }
+
+      return count;
+   }
+
+} // namespace Langulus::Anyness::Inner
\ No newline at end of file
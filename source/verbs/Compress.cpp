@@ -5,149 +5,236 @@
 ///                                                                           
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
-/*#include "../Many.hpp"
+#include "Compress.hpp"
+
+#if LANGULUS_FEATURE(COMPRESSION)
+#include "../many/Bytes.inl"
+#include <algorithm>
 #include <zlib.h>
 
 
 namespace Langulus::Anyness
 {
+   namespace
+   {
+
+      /// zlib counts bytes in 32 bits, so larger inputs are fed in pieces    
+      constexpr Count MaxPiece = Count {1} << 30;
+
+      /// Describe a zlib error                                               
+      ///   @param code - the zlib error code                                 
+      ///   @return the error message                                         
+      const char* ZLibError(int code) noexcept {
+         switch (code) {
+         case Z_STREAM_ERROR:
+            return "ZLIB: Invalid compression level or stream state";
+         case Z_DATA_ERROR:
+            return "ZLIB: Invalid or incomplete deflate data";
+         case Z_MEM_ERROR:
+            return "ZLIB: Out of memory";
+         case Z_VERSION_ERROR:
+            return "ZLIB: Version mismatch";
+         default:
+            return "ZLIB: Unknown error";
+         }
+      }
 
-   /// Report a zlib error                                                    
-   void pcZLibErrorRelay(int ret) {
-      switch (ret) {
-      case Z_STREAM_ERROR:
-         pcLogError << "ZLIB: Invalid compression level.";
-         break;
-      case Z_DATA_ERROR:
-         pcLogError << "ZLIB: Invalid or incomplete deflate data.";
-         break;
-      case Z_MEM_ERROR:
-         pcLogError << "ZLIB: Out of memory.";
-         break;
-      case Z_VERSION_ERROR:
-         pcLogError << "ZLIB: Version mismatch.";
-         break;
+   } // anonymous namespace
+
+
+   /// The deflate state                                                      
+   struct Compressor::State {
+      z_stream mStream {};
+      Compression mLevel;
+   };
+
+   /// Allocate the deflate state                                             
+   ///   @param level - the compression level                                 
+   Compressor::Compressor(Compression level) : mState {new State} {
+      mState->mLevel = level;
+      const auto result = deflateInit(&mState->mStream, static_cast<int>(level));
+      if (result != Z_OK) {
+         delete mState;
+         LANGULUS_THROW(Convert, ZLibError(result));
       }
    }
 
+   /// Release the deflate state                                              
+   Compressor::~Compressor() {
+      deflateEnd(&mState->mStream);
+      delete mState;
+   }
 
-   /// Compress data                                                          
-   /// You can compress sparse or NON-POD memory easily                       
-   /// Do not dereference data, however                                       
-   /// Containers should always decompress data before deallocating it.       
-   /// Can be used to compress RAM with live links, too                       
-   /// Make sure you serialize, before compressing prior to writing a file    
-   Count Block::Compress(Block& result, Compression compression_ratio) const {
-      if (!IsAllocated())
-         return 0;
-
-      // Allocate deflate state                                         
-      z_stream strm;
-      strm.zalloc = nullptr;
-      strm.zfree = nullptr;
-      strm.opaque = nullptr;
+   /// Change the compression level                                           
+   /// Should be done only between streams                                    
+   ///   @param level - the new compression level                             
+   void Compressor::SetLevel(Compression level) {
+      if (level == mState->mLevel)
+         return;
+
+      const auto result = deflateParams(&mState->mStream,
+         static_cast<int>(level), Z_DEFAULT_STRATEGY);
+      LANGULUS_ASSERT(result == Z_OK, Convert, ZLibError(result));
+      mState->mLevel = level;
+   }
 
-      int ret = deflateInit(&strm, int(compression_ratio));
-      if (ret != Z_OK) {
-         // Error while initializing deflator                           
-         pcZLibErrorRelay(ret);
+   /// Compress a chunk, appending the output to a container                  
+   /// The output is grown in place, by the worst-case compressed size of     
+   /// small inputs, and by ChunkSize bytes at a time for larger ones, so     
+   /// that the output never reserves much more than it needs, and nothing    
+   /// is copied through an intermediate buffer                               
+   ///   @param data - the bytes to compress                                  
+   ///   @param count - the number of bytes to compress                       
+   ///   @param to - [out] the compressed bytes are appended here             
+   ///   @param finish - true if this is the last chunk of the stream         
+   ///   @return the number of bytes appended to the output                   
+   Count Compressor::Update(const Byte* data, Count count, Bytes& to, bool finish) {
+      if (not count and not finish)
          return 0;
-      }
 
-      // Source and destination buffers                                 
-      auto out = new pcbyte[COMPRESSION_CHUNK];
-      Count written = 0;
-
-      // Compress the whole source memory, divided into chunks          
-      for (Count i = 0; i < mCount; i += COMPRESSION_CHUNK) {
-         strm.avail_in = uInt(mCount - i > COMPRESSION_CHUNK ? COMPRESSION_CHUNK : mCount - i);
-         strm.next_in = reinterpret_cast<pcu8*>(const_cast<pcbyte*>(At(i)));
-         strm.avail_out = COMPRESSION_CHUNK;
-         strm.next_out = reinterpret_cast<pcu8*>(out);
-
-         // Flush only the last chunk                                   
-         const int flush = (i + COMPRESSION_CHUNK) >= mCount ? Z_FINISH : Z_NO_FLUSH;
-         ret = deflate(&strm, flush);
-         if (ret != Z_OK) {
-            // Error while initializing deflator                        
-            pcZLibErrorRelay(ret);
-            delete[] out;
-            result.Free();
-            return 0;
+      auto& stream = mState->mStream;
+      const auto initial = to.GetCount();
+
+      do {
+         const auto piece = ::std::min(count, MaxPiece);
+         stream.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(data));
+         stream.avail_in = static_cast<uInt>(piece);
+         data += piece;
+         count -= piece;
+
+         const int flush = (finish and not count) ? Z_FINISH : Z_NO_FLUSH;
+         auto space = ::std::min(GetBound(stream.avail_in), ChunkSize);
+         do {
+            // Deflate until zlib stops filling the whole output        
+            stream.next_out = reinterpret_cast<Bytef*>(to.Extend(space).GetRaw());
+            stream.avail_out = static_cast<uInt>(space);
+
+            const auto result = deflate(&stream, flush);
+            to.Trim(to.GetCount() - stream.avail_out);
+            LANGULUS_ASSERT(result != Z_STREAM_ERROR, Convert, ZLibError(result));
+            space = ChunkSize;
          }
+         while (stream.avail_out == 0);
+      }
+      while (count);
 
-         // Copy deflated chunk to final output                         
-         const auto deflated = COMPRESSION_CHUNK - strm.avail_out;
-         result.Allocate(written + deflated);
-         written += pcCopyMemory(out, result.At(written), deflated);
+      if (finish) {
+         // Prepare for the next stream, keeping the allocated state    
+         deflateReset(&stream);
       }
 
-      // Clean up and return                                            
-      deflateEnd(&strm);
-      delete[] out;
-      result.mCount = written;
-      return written;
+      return to.GetCount() - initial;
    }
 
-   /// Decompress data                                                        
-   Count Block::Decompress(Block& result) const {
-      if (!IsAllocated())
-         return 0;
+   /// Discard any unfinished stream                                          
+   void Compressor::Reset() {
+      deflateReset(&mState->mStream);
+   }
 
-      // Allocate inflate state                                         
-      z_stream strm;
-      strm.zalloc = nullptr;
-      strm.zfree = nullptr;
-      strm.opaque = nullptr;
-      strm.avail_in = 0;
-      strm.next_in = nullptr;
-      int ret = inflateInit(&strm);
-
-      if (ret != Z_OK) {
-         // Error while initializing inflator                           
-         pcZLibErrorRelay(ret);
-         return 0;
+   /// Get the worst-case compressed size                                     
+   /// Same as zlib's compressBound(), but isn't limited to 32 bits           
+   ///   @param count - the number of bytes to compress                       
+   ///   @return the largest possible size of the compressed bytes            
+   Count Compressor::GetBound(Count count) noexcept {
+      return count + (count >> 12) + (count >> 14) + (count >> 25) + 13;
+   }
+
+   /// Get the compressor of the current thread, ready for a new stream       
+   ///   @param level - the compression level                                 
+   ///   @return the compressor                                               
+   Compressor& Compressor::GetLocal(Compression level) {
+      thread_local Compressor local {level};
+      local.Reset();
+      local.SetLevel(level);
+      return local;
+   }
+
+
+   /// The inflate state                                                      
+   struct Decompressor::State {
+      z_stream mStream {};
+      bool mFinished = false;
+   };
+
+   /// Allocate the inflate state                                             
+   Decompressor::Decompressor() : mState {new State} {
+      const auto result = inflateInit(&mState->mStream);
+      if (result != Z_OK) {
+         delete mState;
+         LANGULUS_THROW(Convert, ZLibError(result));
       }
+   }
 
-      // Source and destination buffers                                 
-      auto out = new pcbyte[COMPRESSION_CHUNK];
-      Count written = 0;
-
-      // Decompress until deflate stream ends or end of file            
-      for (Count i = 0; i < mCount; i += COMPRESSION_CHUNK) {
-         strm.avail_in = uInt(mCount - i > COMPRESSION_CHUNK ? COMPRESSION_CHUNK : mCount - i);
-         strm.next_in = reinterpret_cast<pcu8*>(const_cast<pcbyte*>(At(i)));
-         strm.avail_out = COMPRESSION_CHUNK;
-         strm.next_out = reinterpret_cast<pcu8*>(out);
-
-         ret = inflate(&strm, Z_NO_FLUSH);
-
-         // State not clobbered                                         
-         assert(ret != Z_STREAM_ERROR);
-         switch (ret) {
-         case Z_NEED_DICT:
-            ret = Z_DATA_ERROR;
-            [[fallthrough]];
-         case Z_DATA_ERROR:
-         case Z_MEM_ERROR:
-            inflateEnd(&strm);
-            pcZLibErrorRelay(ret);
-            delete[] out;
-            result.Free();
-            return 0;
-         }
+   /// Release the inflate state                                              
+   Decompressor::~Decompressor() {
+      inflateEnd(&mState->mStream);
+      delete mState;
+   }
 
-         // Copy inflated chunk to final output                         
-         const auto inflated = COMPRESSION_CHUNK - strm.avail_out;
-         result.Allocate(written + inflated);
-         written += pcCopyMemory(out, result.At(written), inflated);
+   /// Decompress a chunk, appending the output to a container                
+   /// Bytes after the end of the stream are ignored                          
+   ///   @param data - the bytes to decompress                                
+   ///   @param count - the number of bytes to decompress                     
+   ///   @param to - [out] the decompressed bytes are appended here           
+   ///   @return the number of bytes appended to the output                   
+   Count Decompressor::Update(const Byte* data, Count count, Bytes& to) {
+      if (mState->mFinished)
+         Reset();
+
+      auto& stream = mState->mStream;
+      const auto initial = to.GetCount();
+
+      while (count and not mState->mFinished) {
+         const auto piece = ::std::min(count, MaxPiece);
+         stream.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(data));
+         stream.avail_in = static_cast<uInt>(piece);
+         data += piece;
+         count -= piece;
+
+         auto space = ::std::min(Count {stream.avail_in} * 2, ChunkSize);
+         do {
+            // Inflate until zlib stops filling the whole output        
+            stream.next_out = reinterpret_cast<Bytef*>(to.Extend(space).GetRaw());
+            stream.avail_out = static_cast<uInt>(space);
+
+            const auto result = inflate(&stream, Z_NO_FLUSH);
+            to.Trim(to.GetCount() - stream.avail_out);
+            LANGULUS_ASSERT(result == Z_OK or result == Z_STREAM_END or result == Z_BUF_ERROR,
+               Convert, ZLibError(result == Z_NEED_DICT ? Z_DATA_ERROR : result));
+
+            if (result == Z_STREAM_END) {
+               mState->mFinished = true;
+               break;
+            }
+
+            space = ChunkSize;
+         }
+         while (stream.avail_out == 0);
       }
 
-      // Clean up and return                                            
-      inflateEnd(&strm);
-      delete[] out;
-      result.mCount = written;
-      return written;
+      return to.GetCount() - initial;
    }
 
-} // namespace Langulus::Anyness*/
\ No newline at end of file
+   /// Discard any unfinished stream                                          
+   void Decompressor::Reset() {
+      inflateReset(&mState->mStream);
+      mState->mFinished = false;
+   }
+
+   /// Check if the end of the stream was reached                             
+   ///   @return true if the whole stream was decompressed                    
+   bool Decompressor::IsFinished() const noexcept {
+      return mState->mFinished;
+   }
+
+   /// Get the decompressor of the current thread, ready for a new stream     
+   ///   @return the decompressor                                             
+   Decompressor& Decompressor::GetLocal() {
+      thread_local Decompressor local;
+      local.Reset();
+      return local;
+   }
+
+} // namespace Langulus::Anyness
+
+#endif
\ No newline at end of file
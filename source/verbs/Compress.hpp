@@ -0,0 +1,79 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../blocks/Block.hpp"
+
+#if LANGULUS_FEATURE(COMPRESSION)
+
+namespace Langulus::Anyness
+{
+
+   ///                                                                        
+   ///   Streaming zlib compressor                                            
+   ///                                                                        
+   ///   Deflates any number of chunks into a single zlib stream, writing     
+   /// directly at the back of a Bytes container, which is grown only when    
+   /// the compressed output can't fit in it. The deflate state is allocated  
+   /// once, and is reset after each finished stream, so a compressor can be  
+   /// reused for any number of streams without reallocating it.              
+   ///                                                                        
+   class Compressor {
+      struct State;
+      State* mState;
+
+   public:
+      /// Output is grown by at most this many bytes at once                  
+      static constexpr Count ChunkSize = 64 * 1024;
+
+      LANGULUS_API(ANYNESS) explicit Compressor(Compression = Compression::Default);
+      Compressor(const Compressor&) = delete;
+      LANGULUS_API(ANYNESS) ~Compressor();
+
+      LANGULUS_API(ANYNESS) void SetLevel(Compression);
+      LANGULUS_API(ANYNESS) Count Update(const Byte*, Count, Bytes&, bool finish = false);
+      LANGULUS_API(ANYNESS) void Reset();
+
+      NOD() LANGULUS_API(ANYNESS)
+      static Count GetBound(Count) noexcept;
+      NOD() LANGULUS_API(ANYNESS)
+      static Compressor& GetLocal(Compression);
+   };
+
+
+   ///                                                                        
+   ///   Streaming zlib decompressor                                          
+   ///                                                                        
+   ///   Inflates a zlib stream, that is provided in any number of chunks,    
+   /// writing directly at the back of a Bytes container. The inflate state   
+   /// is allocated once, and is reset lazily, when a new stream begins after 
+   /// a finished one.                                                        
+   ///                                                                        
+   class Decompressor {
+      struct State;
+      State* mState;
+
+   public:
+      /// Output is grown by at most this many bytes at once                  
+      static constexpr Count ChunkSize = 64 * 1024;
+
+      LANGULUS_API(ANYNESS) Decompressor();
+      Decompressor(const Decompressor&) = delete;
+      LANGULUS_API(ANYNESS) ~Decompressor();
+
+      LANGULUS_API(ANYNESS) Count Update(const Byte*, Count, Bytes&);
+      LANGULUS_API(ANYNESS) void Reset();
+
+      NOD() LANGULUS_API(ANYNESS)
+      bool IsFinished() const noexcept;
+      NOD() LANGULUS_API(ANYNESS)
+      static Decompressor& GetLocal();
+   };
+
+} // namespace Langulus::Anyness
+
+#endif
\ No newline at end of file
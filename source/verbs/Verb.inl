@@ -356,7 +356,7 @@ namespace Langulus::A
                if (mSource.IsValid())
                   out += ' ';
                out += mVerb->mTokenReverse;
-               out += static_cast<OUT>(GetCharge().operator*(-1));
+               out += static_cast<CT::SerialItem<OUT>>(GetCharge().operator*(-1));
                writtenAsToken = true;
             }
          }
@@ -370,7 +370,7 @@ namespace Langulus::A
                if (mSource.IsValid())
                   out += ' ';
                out += mVerb->mToken;
-               out += static_cast<OUT>(GetCharge());
+               out += static_cast<CT::SerialItem<OUT>>(GetCharge());
                writtenAsToken = true;
             }
          }
@@ -0,0 +1,109 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Anyness/Text.hpp>
+#include <Anyness/TMap.hpp>
+#include "Common.hpp"
+
+#if not LANGULUS_FEATURE(MANAGED_MEMORY)
+
+/// Build the kind of temporaries, that a single request usually produces     
+///   @param seed - varies the contents                                       
+///   @return the number of produced elements                                 
+Count Arena_Helper_Request(int seed) {
+   TUnorderedMap<Text, TMany<int>> map;
+   for (int i = 0; i < 32; ++i) {
+      TMany<int> numbers;
+      for (int j = 0; j < 16; ++j)
+         numbers << seed + i + j;
+
+      map.Insert(Text {seed + i}, ::std::move(numbers));
+   }
+
+   Many texts;
+   for (int i = 0; i < 32; ++i)
+      texts << Text {seed * 1000 + i};
+
+   return map.GetCount() + texts.GetCount();
+}
+
+
+SCENARIO("Allocating from an arena", "[arena]") {
+   static Allocator::State memoryState;
+
+   GIVEN("No arena") {
+      REQUIRE(Arena::GetCurrent() == nullptr);
+
+      WHEN("An arena is installed") {
+         Arena arena;
+         REQUIRE(Arena::GetCurrent() == &arena);
+
+         THEN("Containers are allocated from it, and work as usual") {
+            TMany<Text> texts;
+            for (int i = 0; i < 1000; ++i)
+               texts << Text {i};
+
+            Text joined;
+            for (auto& text : texts)
+               joined += text;
+
+            REQUIRE(texts.GetCount() == 1000);
+            for (int i = 0; i < 1000; ++i)
+               REQUIRE(texts[i] == Text {i});
+            REQUIRE(joined.Terminate().GetRaw()[joined.GetCount()] == '\0');
+            REQUIRE(Arena_Helper_Request(5) == 64);
+         }
+
+         THEN("Nested arenas are installed, and uninstalled in order") {
+            {
+               Arena nested {256};
+               REQUIRE(Arena::GetCurrent() == &nested);
+
+               const Text piece {"a text, that quickly outgrows the chunks"};
+               Text big = piece;
+               for (int i = 0; i < 10; ++i)
+                  big += Text {big};
+               REQUIRE(big.GetCount() == piece.GetCount() * 1024);
+            }
+
+            REQUIRE(Arena::GetCurrent() == &arena);
+         }
+      }
+
+      WHEN("Containers from the heap are released inside an arena") {
+         auto text = new Text {"heap"};
+         TMany<int> numbers {1, 2, 3};
+         {
+            Arena arena;
+            delete text;
+            numbers << 4;
+            numbers.Reset();
+         }
+
+         REQUIRE(Arena::GetCurrent() == nullptr);
+      }
+   }
+
+   #ifdef LANGULUS_STD_BENCHMARK
+      BENCHMARK_ADVANCED("Anyness::Arena - request temporaries (heap)") (timer meter) {
+         meter.measure([&](int i) {
+            return Arena_Helper_Request(i);
+         });
+      };
+
+      BENCHMARK_ADVANCED("Anyness::Arena - request temporaries (arena)") (timer meter) {
+         meter.measure([&](int i) {
+            Arena arena;
+            return Arena_Helper_Request(i);
+         });
+      };
+   #endif
+
+   REQUIRE(memoryState.Assert());
+}
+
+#endif
\ No newline at end of file
@@ -157,4 +157,395 @@ SCENARIO("Byte manipulation", "[bytes]") {
    }
 
    REQUIRE(memoryState.Assert());
-}
\ No newline at end of file
+}
+
+SCENARIO("Binary serialization", "[bytes]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A deep container, that repeats the same types") {
+      TMany<Many> data;
+      for (int i = 0; i < 100; ++i)
+         data << Many {i};
+
+      WHEN("Serialized") {
+         Bytes serialized;
+         data.Serialize(serialized);
+
+         // Count occurences of the int token in the stream             
+         const auto token = MetaDataOf<int>()->mToken;
+         const auto raw = reinterpret_cast<const char*>(serialized.GetRaw());
+         const ::std::string_view stream {raw, serialized.GetCount()};
+         Count occurences = 0;
+         for (auto at = stream.find(token); at != stream.npos; at = stream.find(token, at + 1))
+            ++occurences;
+
+         ::std::uint16_t version;
+         ::std::uint32_t definitions;
+         ::std::memcpy(&version, raw + 2, sizeof(version));
+         ::std::memcpy(&definitions, raw + 4, sizeof(definitions));
+
+         REQUIRE(occurences == 1);
+         REQUIRE(version == 2);
+         REQUIRE(definitions == 2);
+
+         #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+            Many result;
+            REQUIRE(serialized.Deserialize(result) == serialized.GetCount());
+            REQUIRE(result.GetCount() == 100);
+            REQUIRE(result.IsDeep());
+            REQUIRE(result.As<Many>(42).As<int>() == 42);
+         #endif
+      }
+   }
+
+   GIVEN("A sparse container of POD") {
+      int values[64];
+      TMany<int*> data;
+      for (int i = 0; i < 64; ++i) {
+         values[i] = i * 3;
+         data << &values[63 - i];
+      }
+
+      WHEN("Serialized") {
+         Bytes serialized;
+         data.Serialize(serialized);
+
+         // Pointees are gathered at the end of the stream, in order    
+         const auto size = sizeof(int) * 64;
+         REQUIRE(serialized.GetCount() > size);
+         const auto raw = serialized.GetRaw() + serialized.GetCount() - size;
+         for (int i = 0; i < 64; ++i) {
+            int value;
+            ::std::memcpy(&value, raw + i * sizeof(int), sizeof(int));
+            REQUIRE(value == values[63 - i]);
+         }
+
+         #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+            Many result;
+            REQUIRE(serialized.Deserialize(result) == serialized.GetCount());
+            REQUIRE(result.GetCount() == 64);
+            REQUIRE(result.IsSparse());
+            for (int i = 0; i < 64; ++i)
+               REQUIRE(*result.As<int*>(i) == values[63 - i]);
+         #endif
+      }
+   }
+
+   GIVEN("A container of symbols") {
+      TMany<Symbol> data;
+      data << Symbol {"first"} << Symbol {"second"} << Symbol {"first"} << Symbol {};
+
+      WHEN("Serialized") {
+         Bytes serialized;
+         data.Serialize(serialized);
+
+         // Symbols are written as their letters, not as pointers       
+         const auto raw = reinterpret_cast<const char*>(serialized.GetRaw());
+         const ::std::string_view stream {raw, serialized.GetCount()};
+         REQUIRE(stream.find("first") != stream.npos);
+         REQUIRE(stream.find("second") != stream.npos);
+
+         #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+            const auto interned = Symbol::GetInternedCount();
+            Many result;
+            REQUIRE(serialized.Deserialize(result) == serialized.GetCount());
+            REQUIRE(result.GetCount() == 4);
+            REQUIRE(result.Is<Symbol>());
+            REQUIRE(Symbol::GetInternedCount() == interned);
+
+            // Deserialized symbols refer to the same interned entries  
+            for (int i = 0; i < 4; ++i) {
+               REQUIRE(result.As<Symbol>(i) == data[i]);
+               REQUIRE(result.As<Symbol>(i).GetRaw() == data[i].GetRaw());
+               REQUIRE(result.As<Symbol>(i).GetHash() == data[i].GetHash());
+            }
+            REQUIRE(result.As<Symbol>(3).IsEmpty());
+         #endif
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+SCENARIO("Streaming binary deserialization", "[bytes]") {
+   static Allocator::State memoryState;
+
+   GIVEN("Two payloads, serialized back to back") {
+      TMany<int> numbers;
+      for (int i = 0; i < 100000; ++i)
+         numbers << i;
+      TMany<Text> texts;
+      texts << "first" << "second" << "third";
+
+      Bytes serialized;
+      numbers.Serialize(serialized);
+      const auto first = serialized.GetCount();
+      texts.Serialize(serialized);
+
+      // A source, that hands out at most a small chunk at a time       
+      Offset at = 0;
+      auto source = [&](Byte* to, Count count) -> Count {
+         count = ::std::min({count, Count {1000}, serialized.GetCount() - at});
+         ::std::memcpy(to, serialized.GetRaw() + at, count);
+         at += count;
+         return count;
+      };
+
+      WHEN("Streamed from a callable in small chunks") {
+         ByteStream stream {source, 1000};
+
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         Many resultNumbers, resultTexts;
+         REQUIRE(stream.Deserialize(resultNumbers) == first);
+         REQUIRE(stream.Deserialize(resultTexts) == serialized.GetCount() - first);
+         REQUIRE(stream.GetOffset() == serialized.GetCount());
+
+         REQUIRE(resultNumbers == numbers);
+         REQUIRE(resultTexts == texts);
+
+         // The whole payload never has to be in memory at once         
+         REQUIRE(stream.GetBuffered() < first / 2);
+      #endif
+      }
+
+      WHEN("Streamed from a file") {
+         const auto file = ::std::tmpfile();
+         REQUIRE(file);
+         REQUIRE(::std::fwrite(serialized.GetRaw(), 1, serialized.GetCount(), file)
+            == serialized.GetCount());
+         ::std::rewind(file);
+
+         {
+            ByteStream stream {file};
+
+         #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+            Many resultNumbers, resultTexts;
+            REQUIRE(stream.Deserialize(resultNumbers) == first);
+            REQUIRE(stream.Deserialize(resultTexts) == serialized.GetCount() - first);
+            REQUIRE(resultNumbers == numbers);
+            REQUIRE(resultTexts == texts);
+         #endif
+         }
+
+         ::std::fclose(file);
+      }
+
+      WHEN("The stream ends too early") {
+         serialized.Trim(first / 2);
+         ByteStream stream {source};
+
+         Many result;
+         REQUIRE_THROWS(stream.Deserialize(result));
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+SCENARIO("Zero-copy deserialization", "[bytes]") {
+   static Allocator::State memoryState;
+
+   GIVEN("Serialized dense POD and texts") {
+      TMany<Many> data;
+      data << Many {TMany<float> {1.5f, 2.5f, 3.5f, 4.5f}};
+      data << Many {TMany<Text> {"first", "second"}};
+
+      Bytes serialized;
+      data.Serialize(serialized);
+      const auto begin = serialized.GetRaw();
+      const auto end = begin + serialized.GetCount();
+
+      WHEN("Deserialized as views into the bytes") {
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         Many result;
+         REQUIRE(serialized.Deserialize<true>(result) == serialized.GetCount());
+
+         auto& floats = result.As<Many>(0);
+         auto& texts = result.As<Many>(1);
+         REQUIRE(floats == data[0]);
+         REQUIRE(texts == data[1]);
+
+         // Nothing was copied - the bytes are only referenced          
+         REQUIRE(floats.GetRaw<Byte>() >= begin);
+         REQUIRE(floats.GetRaw<Byte>() < end);
+         REQUIRE(0 == reinterpret_cast<::std::uintptr_t>(floats.GetRaw()) % alignof(float));
+         REQUIRE(texts.As<Text>(1).GetRaw<Byte>() >= begin);
+         REQUIRE(texts.As<Text>(1).GetRaw<Byte>() < end);
+         REQUIRE(serialized.GetUses() > 1);
+
+         // Mutations branch out, and leave the bytes intact            
+         floats << 5.5f;
+         REQUIRE(floats.GetCount() == 5);
+         REQUIRE((floats.GetRaw<Byte>() < begin or floats.GetRaw<Byte>() >= end));
+         REQUIRE(floats.As<float>(0) == 1.5f);
+         REQUIRE(data[0] == TMany<float> {1.5f, 2.5f, 3.5f, 4.5f});
+      #endif
+      }
+
+      WHEN("Deserialized from a mapped file") {
+         const char* filename = "AnynessMappedFileTest.lgls";
+         const auto file = ::std::fopen(filename, "wb");
+         REQUIRE(file);
+         REQUIRE(::std::fwrite(serialized.GetRaw(), 1, serialized.GetCount(), file)
+            == serialized.GetCount());
+         ::std::fclose(file);
+
+         {
+            MappedFile mapped {filename};
+            REQUIRE(mapped.GetCount() == serialized.GetCount());
+            REQUIRE(mapped.GetBytes() == serialized);
+
+         #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+            Many result;
+            REQUIRE(mapped.Deserialize(result) == serialized.GetCount());
+
+            auto& floats = result.As<Many>(0);
+            REQUIRE(floats == data[0]);
+            REQUIRE(floats.IsStatic());
+            REQUIRE(IsMapped(floats.GetRaw()));
+            REQUIRE_FALSE(IsMapped(serialized.GetRaw()));
+
+            // Mutations take authority over the mapped elements        
+            floats << 5.5f;
+            REQUIRE(not floats.IsStatic());
+            REQUIRE(floats.GetCount() == 5);
+            REQUIRE(floats.As<float>(3) == 4.5f);
+         #endif
+         }
+
+         ::std::remove(filename);
+      }
+
+      WHEN("Only a view of dense POD remains, and it is changed") {
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         Many floats;
+         {
+            Many result;
+            REQUIRE(serialized.Deserialize<true>(result) == serialized.GetCount());
+            floats = result.As<Many>(0);
+         }
+         serialized.Reset();
+
+         // The view holds the last reference to the bytes, but it      
+         // starts inside them, so it must be moved, not relocated      
+         REQUIRE(floats.GetUses() == 1);
+         floats << 5.5f;
+
+         REQUIRE(floats.GetUses() == 1);
+         REQUIRE(floats == TMany<float> {1.5f, 2.5f, 3.5f, 4.5f, 5.5f});
+      #endif
+      }
+
+      WHEN("Only a view of a text remains, and it is changed") {
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         Text text;
+         {
+            Many result;
+            REQUIRE(serialized.Deserialize<true>(result) == serialized.GetCount());
+            text = result.As<Many>(1).As<Text>(1);
+         }
+         serialized.Reset();
+
+         REQUIRE(text.GetUses() == 1);
+         text += " and third";
+
+         REQUIRE(text.GetUses() == 1);
+         REQUIRE(text == "second and third");
+         REQUIRE(text.Terminate() == "second and third");
+      #endif
+      }
+   }
+
+   GIVEN("A container, that views disowned memory") {
+      TMany<float> source {4.5f, 1.5f, 3.5f};
+      TMany<float> view {Disown(source)};
+      REQUIRE(view.IsStatic());
+
+      WHEN("Sorted") {
+         view.template Sort<true>();
+
+         THEN("It is sorted in place, because it isn't a mapped file") {
+            REQUIRE(view.IsStatic());
+            REQUIRE(view.GetRaw() == source.GetRaw());
+            REQUIRE(source == TMany<float> {1.5f, 3.5f, 4.5f});
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+#if LANGULUS_FEATURE(COMPRESSION)
+SCENARIO("Compression", "[bytes]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A large repetitive container") {
+      TMany<int> numbers;
+      for (int i = 0; i < 100000; ++i)
+         numbers << i % 100;
+      const Count size = numbers.GetBytesize();
+
+      WHEN("Compressed and decompressed at once") {
+         Bytes compressed;
+         const auto written = numbers.Compress(compressed);
+
+         REQUIRE(written == compressed.GetCount());
+         REQUIRE(written < size / 10);
+         REQUIRE(compressed.IsCompressed());
+
+         // Output is grown in steps, not by the worst-case size        
+         REQUIRE(compressed.GetReserved() < size / 2);
+
+         Bytes decompressed;
+         REQUIRE(compressed.Decompress(decompressed) == size);
+         REQUIRE(0 == ::std::memcmp(decompressed.GetRaw(), numbers.GetRaw(), size));
+
+         // Thread-local streams are reused for the next block          
+         Bytes again;
+         REQUIRE(numbers.Compress(again, Compression::Smallest) <= written);
+         decompressed.Clear();
+         REQUIRE(again.Decompress(decompressed) == size);
+         REQUIRE(0 == ::std::memcmp(decompressed.GetRaw(), numbers.GetRaw(), size));
+      }
+
+      WHEN("Compressed at the back of a container, that isn't empty") {
+         const char header[] = "head";
+         Bytes compressed;
+         compressed += Bytes::From(
+            Disown(reinterpret_cast<const Byte*>(header)), 4);
+         const auto written = numbers.Compress(compressed);
+
+         THEN("The container isn't marked as compressed") {
+            REQUIRE(compressed.GetCount() == written + 4);
+            REQUIRE_FALSE(compressed.IsCompressed());
+         }
+      }
+
+      WHEN("Compressed and decompressed in small chunks") {
+         const auto raw = numbers.GetRaw<Byte>();
+         constexpr Count Piece = 1000;
+
+         Compressor compressor {Compression::Balanced};
+         Bytes compressed;
+         for (Offset i = 0; i < size; i += Piece)
+            compressor.Update(raw + i, ::std::min(Piece, size - i), compressed);
+         compressor.Update(nullptr, 0, compressed, true);
+         REQUIRE(compressed.GetCount() < size / 10);
+
+         Decompressor decompressor;
+         Bytes decompressed;
+         for (Offset i = 0; i < compressed.GetCount(); i += Piece) {
+            REQUIRE(not decompressor.IsFinished());
+            decompressor.Update(compressed.GetRaw() + i,
+               ::std::min(Piece, compressed.GetCount() - i), decompressed);
+         }
+
+         REQUIRE(decompressor.IsFinished());
+         REQUIRE(decompressed.GetCount() == size);
+         REQUIRE(0 == ::std::memcmp(decompressed.GetRaw(), raw, size));
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+#endif
\ No newline at end of file
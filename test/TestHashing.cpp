@@ -10,6 +10,7 @@
 #include <Anyness/TMap.hpp>
 #include <Anyness/TSet.hpp>
 #include <Anyness/Trait.hpp>
+#include <Anyness/Many.hpp>
 #include "Common.hpp"
 
 
@@ -134,3 +135,77 @@ TEMPLATE_TEST_CASE(
    BANK.Reset();
    REQUIRE_FALSE(Allocator::CollectGarbage());
 }
+
+/// Hashes of containers with a cached hash must always match the hash of     
+/// their contents, no matter how they're changed                             
+SCENARIO("Caching hashes of texts and bytes", "[hash]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A text with a cached hash") {
+      HashedText text {"a rather long text, that is used as a key"};
+      REQUIRE_FALSE(text.IsHashed());
+      REQUIRE(text.GetHash() == text->GetHash());
+      REQUIRE(text.IsHashed());
+
+      WHEN("Letters are appended") {
+         text << "!";
+         REQUIRE_FALSE(text.IsHashed());
+         REQUIRE(text.GetHash() == HashOf(Text {"a rather long text, that is used as a key!"}));
+      }
+
+      WHEN("Letters are changed in place, while memory is shared") {
+         const HashedText shared = text;
+         text.Edit()[0] = 'A';
+
+         REQUIRE(text.GetHash() == HashOf(Text {"A rather long text, that is used as a key"}));
+         REQUIRE(shared.GetHash() == HashOf(Text {"a rather long text, that is used as a key"}));
+         REQUIRE_FALSE(text == shared);
+      }
+
+      WHEN("The text is moved") {
+         HashedText moved = ::std::move(text);
+         REQUIRE(moved.IsHashed());
+         REQUIRE_FALSE(text.IsHashed());
+         REQUIRE(text.GetHash() == HashOf(Text {}));
+      }
+
+      WHEN("Used as a map key") {
+         TUnorderedMap<HashedText, int> map;
+         map.Insert(text, 1);
+         REQUIRE(map[text] == 1);
+      }
+   }
+
+   GIVEN("Bytes with a cached hash") {
+      const int some[] = {1, 2, 3, 4};
+      const int more[] = {5};
+      const int all[] = {1, 2, 3, 4, 5};
+
+      HashedBytes bytes {Bytes {some}};
+      const auto hash = bytes.GetHash();
+      REQUIRE(hash == HashOf(Bytes {some}));
+
+      bytes += Bytes {more};
+      REQUIRE(bytes.GetHash() == HashOf(Bytes {all}));
+      REQUIRE(bytes.GetHash() != hash);
+   }
+
+   #ifdef LANGULUS_STD_BENCHMARK
+      GIVEN("A long text") {
+         Text text;
+         for (int i = 0; i < 100; ++i)
+            text += "a rather long text, that is used as a key";
+         HashedText hashed = text;
+
+         BENCHMARK("Anyness::Text::GetHash") {
+            return text.GetHash();
+         };
+
+         BENCHMARK("Anyness::HashedText::GetHash") {
+            return hashed.GetHash();
+         };
+      }
+   #endif
+
+   REQUIRE(memoryState.Assert());
+}
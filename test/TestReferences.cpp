@@ -0,0 +1,187 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Anyness/Text.hpp>
+#include <Anyness/Many.hpp>
+#include <Anyness/TMap.hpp>
+#include "Common.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+/// Counts live instances, to detect elements that were never destroyed       
+struct Counted {
+   static inline std::atomic<int> Live = 0;
+   int data = 0;
+
+   Counted() { ++Live; }
+   Counted(const Counted& other) : data {other.data} { ++Live; }
+   ~Counted() { --Live; }
+};
+
+/// Release two owners of the same memory at the same time, many times over,  
+/// so that both see the memory as shared, but one of them ends up last       
+///   @param make - creates the container, and a copy of it                   
+template<class F>
+void ReleaseSimultaneously(F&& make) {
+   for (int i = 0; i < 2000; ++i) {
+      auto owners = make();
+      std::atomic<int> ready = 0;
+      std::thread other {[&] {
+         ++ready;
+         while (ready < 2);
+         owners.second.Reset();
+      }};
+
+      ++ready;
+      while (ready < 2);
+      owners.first.Reset();
+      other.join();
+   }
+}
+
+
+SCENARIO("Reference counting of allocations", "[references]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A container") {
+      TMany<int> pack {1, 2, 3, 4, 5};
+      auto entry = const_cast<Allocation*>(pack.GetAllocation());
+
+      REQUIRE(pack.GetUses() == 1);
+
+      WHEN("Referenced and dereferenced manually") {
+         entry->Keep();
+         entry->Keep(3);
+         REQUIRE(pack.GetUses() == 5);
+         REQUIRE(entry->Free() == 4);
+         REQUIRE(entry->Free(3) == 1);
+         REQUIRE(pack.GetUses() == 1);
+      }
+
+      WHEN("Shared by copying") {
+         {
+            auto copy1 = pack;
+            Many copy2 = pack;
+            REQUIRE(pack.GetUses() == 3);
+         }
+
+         REQUIRE(pack.GetUses() == 1);
+      }
+
+      #if LANGULUS_FEATURE(ATOMIC_REFERENCES)
+      WHEN("Shared between multiple threads") {
+         constexpr int Threads = 8;
+         constexpr int Iterations = 10000;
+         std::atomic<int> sum = 0;
+         std::vector<std::thread> threads;
+
+         for (int t = 0; t < Threads; ++t) {
+            threads.emplace_back([&] {
+               for (int i = 0; i < Iterations; ++i) {
+                  auto copy = pack;
+                  sum += copy[i % 5];
+               }
+            });
+         }
+
+         for (auto& thread : threads)
+            thread.join();
+
+         REQUIRE(pack.GetUses() == 1);
+         REQUIRE(sum == Threads * Iterations * 3);
+      }
+
+      WHEN("The last two owners are released simultaneously") {
+         ReleaseSimultaneously([] {
+            TMany<Counted> a;
+            a.New(8);
+            auto b = a;
+            return std::pair {std::move(a), std::move(b)};
+         });
+         REQUIRE(Counted::Live == 0);
+
+         ReleaseSimultaneously([] {
+            TMany<Text> a {"one", "two", "three"};
+            auto b = a;
+            return std::pair {std::move(a), std::move(b)};
+         });
+
+         ReleaseSimultaneously([] {
+            TUnorderedMap<int, Counted> a;
+            for (int i = 0; i < 8; ++i)
+               a.Insert(i, Counted {});
+            auto b = a;
+            return std::pair {std::move(a), std::move(b)};
+         });
+         REQUIRE(Counted::Live == 0);
+      }
+      #endif
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("Allocation::Keep/Free (single thread)") (timer meter) {
+            meter.measure([&] {
+               entry->Keep();
+               return entry->Free();
+            });
+         };
+
+         #if LANGULUS_FEATURE(ATOMIC_REFERENCES)
+            // Contending for non-atomic references would corrupt them  
+            BENCHMARK_ADVANCED("Allocation::Keep/Free (4 contending threads)") (timer meter) {
+               meter.measure([&] {
+                  std::vector<std::thread> threads;
+                  for (int t = 0; t < 4; ++t) {
+                     threads.emplace_back([&] {
+                        for (int i = 0; i < 100000; ++i) {
+                           entry->Keep();
+                           entry->Free();
+                        }
+                     });
+                  }
+
+                  for (auto& thread : threads)
+                     thread.join();
+                  return entry->GetUses();
+               });
+            };
+         #endif
+
+         // Baselines to compare against, regardless of the build mode  
+         BENCHMARK_ADVANCED("Non-atomic increment/decrement (single thread)") (timer meter) {
+            volatile Count counter = 1;
+            meter.measure([&] {
+               counter = counter + 1;
+               counter = counter - 1;
+               return counter;
+            });
+         };
+
+         BENCHMARK_ADVANCED("Atomic increment/decrement (4 contending threads)") (timer meter) {
+            std::atomic<Count> counter = 1;
+            meter.measure([&] {
+               std::vector<std::thread> threads;
+               for (int t = 0; t < 4; ++t) {
+                  threads.emplace_back([&] {
+                     for (int i = 0; i < 100000; ++i) {
+                        counter.fetch_add(1, std::memory_order_relaxed);
+                        counter.fetch_sub(1, std::memory_order_acq_rel);
+                     }
+                  });
+               }
+
+               for (auto& thread : threads)
+                  thread.join();
+               return counter.load();
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
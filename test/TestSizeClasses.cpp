@@ -0,0 +1,210 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Anyness/Text.hpp>
+#include "Common.hpp"
+#include <thread>
+#include <vector>
+
+#if not LANGULUS_FEATURE(MANAGED_MEMORY)
+
+/// Deallocates a small chunk, when destroyed at thread exit - it is created  
+/// before the thread's cache, so it is destroyed after the cache is drained  
+struct SizeClasses_Helper_LateRelease {
+   Allocation* mEntry {};
+   bool* mClosed {};
+   Count* mCached {};
+
+   ~SizeClasses_Helper_LateRelease() {
+      if (not mEntry)
+         return;
+
+      const auto c = SizeClasses::GetClass(mEntry->GetAllocatedSize());
+      Allocator::Deallocate(mEntry);
+      *mClosed = SizeClasses::IsClosed();
+      *mCached = SizeClasses::GetCachedCount(c);
+   }
+};
+
+
+SCENARIO("Caching small chunks in per-thread size classes", "[allocator]") {
+   static Allocator::State memoryState;
+
+   static_assert(SizeClasses::IsPooled(SizeClasses::LargestClass));
+   static_assert(not SizeClasses::IsPooled(SizeClasses::LargestClass + 1));
+   static_assert(SizeClasses::GetClass(1) == 0);
+   static_assert(SizeClasses::GetClass(SizeClasses::SmallestClass) == 0);
+   static_assert(SizeClasses::GetClass(SizeClasses::SmallestClass + 1) == 1);
+   static_assert(SizeClasses::GetClassSize(SizeClasses::ClassCount - 1)
+              == SizeClasses::LargestClass);
+
+   GIVEN("No arena") {
+      REQUIRE(Arena::GetCurrent() == nullptr);
+      constexpr Offset Size = 100;
+      const auto c = SizeClasses::GetClass(Size);
+
+      WHEN("A small chunk is released, and a chunk of the same class is allocated") {
+         const auto first = Allocator::Allocate(nullptr, Size);
+         REQUIRE(first);
+         const auto cached = SizeClasses::GetCachedCount(c);
+         Allocator::Deallocate(first);
+         REQUIRE(SizeClasses::GetCachedCount(c) == cached + 1);
+
+         const auto second = Allocator::Allocate(nullptr, Size + 20);
+
+         THEN("The released chunk is reused") {
+            REQUIRE(second == first);
+            REQUIRE(second->GetAllocatedSize() == Size + 20);
+            REQUIRE(second->GetUses() == 1);
+            REQUIRE(SizeClasses::GetCachedCount(c) == cached);
+         }
+
+         Allocator::Deallocate(second);
+      }
+
+      WHEN("A chunk of a different class is allocated") {
+         const auto first = Allocator::Allocate(nullptr, Size);
+         Allocator::Deallocate(first);
+         const auto other = Allocator::Allocate(nullptr, Size * 4);
+
+         THEN("The released chunk is not reused") {
+            REQUIRE(SizeClasses::GetClass(Size * 4) != c);
+            REQUIRE(other != first);
+            REQUIRE(SizeClasses::GetCachedCount(c) > 0);
+         }
+
+         Allocator::Deallocate(other);
+      }
+
+      WHEN("More chunks than the cap are released") {
+         ::std::vector<Allocation*> entries;
+         for (Count i = 0; i < SizeClasses::MaxCachedChunks + 16; ++i)
+            entries.push_back(Allocator::Allocate(nullptr, Size));
+         REQUIRE(SizeClasses::GetCachedCount(c) == 0);
+
+         for (auto entry : entries)
+            Allocator::Deallocate(entry);
+
+         THEN("Only up to the cap are cached, the rest are freed") {
+            REQUIRE(SizeClasses::GetCachedCount(c) == SizeClasses::MaxCachedChunks);
+         }
+      }
+
+      WHEN("A chunk is released on a different thread") {
+         const auto entry = Allocator::Allocate(nullptr, Size);
+         const auto cached = SizeClasses::GetCachedCount(c);
+         Count cachedThere = 0;
+         Allocation* reusedThere = nullptr;
+
+         ::std::thread {[&] {
+            Allocator::Deallocate(entry);
+            cachedThere = SizeClasses::GetCachedCount(c);
+            reusedThere = Allocator::Allocate(nullptr, Size);
+            Allocator::Deallocate(reusedThere);
+         }}.join();
+
+         THEN("It is cached and reused by the releasing thread") {
+            REQUIRE(cachedThere == 1);
+            REQUIRE(reusedThere == entry);
+            REQUIRE(SizeClasses::GetCachedCount(c) == cached);
+         }
+      }
+
+      WHEN("A thread ends, and then releases a chunk") {
+         bool closed = false;
+         Count cachedAfterExit = 1;
+         Count cachedBeforeExit = 0;
+         bool closedBeforeExit = true;
+
+         ::std::thread {[&] {
+            // Must be constructed before the first chunk is cached     
+            static thread_local SizeClasses_Helper_LateRelease late;
+            late.mClosed = &closed;
+            late.mCached = &cachedAfterExit;
+            late.mEntry = Allocator::Allocate(nullptr, Size);
+
+            Allocator::Deallocate(Allocator::Allocate(nullptr, Size));
+            cachedBeforeExit = SizeClasses::GetCachedCount(c);
+            closedBeforeExit = SizeClasses::IsClosed();
+         }}.join();
+
+         THEN("The cache was drained, and the late chunk was freed") {
+            REQUIRE(cachedBeforeExit == 1);
+            REQUIRE_FALSE(closedBeforeExit);
+            REQUIRE(closed);
+            REQUIRE(cachedAfterExit == 0);
+         }
+      }
+
+      WHEN("A small chunk is relocated within its class") {
+         const auto entry = Allocator::Allocate(nullptr, Size);
+         for (Offset i = 0; i < Size; ++i)
+            entry->GetBlockStart()[i] = static_cast<Byte>(i);
+
+         const auto relocated = Allocator::Relocate(Size + 20, entry);
+
+         THEN("The chunk is resized in place, and contents are kept") {
+            REQUIRE(relocated == entry);
+            REQUIRE(relocated->GetAllocatedSize() == Size + 20);
+            for (Offset i = 0; i < Size; ++i)
+               REQUIRE(relocated->GetBlockStart()[i] == static_cast<Byte>(i));
+         }
+
+         Allocator::Deallocate(relocated);
+      }
+
+      WHEN("A small chunk is relocated to a bigger class") {
+         const auto entry = Allocator::Allocate(nullptr, Size);
+         for (Offset i = 0; i < Size; ++i)
+            entry->GetBlockStart()[i] = static_cast<Byte>(i);
+
+         const auto cached = SizeClasses::GetCachedCount(c);
+         const auto relocated = Allocator::Relocate(Size * 4, entry);
+
+         THEN("Contents are copied, and the previous chunk is cached") {
+            REQUIRE(relocated != entry);
+            REQUIRE(relocated->GetAllocatedSize() == Size * 4);
+            REQUIRE(SizeClasses::GetCachedCount(c) == cached + 1);
+            for (Offset i = 0; i < Size; ++i)
+               REQUIRE(relocated->GetBlockStart()[i] == static_cast<Byte>(i));
+         }
+
+         Allocator::Deallocate(relocated);
+      }
+   }
+
+   #ifdef LANGULUS_STD_BENCHMARK
+      BENCHMARK_ADVANCED("Anyness::Allocator::Allocate/Deallocate (small)") (timer meter) {
+         some<Allocation*> storage(meter.runs());
+         meter.measure([&](int i) {
+            storage[i] = Allocator::Allocate(nullptr, 16 + i % 256);
+            Allocator::Deallocate(storage[i]);
+         });
+      };
+
+      BENCHMARK_ADVANCED("std::malloc/std::free (small)") (timer meter) {
+         some<void*> storage(meter.runs());
+         meter.measure([&](int i) {
+            storage[i] = ::std::malloc(16 + i % 256);
+            ::std::free(storage[i]);
+         });
+      };
+
+      BENCHMARK_ADVANCED("Anyness::Allocator - text of small pieces") (timer meter) {
+         meter.measure([&](int i) {
+            Text text;
+            for (int j = 0; j < 64; ++j)
+               text += Text {i + j};
+            return text.GetCount();
+         });
+      };
+   #endif
+
+   REQUIRE(memoryState.Assert());
+}
+
+#endif
\ No newline at end of file
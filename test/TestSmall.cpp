@@ -0,0 +1,248 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Anyness/Text.hpp>
+#include <Anyness/Many.hpp>
+#include <Anyness/TMap.hpp>
+#include <stdexcept>
+#include "Common.hpp"
+
+
+SCENARIO("Small containers", "[small]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A small container of numbers") {
+      TSmallMany<int, 4> small;
+      TMany<int> many;
+      for (int i = 0; i < 3; ++i) {
+         small << i;
+         many << i;
+      }
+
+      REQUIRE(small.IsInline());
+      REQUIRE(small.GetCount() == 3);
+      REQUIRE(small.GetReserved() == 4);
+      REQUIRE(small.GetView() == many);
+      REQUIRE(small.GetHash() == many.GetHash());
+
+      WHEN("It grows beyond its inline capacity") {
+         for (int i = 3; i < 100; ++i) {
+            small << small[i - 3] + 3;
+            many << i;
+         }
+
+         REQUIRE_FALSE(small.IsInline());
+         REQUIRE(small.GetCount() == 100);
+         REQUIRE(small.GetView() == many);
+         REQUIRE(small.GetHash() == many.GetHash());
+         REQUIRE(static_cast<TMany<int>>(small) == many);
+
+         small.Reset();
+         REQUIRE(small.IsInline());
+         REQUIRE(small.IsEmpty());
+      }
+
+      WHEN("It is copied and moved") {
+         auto copied = small;
+         auto moved = ::std::move(small);
+
+         REQUIRE(copied.GetView() == many);
+         REQUIRE(moved.GetView() == many);
+         REQUIRE(small.IsEmpty());
+      }
+   }
+
+   GIVEN("A small container of texts") {
+      TSmallMany<Text, 2> small;
+      small << Text {"first"};
+      small << Text {"second"};
+      REQUIRE(small.IsInline());
+
+      WHEN("It grows beyond its inline capacity") {
+         small << small[0];
+         REQUIRE_FALSE(small.IsInline());
+         REQUIRE(small.GetCount() == 3);
+         REQUIRE(small[0] == "first");
+         REQUIRE(small[1] == "second");
+         REQUIRE(small[2] == "first");
+      }
+
+      WHEN("It is copied and moved") {
+         auto copied = small;
+         auto moved = ::std::move(copied);
+         REQUIRE(moved[1] == "second");
+         REQUIRE(copied.IsEmpty());
+      }
+
+      WHEN("It is assigned to a spilled container, and back") {
+         TSmallMany<Text, 2> spilled;
+         for (int i = 0; i < 10; ++i)
+            spilled << Text {i};
+         REQUIRE_FALSE(spilled.IsInline());
+
+         auto inlined = small;
+         inlined = spilled;
+         REQUIRE_FALSE(inlined.IsInline());
+         REQUIRE(inlined.GetView() == spilled.GetView());
+
+         spilled = small;
+         REQUIRE(spilled.IsInline());
+         REQUIRE(spilled.GetCount() == 2);
+         REQUIRE(spilled[0] == "first");
+         REQUIRE(spilled[1] == "second");
+         REQUIRE(small[0] == "first");
+      }
+   }
+
+   GIVEN("A map with text keys") {
+      TUnorderedMap<Text, int> map;
+      map.Insert(Text {"Name"}, 1);
+      map.Insert(Text {"A name that doesn't fit inline"}, 2);
+
+      WHEN("Searched with small texts") {
+         const SmallText name {"Name"};
+         const SmallText spilled {"A name that doesn't fit inline"};
+         const SmallText missing {"Nam"};
+         REQUIRE(name.IsInline());
+         REQUIRE_FALSE(spilled.IsInline());
+
+         THEN("The keys are found, as if searched with texts") {
+            REQUIRE(map.ContainsKey(name));
+            REQUIRE(map.ContainsKey(spilled));
+            REQUIRE_FALSE(map.ContainsKey(missing));
+            REQUIRE(map[name] == 1);
+            REQUIRE(map[spilled] == 2);
+            REQUIRE(map.ContainsKey(name.GetView()));
+            REQUIRE(map.Find(name) == map.Find(Text {"Name"}));
+         }
+      }
+   }
+
+   GIVEN("A short small text") {
+      SmallText small {"Name"};
+      const Text text {"Name"};
+
+      REQUIRE(small.IsInline());
+      REQUIRE(small.GetView() == text);
+      REQUIRE(HashOf(small) == HashOf(text));
+      REQUIRE(static_cast<Text>(small) == text);
+
+      WHEN("Letters are appended, until it spills") {
+         small += " that doesn't fit inside";
+         REQUIRE_FALSE(small.IsInline());
+         REQUIRE(small.GetView() == "Name that doesn't fit inside");
+         REQUIRE(HashOf(small) == HashOf(Text {"Name that doesn't fit inside"}));
+      }
+   }
+
+   #ifdef LANGULUS_STD_BENCHMARK
+      BENCHMARK_ADVANCED("Anyness::TMany<int> - four elements") (timer meter) {
+         meter.measure([&](int i) {
+            TMany<int> many;
+            for (int j = 0; j < 4; ++j)
+               many << i + j;
+            return many.GetCount();
+         });
+      };
+
+      BENCHMARK_ADVANCED("Anyness::TSmallMany<int, 4> - four elements") (timer meter) {
+         meter.measure([&](int i) {
+            TSmallMany<int, 4> small;
+            for (int j = 0; j < 4; ++j)
+               small << i + j;
+            return small.GetCount();
+         });
+      };
+   #endif
+
+   REQUIRE(memoryState.Assert());
+}
+
+/// An element, that can be made to throw when moved                          
+struct Fragile {
+   static inline bool sFail = false;
+   int mValue = 0;
+
+   Fragile() = default;
+   Fragile(int value) : mValue {value} {}
+   Fragile(const Fragile&) = default;
+   Fragile(Fragile&& other) : mValue {other.mValue} {
+      if (sFail)
+         throw ::std::runtime_error {"Fragile element moved"};
+   }
+
+   Fragile& operator = (const Fragile&) = default;
+   Fragile& operator = (Fragile&& other) {
+      if (sFail)
+         throw ::std::runtime_error {"Fragile element moved"};
+      mValue = other.mValue;
+      return *this;
+   }
+
+   bool operator == (const Fragile&) const = default;
+};
+
+SCENARIO("Small containers of elements, that may throw when moved", "[small]") {
+   static Allocator::State memoryState;
+
+   static_assert(::std::is_nothrow_move_constructible_v<TSmallMany<Text, 2>>);
+   static_assert(::std::is_nothrow_move_assignable_v<TSmallMany<Text, 2>>);
+   static_assert(not ::std::is_nothrow_move_constructible_v<TSmallMany<Fragile, 4>>);
+   static_assert(not ::std::is_nothrow_move_assignable_v<TSmallMany<Fragile, 4>>);
+
+   GIVEN("A full small container") {
+      TSmallMany<Fragile, 4> small;
+      for (int i = 0; i < 4; ++i)
+         small << Fragile {i};
+
+      WHEN("It spills, and moving an element throws") {
+         Fragile::sFail = true;
+         const Fragile extra {4};
+         REQUIRE_THROWS(small << extra);
+         Fragile::sFail = false;
+
+         REQUIRE(small.IsInline());
+         REQUIRE(small.GetCount() == 4);
+         for (int i = 0; i < 4; ++i)
+            REQUIRE(small[i].mValue == i);
+      }
+
+      WHEN("It is moved over another container, and moving an element throws") {
+         TSmallMany<Fragile, 4> other;
+         other << Fragile {9};
+
+         Fragile::sFail = true;
+         REQUIRE_THROWS(other = ::std::move(small));
+         Fragile::sFail = false;
+
+         REQUIRE(other.GetCount() == 1);
+         REQUIRE(other[0].mValue == 9);
+      }
+
+      WHEN("It is moved over containers with less and more elements") {
+         TSmallMany<Fragile, 4> shorter;
+         shorter << Fragile {9};
+         TSmallMany<Fragile, 4> longer;
+         for (int i = 0; i < 4; ++i)
+            longer << Fragile {i * 10};
+
+         shorter = ::std::move(small);
+         REQUIRE(shorter.IsInline());
+         REQUIRE(shorter.GetCount() == 4);
+         for (int i = 0; i < 4; ++i)
+            REQUIRE(shorter[i].mValue == i);
+
+         TSmallMany<Fragile, 4> single;
+         single << Fragile {7};
+         longer = ::std::move(single);
+         REQUIRE(longer.GetCount() == 1);
+         REQUIRE(longer[0].mValue == 7);
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
\ No newline at end of file
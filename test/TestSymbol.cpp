@@ -0,0 +1,108 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Anyness/Text.hpp>
+#include <Anyness/TMap.hpp>
+#include "Common.hpp"
+#include <thread>
+#include <vector>
+
+
+SCENARIO("Interning texts as symbols", "[symbol]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A symbol") {
+      const Symbol symbol {"Interned"};
+      const auto interned = Symbol::GetInternedCount();
+
+      REQUIRE(symbol.GetCount() == 8);
+      REQUIRE(symbol == Text {"Interned"});
+      REQUIRE(HashOf(symbol) == HashOf(Text {"Interned"}));
+      REQUIRE(static_cast<Text>(symbol) == "Interned");
+
+      WHEN("The same text is interned again") {
+         const Symbol same1 {Text {"Interned"}};
+         const Symbol same2 {Token {"Interned"}};
+
+         REQUIRE(same1 == symbol);
+         REQUIRE(same2 == symbol);
+         REQUIRE(same1.GetRaw() == symbol.GetRaw());
+         REQUIRE(Symbol::GetInternedCount() == interned);
+      }
+
+      WHEN("A different text is interned") {
+         const Symbol other {"Interned2"};
+
+         REQUIRE_FALSE(other == symbol);
+         REQUIRE(Symbol::GetInternedCount() == interned + 1);
+      }
+
+      WHEN("Symbols are used as map keys") {
+         TUnorderedMap<Symbol, int> map;
+         for (int i = 0; i < 100; ++i)
+            map.Insert(Symbol {Text {i}}, i);
+
+         REQUIRE(map.GetCount() == 100);
+         for (int i = 0; i < 100; ++i)
+            REQUIRE(map[Symbol {Text {i}}] == i);
+      }
+
+      WHEN("The same texts are interned from multiple threads") {
+         constexpr int Threads = 4;
+         constexpr int Texts = 1000;
+         std::vector<std::vector<Symbol>> symbols(Threads);
+         std::vector<std::thread> threads;
+         for (int t = 0; t < Threads; ++t) {
+            threads.emplace_back([&symbols, t] {
+               for (int i = 0; i < Texts; ++i) {
+                  const auto number = ::std::to_string(i * 7919);
+                  symbols[t].emplace_back(Token {number});
+               }
+            });
+         }
+
+         for (auto& thread : threads)
+            thread.join();
+
+         for (int t = 1; t < Threads; ++t) {
+            for (int i = 0; i < Texts; ++i)
+               REQUIRE(symbols[t][i].GetRaw() == symbols[0][i].GetRaw());
+         }
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         TUnorderedMap<Text, int> textMap;
+         TUnorderedMap<Symbol, int> symbolMap;
+         for (int i = 0; i < 1000; ++i) {
+            textMap.Insert(Text {"a rather long key, that repeats a lot #"} + Text {i}, i);
+            symbolMap.Insert(Symbol {Text {"a rather long key, that repeats a lot #"} + Text {i}}, i);
+         }
+
+         const Text textKey = Text {"a rather long key, that repeats a lot #"} + Text {500};
+         const Symbol symbolKey {textKey};
+
+         BENCHMARK("Anyness::TUnorderedMap<Text> - lookup") {
+            return textMap[textKey];
+         };
+
+         BENCHMARK("Anyness::TUnorderedMap<Symbol> - lookup") {
+            return symbolMap[symbolKey];
+         };
+      #endif
+   }
+
+   GIVEN("An empty symbol") {
+      const Symbol empty;
+
+      REQUIRE(empty.IsEmpty());
+      REQUIRE(empty == Symbol {""});
+      REQUIRE(empty == Symbol {Text {}});
+      REQUIRE(HashOf(empty) == HashOf(Text {}));
+   }
+
+   REQUIRE(memoryState.Assert());
+}
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <Anyness/Path.hpp>
 #include <Anyness/Trait.hpp>
 #include "Common.hpp"
+#include <vector>
 
 
 /// A type that is reflected, as convertible to Text                          
@@ -703,3 +704,296 @@ void Text_CheckState_DisownedFullConst(const Text& text) {
    REQUIRE_FALSE(text == "");
    REQUIRE_FALSE(text == "no match");
 }
+
+SCENARIO("Transforming text", "[text]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A text longer than a vector register") {
+      const Text text {"Some Mixed CASE text, with 123 digits!\nAnd @[`{ symbols\n"};
+
+      WHEN("Changed to lowercase") {
+         const auto lower = text.Lowercase();
+
+         REQUIRE(lower == "some mixed case text, with 123 digits!\nand @[`{ symbols\n");
+         REQUIRE(text == "Some Mixed CASE text, with 123 digits!\nAnd @[`{ symbols\n");
+      }
+
+      WHEN("Changed to uppercase") {
+         const auto upper = text.Uppercase();
+
+         REQUIRE(upper == "SOME MIXED CASE TEXT, WITH 123 DIGITS!\nAND @[`{ SYMBOLS\n");
+      }
+
+      WHEN("Lines are counted") {
+         REQUIRE(text.GetLineCount() == 3);
+         REQUIRE(Text {"single"}.GetLineCount() == 1);
+         REQUIRE(Text {}.GetLineCount() == 0);
+      }
+
+      WHEN("Stripped") {
+         const auto stripped = text.Strip(" ");
+
+         REQUIRE(stripped == "SomeMixedCASEtext,with123digits!\nAnd@[`{symbols\n");
+         REQUIRE(text.Strip("missing") == text);
+         REQUIRE(text.Strip(text).IsEmpty());
+      }
+
+      WHEN("Replaced with a longer text") {
+         const auto replaced = text.Replace("\n", "\r\n");
+
+         REQUIRE(replaced == "Some Mixed CASE text, with 123 digits!\r\nAnd @[`{ symbols\r\n");
+         REQUIRE(text.GetCount() + 2 == replaced.GetCount());
+      }
+
+      WHEN("Replaced with a shorter text, in place") {
+         Text unique = Clone(text);
+         const auto memory = unique.GetRaw();
+         const auto replaced = ::std::move(unique).Replace("text", "TX");
+
+         REQUIRE(replaced == "Some Mixed CASE TX, with 123 digits!\nAnd @[`{ symbols\n");
+         REQUIRE(replaced.GetRaw() == memory);
+      }
+
+      WHEN("Replaced in a shared text") {
+         Text shared = text;
+         const auto replaced = ::std::move(shared).Replace("Some", "A");
+
+         REQUIRE(replaced == "A Mixed CASE text, with 123 digits!\nAnd @[`{ symbols\n");
+         REQUIRE(text == "Some Mixed CASE text, with 123 digits!\nAnd @[`{ symbols\n");
+      }
+
+      WHEN("Overlapping patterns are replaced") {
+         const Text repeats {"aaaaaaaaaaaaaaaaaaaaa"};
+
+         REQUIRE(repeats.Replace("aa", "b") == "bbbbbbbbbba");
+         REQUIRE(Text {Clone(repeats)}.Strip("aaa").IsEmpty());
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+SCENARIO("UTF-8 text", "[text]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A valid UTF-8 text, with ASCII, two-byte and four-byte sequences") {
+      const Text text {"Hello, \xD0\xBC\xD0\xB8\xD1\x80! \xF0\x9F\x98\x80 and more ASCII text"};
+
+      REQUIRE(text.GetCount() == 39);
+      REQUIRE(text.IsValidUTF8());
+
+      WHEN("Codepoints are iterated") {
+         const auto codepoints = text.GetCodepoints();
+         ::std::vector<char32_t> decoded;
+         for (auto codepoint : codepoints)
+            decoded.push_back(codepoint);
+
+         REQUIRE(codepoints.GetCount() == 33);
+         REQUIRE(decoded.size() == 33);
+         REQUIRE(decoded[0] == U'H');
+         REQUIRE(decoded[7] == U'\x43C');
+         REQUIRE(decoded[9] == U'\x440');
+         REQUIRE(decoded[12] == U'\x1F600');
+         REQUIRE(decoded[32] == U't');
+      }
+
+      WHEN("Codepoints are selected") {
+         const auto codepoints = text.GetCodepoints();
+         const auto word = codepoints.Select(7, 3);
+         const auto smiley = codepoints.Select(12, 1);
+         const auto rest = codepoints.Select(14);
+
+         REQUIRE(word == "\xD0\xBC\xD0\xB8\xD1\x80");
+         REQUIRE(word.GetRaw() == text.GetRaw() + 7);
+         REQUIRE(smiley == "\xF0\x9F\x98\x80");
+         REQUIRE(rest == "and more ASCII text");
+         REQUIRE(codepoints.Select(30, 100) == "ext");
+         REQUIRE(text.GetUses() == 5);
+      }
+
+      WHEN("Widened to UTF-16") {
+         const auto wide = text.Widen16();
+
+         REQUIRE(wide.GetCount() == 34);
+         REQUIRE(wide[0] == u'H');
+         REQUIRE(wide[7] == u'\x43C');
+         REQUIRE(wide[12] == u'\xD83D');
+         REQUIRE(wide[13] == u'\xDE00');
+         REQUIRE(wide[33] == u't');
+      }
+
+      WHEN("Widened to UTF-32") {
+         const auto wide = text.Widen32();
+
+         REQUIRE(wide.GetCount() == 33);
+         REQUIRE(wide[0] == U'H');
+         REQUIRE(wide[12] == U'\x1F600');
+         REQUIRE(wide[32] == U't');
+      }
+
+      WHEN("Widened, and then narrowed back") {
+         REQUIRE(Text::Narrow(text.Widen16()) == text);
+         REQUIRE(Text::Narrow(text.Widen32()) == text);
+      }
+   }
+
+   GIVEN("UTF-16 and UTF-32 texts, with a long ASCII run") {
+      const ::std::u16string_view utf16 = u"\x43C\x438\x440 \xD83D\xDE00 and a long run of plain ASCII letters";
+      const ::std::u32string_view utf32 = U"\x43C\x438\x440 \x1F600 and a long run of plain ASCII letters";
+      const Text expected {"\xD0\xBC\xD0\xB8\xD1\x80 \xF0\x9F\x98\x80 and a long run of plain ASCII letters"};
+
+      WHEN("Narrowed to UTF-8") {
+         const auto narrow16 = Text::Narrow(utf16.data(), utf16.size());
+         const auto narrow32 = Text::Narrow(utf32.data(), utf32.size());
+
+         REQUIRE(narrow16 == expected);
+         REQUIRE(narrow32 == expected);
+         REQUIRE(narrow16.IsValidUTF8());
+         REQUIRE(narrow16.Widen16().GetCount() == utf16.size());
+         REQUIRE(narrow32.Widen32().GetCount() == utf32.size());
+         REQUIRE(Text::Narrow(u"", 0).IsEmpty());
+      }
+   }
+
+   GIVEN("Invalid UTF-16 and UTF-32 texts") {
+      const char16_t unpairedHigh[] = {u'a', 0xD83D, u'b'};
+      const char16_t unpairedLow[] = {u'a', 0xDE00, u'b'};
+      const char16_t truncated[] = {u'a', 0xD83D};
+      const char32_t surrogate[] = {U'a', 0xD800};
+      const char32_t outOfRange[] = {U'a', 0x110000};
+
+      REQUIRE_THROWS(Text::Narrow(unpairedHigh, 3));
+      REQUIRE_THROWS(Text::Narrow(unpairedLow, 3));
+      REQUIRE_THROWS(Text::Narrow(truncated, 2));
+      REQUIRE_THROWS(Text::Narrow(surrogate, 2));
+      REQUIRE_THROWS(Text::Narrow(outOfRange, 2));
+   }
+
+   GIVEN("Invalid UTF-8 texts") {
+      const Text overlong {"overlong \xC0\xAF slash"};
+      const Text surrogate {"surrogate \xED\xA0\x80"};
+      const Text truncated {"truncated \xF0\x9F\x98"};
+      const Text stray {"stray \x80 continuation"};
+
+      REQUIRE_FALSE(overlong.IsValidUTF8());
+      REQUIRE_FALSE(surrogate.IsValidUTF8());
+      REQUIRE_FALSE(truncated.IsValidUTF8());
+      REQUIRE_FALSE(stray.IsValidUTF8());
+      REQUIRE_THROWS(overlong.GetCodepoints());
+      REQUIRE_THROWS(truncated.Widen16());
+      REQUIRE_THROWS(stray.Widen32());
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+SCENARIO("Building large texts in chunks", "[text]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A text builder") {
+      TextBuilder builder;
+
+      REQUIRE(builder.IsEmpty());
+      REQUIRE(builder.GetChunkCount() == 0);
+
+      WHEN("Many short texts are appended") {
+         Text expected;
+         for (int i = 0; i < 20000; ++i) {
+            builder += "line ";
+            builder += i;
+            builder += '\n';
+            expected += "line ";
+            expected += i;
+            expected += '\n';
+         }
+
+         Text streamed;
+         bool bounded = true;
+         builder.ForEachChunk([&](const Text& chunk) {
+            bounded = bounded and chunk.GetCount() <= TextBuilder::ChunkSize;
+            streamed += chunk;
+         });
+
+         REQUIRE(builder.GetCount() == expected.GetCount());
+         REQUIRE(builder.GetChunkCount() > 1);
+         REQUIRE(bounded);
+         REQUIRE(streamed == expected);
+         REQUIRE(builder.Join() == expected);
+      }
+
+      WHEN("A long text is appended") {
+         Text big;
+         ::std::memset(big.Extend(TextBuilder::ChunkSize).GetRaw(), 'x', TextBuilder::ChunkSize);
+
+         builder += "head";
+         builder += big;
+         builder += "tail";
+
+         ::std::vector<const Letter*> chunks;
+         builder.ForEachChunk([&](const Text& chunk) {
+            chunks.push_back(chunk.GetRaw());
+         });
+
+         REQUIRE(builder.GetCount() == TextBuilder::ChunkSize + 8);
+         REQUIRE(chunks.size() == 3);
+         REQUIRE(chunks[1] == big.GetRaw());
+
+         const auto flat = builder.Join();
+         REQUIRE(flat.GetCount() == TextBuilder::ChunkSize + 8);
+         REQUIRE(flat.Select(0, 5) == "headx");
+         REQUIRE(flat.Select(TextBuilder::ChunkSize + 3) == "xtail");
+      }
+
+      WHEN("A short text is appended") {
+         builder += "short";
+
+         Count reserved = 0;
+         builder.ForEachChunk([&](const Text& chunk) {
+            reserved += chunk.GetReserved();
+         });
+
+         THEN("The first chunk is small") {
+            REQUIRE(builder.GetChunkCount() == 1);
+            REQUIRE(reserved >= 5);
+            REQUIRE(reserved < TextBuilder::ChunkSize);
+            REQUIRE(builder.Join() == "short");
+         }
+      }
+
+      WHEN("Used as a serializer") {
+         TMany<int> data;
+         for (int i = 0; i < 50000; ++i)
+            data << i;
+
+         Text text;
+         data.Serialize(text);
+         data.Serialize(builder);
+
+         REQUIRE(text.GetCount() > TextBuilder::ChunkSize * 2);
+         REQUIRE(builder.GetCount() == text.GetCount());
+         REQUIRE(builder.GetChunkCount() > 2);
+         REQUIRE(builder.Join() == text);
+      }
+
+      WHEN("Appended to itself") {
+         for (int i = 0; i < 20000; ++i)
+            builder += "some text ";
+         const auto once = builder.Join();
+         builder += builder;
+
+         REQUIRE(builder.GetCount() == once.GetCount() * 2);
+         REQUIRE(builder.Join() == once + once);
+      }
+
+      WHEN("Cleared") {
+         for (int i = 0; i < 20000; ++i)
+            builder += "some text ";
+         builder.Clear();
+
+         REQUIRE(builder.IsEmpty());
+         REQUIRE(builder.GetChunkCount() == 0);
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
@@ -135,5 +135,222 @@ SCENARIO("Pushing one sparse container, and then two more, one being the first",
       DestroyElement<true>(p2);
    #endif
 
+   REQUIRE(memoryState.Assert());
+}
+
+/// Containers of plain data may grow by extending their allocation in place, 
+/// instead of moving elements, so these make sure contents survive growth    
+SCENARIO("Growing containers of plain data one element at a time", "[many]") {
+   static Allocator::State memoryState;
+   constexpr int Elements = 10000;
+
+   GIVEN("A typed, a type-erased container, and a text") {
+      TMany<int> typed;
+      Many erased;
+      Text text;
+
+      WHEN("Elements are pushed one by one") {
+         for (int i = 0; i < Elements; ++i) {
+            typed << i;
+            erased << i;
+            text << static_cast<Letter>('a' + i % 26);
+         }
+
+         THEN("All elements are retained in order") {
+            REQUIRE(typed.GetCount() == static_cast<Count>(Elements));
+            REQUIRE(erased.GetCount() == static_cast<Count>(Elements));
+            REQUIRE(text.GetCount() == static_cast<Count>(Elements));
+            REQUIRE(typed.GetUses() == 1);
+            REQUIRE(erased.GetUses() == 1);
+
+            for (int i = 0; i < Elements; ++i) {
+               REQUIRE(typed[i] == i);
+               REQUIRE(erased.As<int>(i) == i);
+               REQUIRE(text[i] == static_cast<Letter>('a' + i % 26));
+            }
+         }
+
+         THEN("Text remains null-terminated") {
+            const auto terminated = text.Terminate();
+            REQUIRE(terminated.GetRaw()[Elements] == '\0');
+            REQUIRE(terminated.GetRaw()[Elements - 1] == text[Elements - 1]);
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+/// Containers are trivially relocatable, so containers of containers grow    
+/// by copying them bytewise - these make sure no element is lost or leaked   
+SCENARIO("Growing containers of containers", "[many]") {
+   static Allocator::State memoryState;
+   constexpr int Elements = 1000;
+
+   static_assert(CT::Relocatable<Many, TMany<Many>, Text, Trait, int, Many*>);
+   static_assert(CT::Relocatable<Traits::Name, TMany<Text>, Own<Text>>);
+
+   GIVEN("A typed and a type-erased container of texts") {
+      TMany<Text> typed;
+      Many erased;
+
+      WHEN("Texts are pushed one by one") {
+         for (int i = 0; i < Elements; ++i) {
+            typed << Text {i};
+            erased << Text {i};
+         }
+
+         THEN("All texts are retained in order, each used only once") {
+            REQUIRE(typed.GetCount() == static_cast<Count>(Elements));
+            REQUIRE(erased.GetCount() == static_cast<Count>(Elements));
+
+            for (int i = 0; i < Elements; ++i) {
+               REQUIRE(typed[i] == Text {i});
+               REQUIRE(typed[i].GetUses() == 1);
+               REQUIRE(erased.As<Text>(i) == Text {i});
+               REQUIRE(erased.As<Text>(i).GetUses() == 1);
+            }
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+/// A container, that points inside itself, so it can't be moved bytewise     
+struct SelfAware : Many {
+   LANGULUS_BASES(Many);
+
+   SelfAware* mSelf = this;
+
+   SelfAware() = default;
+   SelfAware(const SelfAware& other) : Many {other} {}
+   SelfAware(SelfAware&& other) noexcept : Many {Move(other)} {}
+
+   SelfAware& operator = (const SelfAware& other) {
+      Many::operator = (other);
+      return *this;
+   }
+
+   SelfAware& operator = (SelfAware&& other) noexcept {
+      Many::operator = (Move(other));
+      return *this;
+   }
+};
+
+/// Only the concrete containers are tagged as relocatable, so types derived  
+/// from them must opt in explicitly, and are moved one by one otherwise      
+SCENARIO("Relocatability isn't inherited by types derived from containers", "[many]") {
+   static Allocator::State memoryState;
+   constexpr int Elements = 100;
+
+   static_assert(not CT::Relocatable<SelfAware>);
+   static_assert(not CT::Relocatable<Own<SelfAware>>);
+
+   GIVEN("A typed and a type-erased container of self-aware containers") {
+      TMany<SelfAware> typed;
+      auto erased = Many::From<SelfAware>();
+
+      THEN("Neither of them is considered relocatable") {
+         REQUIRE_FALSE(typed.IsRelocatable());
+         REQUIRE_FALSE(erased.IsRelocatable());
+         REQUIRE(Many::From<Many>().IsRelocatable());
+         REQUIRE(Many::From<Text>().IsRelocatable());
+      }
+
+      WHEN("Elements are pushed one by one") {
+         for (int i = 0; i < Elements; ++i) {
+            typed << SelfAware {};
+            erased << SelfAware {};
+         }
+
+         THEN("Each element still points to itself") {
+            REQUIRE(typed.GetCount() == static_cast<Count>(Elements));
+            REQUIRE(erased.GetCount() == static_cast<Count>(Elements));
+
+            for (int i = 0; i < Elements; ++i) {
+               REQUIRE(typed[i].mSelf == &typed[i]);
+               REQUIRE(erased.As<SelfAware>(i).mSelf == &erased.As<SelfAware>(i));
+            }
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+/// A selection may outlive its source and become the sole owner of memory,   
+/// that it doesn't start at - growing it must not relocate the allocation    
+SCENARIO("Growing a selection, after its source has been reset", "[many]") {
+   static Allocator::State memoryState;
+   constexpr int Elements = 100;
+
+   GIVEN("Selections in the middle of typed, type-erased and text containers") {
+      TMany<int> typed;
+      Many erased;
+      Text text = "abcdef";
+      for (int i = 1; i <= 6; ++i) {
+         typed << i;
+         erased << i;
+      }
+
+      auto typedView = typed.Select(2, 2);
+      auto erasedView = erased.Select(2, 2);
+      auto textView = text.Select(2, 2);
+
+      WHEN("Sources are reset, and the selections are grown") {
+         typed.Reset();
+         erased.Reset();
+         text.Reset();
+
+         REQUIRE(typedView.GetUses() == 1);
+         REQUIRE(erasedView.GetUses() == 1);
+         REQUIRE(textView.GetUses() == 1);
+
+         for (int i = 0; i < Elements; ++i) {
+            typedView << i;
+            erasedView << i;
+            textView << static_cast<Letter>('a' + i % 26);
+         }
+
+         THEN("The selected elements are retained in front") {
+            REQUIRE(typedView.GetCount() == static_cast<Count>(Elements + 2));
+            REQUIRE(erasedView.GetCount() == static_cast<Count>(Elements + 2));
+            REQUIRE(textView.GetCount() == static_cast<Count>(Elements + 2));
+
+            REQUIRE(typedView[0] == 3);
+            REQUIRE(typedView[1] == 4);
+            REQUIRE(erasedView.As<int>(0) == 3);
+            REQUIRE(erasedView.As<int>(1) == 4);
+            REQUIRE(textView[0] == 'c');
+            REQUIRE(textView[1] == 'd');
+
+            for (int i = 0; i < Elements; ++i) {
+               REQUIRE(typedView[i + 2] == i);
+               REQUIRE(erasedView.As<int>(i + 2) == i);
+               REQUIRE(textView[i + 2] == static_cast<Letter>('a' + i % 26));
+            }
+         }
+
+         THEN("The text selection can be null-terminated") {
+            const auto terminated = textView.Terminate();
+            REQUIRE(terminated.GetRaw()[Elements + 2] == '\0');
+            REQUIRE(terminated.GetRaw()[0] == 'c');
+         }
+      }
+
+      WHEN("The text source is reset, and the selection is terminated") {
+         text.Reset();
+         const auto terminated = textView.Terminate();
+
+         THEN("Only the selected letters are terminated") {
+            REQUIRE(terminated.GetCount() == 2);
+            REQUIRE(terminated.GetRaw()[0] == 'c');
+            REQUIRE(terminated.GetRaw()[1] == 'd');
+            REQUIRE(terminated.GetRaw()[2] == '\0');
+         }
+      }
+   }
+
    REQUIRE(memoryState.Assert());
 }
\ No newline at end of file
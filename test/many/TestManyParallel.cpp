@@ -0,0 +1,144 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestManyCommon.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+
+TEMPLATE_TEST_CASE("Parallel algorithms", "[many][parallel]",
+   int, double
+) {
+   static Allocator::State memoryState;
+
+   using T = TestType;
+
+   // The small count runs serially, the big ones are split in chunks   
+   for (int count : {100, 100000, 1000003}) {
+      std::mt19937 rng {static_cast<unsigned>(count)};
+      std::vector<T> input (count);
+      for (auto& i : input)
+         i = static_cast<T>(static_cast<int>(rng() % 20001) - 10000);
+
+      GIVEN(std::to_string(count) + " elements") {
+         TMany<T> pack;
+         pack.Reserve(count);
+         for (auto& i : input)
+            pack << i;
+
+         WHEN("Iterated in parallel") {
+            const auto done = pack.ParallelForEach([](T& element) {
+               element *= 2;
+            });
+
+            REQUIRE(done == static_cast<Count>(count));
+            for (int i = 0; i < count; ++i)
+               REQUIRE(pack[i] == input[i] * 2);
+         }
+
+         WHEN("Iterated in parallel as a type-erased container") {
+            Many erased = pack;
+            std::atomic<Count> visited = 0;
+            const auto done = erased.ParallelForEach([&](const T&) {
+               ++visited;
+            });
+
+            REQUIRE(done == static_cast<Count>(count));
+            REQUIRE(visited == static_cast<Count>(count));
+         }
+
+         WHEN("Reduced in parallel") {
+            const auto sum = pack.Reduce(T {5}, [](T lhs, const T& rhs) {
+               return lhs + rhs;
+            });
+            const auto biggest = pack.Reduce(input[0], [](T lhs, const T& rhs) {
+               return std::max(lhs, rhs);
+            });
+
+            REQUIRE(sum == std::accumulate(input.begin(), input.end(), T {5}));
+            REQUIRE(biggest == *std::max_element(input.begin(), input.end()));
+         }
+
+         WHEN("Transformed in parallel") {
+            TMany<double> halves;
+            halves << 0.5;
+            pack.TransformInto(halves, [](const T& element) {
+               return element / 2;
+            });
+
+            Many erased;
+            pack.TransformInto(erased, [](const T& element) {
+               return element * 3;
+            });
+
+            REQUIRE(halves.GetCount() == static_cast<Count>(count + 1));
+            REQUIRE(halves[0] == 0.5);
+            for (int i = 0; i < count; ++i)
+               REQUIRE(halves[i + 1] == static_cast<double>(input[i] / 2));
+
+            REQUIRE(erased.GetCount() == static_cast<Count>(count));
+            REQUIRE(erased.template IsExact<T>());
+            for (int i = 0; i < count; ++i)
+               REQUIRE(erased.template As<T>(i) == input[i] * 3);
+         }
+
+         WHEN("Sorted in parallel") {
+            pack.template ParallelSort<true>();
+
+            auto expected = input;
+            std::sort(expected.begin(), expected.end());
+            for (int i = 0; i < count; ++i)
+               REQUIRE(pack[i] == expected[i]);
+         }
+
+         WHEN("Searched in parallel") {
+            const auto needle = input[count * 3 / 4];
+            const auto expected = std::find(input.begin(), input.end(), needle) - input.begin();
+
+            REQUIRE(pack.ParallelFind(needle) == expected);
+            REQUIRE(pack.ParallelFind(T {20000}) == IndexNone);
+         }
+
+         #ifdef LANGULUS_STD_BENCHMARK
+            BENCHMARK_ADVANCED("TMany::Sort") (timer meter) {
+               some<TMany<T>> storage(meter.runs());
+               for (auto& s : storage)
+                  s = pack;
+               meter.measure([&](int i) {
+                  storage[i].template Sort<true>();
+               });
+            };
+
+            BENCHMARK_ADVANCED("TMany::ParallelSort") (timer meter) {
+               some<TMany<T>> storage(meter.runs());
+               for (auto& s : storage)
+                  s = pack;
+               meter.measure([&](int i) {
+                  storage[i].template ParallelSort<true>();
+               });
+            };
+
+            BENCHMARK_ADVANCED("TMany::Reduce") (timer meter) {
+               meter.measure([&] {
+                  return pack.Reduce(T {0}, [](T lhs, const T& rhs) {
+                     return lhs + rhs;
+                  });
+               });
+            };
+
+            BENCHMARK_ADVANCED("std::accumulate") (timer meter) {
+               meter.measure([&] {
+                  return std::accumulate(input.begin(), input.end(), T {0});
+               });
+            };
+         #endif
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
@@ -0,0 +1,89 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestManyCommon.hpp"
+
+
+TEMPLATE_TEST_CASE("Searching and matching in POD containers", "[many][search]",
+   std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, char
+) {
+   static Allocator::State memoryState;
+
+   using T = TestType;
+
+   // Test around the boundaries of vectorized chunks                   
+   for (int count : {1, 7, 15, 16, 17, 33, 100}) {
+      GIVEN(std::to_string(count) + " distinct elements") {
+         TMany<T> pack;
+         for (int i = 0; i < count; ++i)
+            pack << static_cast<T>(i + 1);
+         Many erased = pack;
+
+         WHEN("Each element is searched for") {
+            for (int i = 0; i < count; ++i) {
+               const auto item = static_cast<T>(i + 1);
+               REQUIRE(pack.Find(item) == i);
+               REQUIRE(pack.template Find<true>(item) == i);
+               REQUIRE(erased.Find(item) == i);
+               REQUIRE(erased.template Find<true>(item) == i);
+            }
+
+            REQUIRE(pack.Find(T {0}) == IndexNone);
+            REQUIRE(erased.Find(T {0}) == IndexNone);
+         }
+
+         WHEN("Searched from a cookie") {
+            const auto last = static_cast<T>(count);
+            REQUIRE(pack.Find(last, count - 1) == count - 1);
+            REQUIRE(pack.Find(T {1}, 1) == IndexNone);
+            REQUIRE(erased.Find(last, count - 1) == count - 1);
+            REQUIRE(erased.Find(T {1}, 1) == IndexNone);
+         }
+
+         WHEN("Matched against a partially different container") {
+            for (int i = 0; i < count; ++i) {
+               TMany<T> other = pack;
+               other.template As<T>(i) = T {0};
+               REQUIRE(pack.Matches(other) == static_cast<Count>(i));
+               REQUIRE(erased.Matches(other) == static_cast<Count>(i));
+            }
+
+            REQUIRE(pack.Matches(pack) == static_cast<Count>(count));
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+SCENARIO("Loosely matching texts", "[text][search]") {
+   static Allocator::State memoryState;
+
+   GIVEN("Two long texts, differing only by case") {
+      Text lhs = "The Quick Brown Fox Jumps Over The Lazy Dog, 0123456789!";
+      Text rhs = "tHE qUICK bROWN fOX jUMPS oVER tHE lAZY dOG, 0123456789!";
+
+      THEN("They match loosely, but not exactly") {
+         REQUIRE(lhs.MatchesLoose(rhs) == lhs.GetCount());
+         REQUIRE(lhs.CompareLoose(rhs));
+         REQUIRE(lhs.Matches(rhs) == 0);
+      }
+
+      THEN("Symbols that differ by 0x20 are not considered letters") {
+         Text a = "AAAAAAAAAAAAAAAAAAAA@";
+         Text b = "aaaaaaaaaaaaaaaaaaaa`";
+         REQUIRE(a.MatchesLoose(b) == a.GetCount() - 1);
+      }
+
+      THEN("Matching stops at the shorter text") {
+         Text shorter = "the quick brown fox";
+         REQUIRE(lhs.MatchesLoose(shorter) == shorter.GetCount());
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
@@ -0,0 +1,168 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestManyCommon.hpp"
+#include <algorithm>
+#include <random>
+
+
+/// Generate a deterministic sequence of pseudo-random numbers                
+template<class T>
+std::vector<T> GenerateSortInput(int count) {
+   std::mt19937 rng {static_cast<unsigned>(count)};
+   std::vector<T> result;
+   result.reserve(count);
+   for (int i = 0; i < count; ++i) {
+      if constexpr (CT::Real<T>)
+         result.push_back(static_cast<T>(rng() % 2001) / T {8} - T {125});
+      else if constexpr (CT::Signed<T>)
+         result.push_back(static_cast<T>(static_cast<int>(rng() % 201) - 100));
+      else
+         result.push_back(static_cast<T>(rng() % 201));
+   }
+   return result;
+}
+
+TEMPLATE_TEST_CASE("Sorting containers", "[many][sort]",
+   int, unsigned, float, double, std::int64_t, std::uint8_t
+) {
+   static Allocator::State memoryState;
+
+   using T = TestType;
+
+   // Small counts go through pdqsort, the big one through radix sort   
+   for (int count : {0, 1, 2, 13, 100, 1000}) {
+      const auto input = GenerateSortInput<T>(count);
+
+      GIVEN(std::to_string(count) + " unsorted elements") {
+         TMany<T> pack;
+         for (auto& i : input)
+            pack << i;
+
+         WHEN("Sorted in ascending order") {
+            pack.template Sort<true>();
+
+            auto expected = input;
+            std::sort(expected.begin(), expected.end());
+
+            REQUIRE(pack.GetCount() == expected.size());
+            for (int i = 0; i < count; ++i)
+               REQUIRE(pack[i] == expected[i]);
+         }
+
+         WHEN("Sorted in descending order") {
+            pack.template Sort<false>();
+
+            auto expected = input;
+            std::sort(expected.begin(), expected.end(), std::greater<T> {});
+
+            REQUIRE(pack.GetCount() == expected.size());
+            for (int i = 0; i < count; ++i)
+               REQUIRE(pack[i] == expected[i]);
+         }
+
+         WHEN("Sorted as a type-erased container") {
+            Many erased = pack;
+            erased.template Sort<true>();
+
+            auto expected = input;
+            std::sort(expected.begin(), expected.end());
+
+            REQUIRE(erased.GetCount() == expected.size());
+            REQUIRE(erased.template IsExact<T>());
+            for (int i = 0; i < count; ++i)
+               REQUIRE(erased.template As<T>(i) == expected[i]);
+         }
+
+         WHEN("Sorting a shared container") {
+            auto shared = pack;
+            pack.template Sort<true>();
+
+            REQUIRE(shared.GetCount() == pack.GetCount());
+            for (int i = 0; i < count; ++i)
+               REQUIRE(shared[i] == input[i]);
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+SCENARIO("Sorting with a custom comparator", "[many][sort]") {
+   static Allocator::State memoryState;
+
+   GIVEN("A container of texts") {
+      TMany<Text> pack {"delta", "alpha", "charlie", "bravo", "alpha"};
+
+      WHEN("Sorted by length, keeping order of equal elements") {
+         pack.SortWith<true>([](const Text& lhs, const Text& rhs) {
+            return lhs.GetCount() < rhs.GetCount();
+         });
+
+         REQUIRE(pack.GetCount() == 5);
+         REQUIRE(pack[0] == "delta");
+         REQUIRE(pack[1] == "alpha");
+         REQUIRE(pack[2] == "bravo");
+         REQUIRE(pack[3] == "alpha");
+         REQUIRE(pack[4] == "charlie");
+      }
+
+      WHEN("Stable sorted as a type-erased container") {
+         Many erased = pack;
+         erased.SortWith<true>([](const Block<>& lhs, const Block<>& rhs) {
+            return lhs.As<Text>().GetCount() < rhs.As<Text>().GetCount();
+         });
+
+         REQUIRE(erased.GetCount() == 5);
+         REQUIRE(erased.As<Text>(0) == "delta");
+         REQUIRE(erased.As<Text>(1) == "alpha");
+         REQUIRE(erased.As<Text>(2) == "bravo");
+         REQUIRE(erased.As<Text>(3) == "alpha");
+         REQUIRE(erased.As<Text>(4) == "charlie");
+      }
+
+      WHEN("Sorted as a type-erased container, without a comparator") {
+         // Texts have no reflected ordering, so SortWith is required   
+         Many erased = pack;
+         REQUIRE_THROWS_AS(erased.Sort(), Except::Compare);
+         REQUIRE_THROWS_AS((erased.Sort<true, true>()), Except::Compare);
+
+         REQUIRE(erased.GetCount() == 5);
+         REQUIRE(erased.As<Text>(0) == "delta");
+         REQUIRE(erased.As<Text>(4) == "alpha");
+      }
+   }
+
+   GIVEN("A container of pairs of integers") {
+      using P = std::pair<int, int>;
+      std::vector<P> input;
+      for (int i = 0; i < 500; ++i)
+         input.push_back({(i * 7919) % 10, i});
+
+      TMany<P> pack;
+      for (auto& i : input)
+         pack << i;
+
+      WHEN("Stable sorted by first element") {
+         pack.SortWith<true>([](const P& lhs, const P& rhs) {
+            return lhs.first < rhs.first;
+         });
+
+         auto expected = input;
+         std::stable_sort(expected.begin(), expected.end(),
+            [](const P& lhs, const P& rhs) {
+               return lhs.first < rhs.first;
+            });
+
+         REQUIRE(pack.GetCount() == expected.size());
+         for (int i = 0; i < 500; ++i)
+            REQUIRE(pack[i] == expected[i]);
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
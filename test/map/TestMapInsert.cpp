@@ -0,0 +1,313 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestMapCommon.hpp"
+#include <vector>
+
+
+/// Type-erased maps insert statically typed keys and values as if they were  
+/// typed maps, instead of wrapping each argument in a temporary Many, so     
+/// these make sure both ways of insertion produce the same maps              
+TEMPLATE_TEST_CASE("Map insertion of statically typed pairs", "[map][insert]",
+   (MapTest<UnorderedMap, int, Text>),
+   (MapTest<OrderedMap, int, Text>),
+   (MapTest<UnorderedMap, Text, int>),
+   (MapTest<OrderedMap, Text, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   using K = typename TestType::Key;
+   using V = typename TestType::Value;
+   using TT = TMap<K, V, T::Ordered>;
+   constexpr int Pairs = 1000;
+
+   static_assert(CT::LocalHandleable<K, V>);
+
+   GIVEN("A type-erased and a typed map, filled with the same pairs") {
+      T map;
+      TT typed;
+      for (int i = 0; i < Pairs; ++i) {
+         if constexpr (CT::Same<K, int>) {
+            map.Insert(i * 7, Text {i});
+            typed.Insert(i * 7, Text {i});
+         }
+         else {
+            map.Insert(Text {i * 7}, i);
+            typed.Insert(Text {i * 7}, i);
+         }
+      }
+
+      Map_Helper_TestType<K, V>(map);
+      REQUIRE(map.GetCount() == static_cast<Count>(Pairs));
+      REQUIRE(map == typed);
+
+      WHEN("Values of existing keys are overwritten") {
+         for (int i = 0; i < Pairs; i += 2) {
+            if constexpr (CT::Same<K, int>)
+               map.Insert(i * 7, Text {-i});
+            else
+               map.Insert(Text {i * 7}, -i);
+         }
+
+         REQUIRE(map.GetCount() == static_cast<Count>(Pairs));
+
+         for (int i = 0; i < Pairs; ++i) {
+            const int v = i % 2 ? i : -i;
+            if constexpr (CT::Same<K, int>)
+               REQUIRE(map[i * 7] == Text {v});
+            else
+               REQUIRE(map[Text {i * 7}] == v);
+         }
+      }
+
+      WHEN("Pairs are moved in") {
+         for (int i = Pairs; i < Pairs * 2; ++i) {
+            if constexpr (CT::Same<K, int>) {
+               Text value {i};
+               map.Insert(i * 7, ::std::move(value));
+               typed.Insert(i * 7, Text {i});
+            }
+            else {
+               Text key {i * 7};
+               map.Insert(::std::move(key), i);
+               typed.Insert(Text {i * 7}, i);
+            }
+         }
+
+         REQUIRE(map.GetCount() == static_cast<Count>(Pairs * 2));
+         REQUIRE(map == typed);
+      }
+
+      WHEN("The type-erased map is searched with statically typed keys") {
+         for (int i = 0; i < Pairs * 7; ++i) {
+            if constexpr (CT::Same<K, int>)
+               REQUIRE(map.ContainsKey(i) == typed.ContainsKey(i));
+            else
+               REQUIRE(map.ContainsKey(Text {i}) == typed.ContainsKey(Text {i}));
+         }
+
+         REQUIRE(map.ContainsKey(K {7}));
+         REQUIRE_FALSE(map.ContainsKey(K {8}));
+      }
+
+      #if not LANGULUS_FEATURE(MANAGED_MEMORY)
+      WHEN("Pairs are inserted, after memory has been reserved") {
+         // Anything that allocates while inserting comes from the arena
+         TMany<Text> texts;
+         for (int i = Pairs; i < Pairs * 2; ++i)
+            texts << Text {i * 7};
+         map.Reserve(Pairs * 4);
+
+         Arena arena;
+         for (int i = Pairs; i < Pairs * 2; ++i) {
+            if constexpr (CT::Same<K, int>)
+               map.Insert(i * 7, ::std::move(texts[i - Pairs]));
+            else
+               map.Insert(::std::move(texts[i - Pairs]), i * 7);
+         }
+
+         REQUIRE(arena.IsEmpty());
+         REQUIRE(map.GetCount() == static_cast<Count>(Pairs * 2));
+      }
+      #endif
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("Anyness::map::Insert (type-erased)") (timer meter) {
+            some<T> storage(meter.runs());
+
+            meter.measure([&](int i) {
+               auto& m = storage[i];
+               for (int j = 0; j < 100; ++j) {
+                  if constexpr (CT::Same<K, int>)
+                     m.Insert(j, Text {});
+                  else
+                     m.Insert(Text {j}, j);
+               }
+               return m.GetCount();
+            });
+         };
+
+         BENCHMARK_ADVANCED("Anyness::map::Insert (typed)") (timer meter) {
+            some<TT> storage(meter.runs());
+
+            meter.measure([&](int i) {
+               auto& m = storage[i];
+               for (int j = 0; j < 100; ++j) {
+                  if constexpr (CT::Same<K, int>)
+                     m.Insert(j, Text {});
+                  else
+                     m.Insert(Text {j}, j);
+               }
+               return m.GetCount();
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+#if not LANGULUS_FEATURE(MANAGED_MEMORY)
+/// Pointers aren't inserted as if the map was typed, so this makes sure that 
+/// the inserted pair, and all the robin-hood swaps, are kept on the stack    
+SCENARIO("Type-erased map insertion of pointers", "[map][insert]") {
+   static Allocator::State memoryState;
+   constexpr int Pairs = 1000;
+
+   GIVEN("A type-erased map with sparse values, and reserved memory") {
+      TMany<Text> texts;
+      for (int i = 0; i < Pairs; ++i)
+         texts << Text {i};
+
+      TUnorderedMap<int, Text*> typed;
+      typed.Insert(-1, &texts[0]);
+      for (int i = 0; i < Pairs; ++i)
+         typed.Insert(i * 7, &texts[i]);
+
+      UnorderedMap map;
+      map.Insert(-1, &texts[0]);
+      map.Reserve(Pairs * 4);
+
+      WHEN("Pairs are inserted") {
+         // Anything that allocates while inserting comes from the arena
+         Arena arena;
+         for (int i = 0; i < Pairs; ++i)
+            map.Insert(i * 7, &texts[i]);
+
+         REQUIRE(arena.IsEmpty());
+         REQUIRE(map.GetCount() == static_cast<Count>(Pairs + 1));
+         REQUIRE(map == typed);
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+#endif
+
+/// Inserting blocks of keys and values reserves only once, and places pairs  
+/// in batches, so these make sure the results match inserting one by one     
+TEMPLATE_TEST_CASE("Map insertion of key and value blocks", "[map][insert]",
+   (MapTest<TUnorderedMap<int, int>, int, int>),
+   (MapTest<TOrderedMap<int, int>, int, int>),
+   (MapTest<UnorderedMap, int, int>),
+   (MapTest<OrderedMap, int, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   constexpr int Pairs = 10000;
+
+   GIVEN("Blocks of keys and values, where keys repeat") {
+      TMany<int> keys, vals;
+      std::unordered_map<int, int> mapStd;
+      std::vector<int> order;
+      for (int i = 0; i < Pairs; ++i) {
+         const int key = (i * 7919) % 5003;
+         keys << key;
+         vals << i;
+         if (not mapStd.contains(key))
+            order.push_back(key);
+         mapStd.insert_or_assign(key, i);
+      }
+
+      WHEN("Inserted into an empty map") {
+         T map;
+         REQUIRE(map.InsertBlock(keys, vals) == static_cast<Count>(Pairs));
+         REQUIRE(map.GetCount() == static_cast<Count>(mapStd.size()));
+
+         for (auto& [key, val] : mapStd)
+            REQUIRE(map[key] == val);
+
+         if constexpr (T::Ordered) {
+            std::vector<int> iterated;
+            map.ForEachKey([&](const int& key) {
+               iterated.push_back(key);
+            });
+            REQUIRE(iterated == order);
+         }
+      }
+
+      WHEN("Inserted into a map, that already has some of the keys") {
+         T map;
+         for (int i = 0; i < 100; ++i)
+            map.Insert(i, -1);
+
+         REQUIRE(map.InsertBlock(keys, vals) == static_cast<Count>(Pairs));
+
+         for (int i = 0; i < 100; ++i) {
+            if (not mapStd.contains(i))
+               mapStd.insert({i, -1});
+         }
+
+         REQUIRE(map.GetCount() == static_cast<Count>(mapStd.size()));
+         for (auto& [key, val] : mapStd)
+            REQUIRE(map[key] == val);
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("Anyness::map::InsertBlock") (timer meter) {
+            some<T> storage(meter.runs());
+
+            meter.measure([&](int i) {
+               return storage[i].InsertBlock(keys, vals);
+            });
+         };
+
+         BENCHMARK_ADVANCED("Anyness::map::Insert (one by one)") (timer meter) {
+            some<T> storage(meter.runs());
+
+            meter.measure([&](int i) {
+               auto& m = storage[i];
+               for (int j = 0; j < Pairs; ++j)
+                  m.Insert(keys[j], vals[j]);
+               return m.GetCount();
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+/// Texts are trivially relocatable, so rehashing and shifting them around    
+/// copies them bytewise - these make sure no pair is lost or leaked          
+TEMPLATE_TEST_CASE("Map relocation of text pairs", "[map][insert]",
+   (MapTest<TUnorderedMap<Text, Text>, Text, Text>),
+   (MapTest<TOrderedMap<Text, Text>, Text, Text>),
+   (MapTest<UnorderedMap, Text, Text>),
+   (MapTest<OrderedMap, Text, Text>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   constexpr int Pairs = 1000;
+
+   GIVEN("A map grown one pair at a time") {
+      T map;
+      for (int i = 0; i < Pairs; ++i)
+         map.Insert(Text {i}, Text {-i});
+
+      REQUIRE(map.GetCount() == static_cast<Count>(Pairs));
+      for (int i = 0; i < Pairs; ++i)
+         REQUIRE(map[Text {i}] == Text {-i});
+
+      WHEN("Every third pair is removed") {
+         for (int i = 0; i < Pairs; i += 3)
+            REQUIRE(map.RemoveKey(Text {i}) == 1);
+
+         for (int i = 0; i < Pairs; ++i) {
+            if (i % 3)
+               REQUIRE(map[Text {i}] == Text {-i});
+            else
+               REQUIRE_FALSE(map.ContainsKey(Text {i}));
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
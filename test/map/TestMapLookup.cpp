@@ -0,0 +1,220 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestMapCommon.hpp"
+
+
+/// Lookups terminate early, based on robin-hood probe sequence lengths, so   
+/// these make sure the invariant survives insertion, removal and growth      
+TEMPLATE_TEST_CASE("Map lookups", "[map][lookup]",
+   (MapTest<TUnorderedMap<int, int>, int, int>),
+   (MapTest<TUnorderedMap<int, int, Engine::Swiss>, int, int>),
+   (MapTest<UnorderedMap, int, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   constexpr int Pairs = 5000;
+
+   GIVEN("A map filled with many pairs") {
+      T map;
+      std::unordered_map<int, int> mapStd;
+      for (int i = 0; i < Pairs; ++i) {
+         map.Insert(i * 7, i);
+         mapStd.insert({i * 7, i});
+      }
+
+      REQUIRE(map.GetCount() == static_cast<Count>(Pairs));
+
+      WHEN("Searching for contained and missing keys") {
+         for (int i = 0; i < Pairs; ++i) {
+            REQUIRE(map.ContainsKey(i * 7));
+            REQUIRE_FALSE(map.ContainsKey(i * 7 + 1));
+            REQUIRE(map.Find(i * 7 + 3) == IndexNone);
+         }
+      }
+
+      WHEN("Every third key is removed") {
+         for (int i = 0; i < Pairs; i += 3)
+            REQUIRE(map.RemoveKey(i * 7) == 1);
+
+         for (int i = 0; i < Pairs; ++i)
+            REQUIRE(map.ContainsKey(i * 7) == (i % 3 != 0));
+      }
+
+      WHEN("Pairs are removed by value, leaving multiple gaps") {
+         Count removed = 0;
+         for (int i = 0; i < Pairs; i += 5)
+            removed += map.RemoveValue(i);
+
+         REQUIRE(removed == static_cast<Count>((Pairs + 4) / 5));
+         for (int i = 0; i < Pairs; ++i)
+            REQUIRE(map.ContainsKey(i * 7) == (i % 5 != 0));
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("Anyness::map::ContainsKey (hits)") (timer meter) {
+            meter.measure([&](int i) {
+               return map.ContainsKey((i % Pairs) * 7);
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_map::contains (hits)") (timer meter) {
+            meter.measure([&](int i) {
+               return mapStd.contains((i % Pairs) * 7);
+            });
+         };
+
+         BENCHMARK_ADVANCED("Anyness::map::ContainsKey (misses)") (timer meter) {
+            meter.measure([&](int i) {
+               return map.ContainsKey((i % Pairs) * 7 + 1);
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_map::contains (misses)") (timer meter) {
+            meter.measure([&](int i) {
+               return mapStd.contains((i % Pairs) * 7 + 1);
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+/// Text keys with long common prefixes are costly to compare, and that's     
+/// what hash fingerprints (if enabled) help avoid                            
+SCENARIO("Map lookups with text keys", "[map][lookup]") {
+   static Allocator::State memoryState;
+
+   constexpr int Pairs = 2000;
+   const auto keyOf = [](int i) {
+      return "a/rather/long/and/shared/path/prefix/" + std::to_string(i);
+   };
+
+   GIVEN("A map filled with many text keys") {
+      TUnorderedMap<Text, Many> map;
+      std::unordered_map<std::string, int> mapStd;
+      for (int i = 0; i < Pairs; ++i) {
+         map.Insert(Text {keyOf(i)}, Many {i});
+         mapStd.insert({keyOf(i), i});
+      }
+
+      REQUIRE(map.GetCount() == static_cast<Count>(Pairs));
+
+      WHEN("Searching for contained and missing keys") {
+         for (int i = 0; i < Pairs; ++i) {
+            REQUIRE(map.ContainsKey(Text {keyOf(i)}));
+            REQUIRE(map[Text {keyOf(i)}] == Many {i});
+            REQUIRE_FALSE(map.ContainsKey(Text {keyOf(i + Pairs)}));
+         }
+      }
+
+      WHEN("Every other key is removed") {
+         for (int i = 0; i < Pairs; i += 2)
+            REQUIRE(map.RemoveKey(Text {keyOf(i)}) == 1);
+
+         for (int i = 0; i < Pairs; ++i)
+            REQUIRE(map.ContainsKey(Text {keyOf(i)}) == (i % 2 != 0));
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         std::vector<Text> hits, misses;
+         std::vector<std::string> hitsStd, missesStd;
+         for (int i = 0; i < Pairs; ++i) {
+            hits.emplace_back(keyOf(i));
+            misses.emplace_back(keyOf(i + Pairs));
+            hitsStd.emplace_back(keyOf(i));
+            missesStd.emplace_back(keyOf(i + Pairs));
+         }
+
+         BENCHMARK_ADVANCED("Anyness::TUnorderedMap<Text, Many>::ContainsKey (hits)") (timer meter) {
+            meter.measure([&](int i) {
+               return map.ContainsKey(hits[i % Pairs]);
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_map<std::string, int>::contains (hits)") (timer meter) {
+            meter.measure([&](int i) {
+               return mapStd.contains(hitsStd[i % Pairs]);
+            });
+         };
+
+         BENCHMARK_ADVANCED("Anyness::TUnorderedMap<Text, Many>::ContainsKey (misses)") (timer meter) {
+            meter.measure([&](int i) {
+               return map.ContainsKey(misses[i % Pairs]);
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_map<std::string, int>::contains (misses)") (timer meter) {
+            meter.measure([&](int i) {
+               return mapStd.contains(missesStd[i % Pairs]);
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+
+#ifdef LANGULUS_STD_BENCHMARK
+/// Compare lookup engines on a map with millions of small keys               
+SCENARIO("Map lookup engines on big maps", "[map][lookup]") {
+   static Allocator::State memoryState;
+
+   constexpr int Pairs = 1 << 21;
+
+   GIVEN("Maps filled with millions of pairs") {
+      TUnorderedMap<int, int> robin;
+      TUnorderedMap<int, int, Engine::Swiss> swiss;
+      std::unordered_map<int, int> mapStd;
+      for (int i = 0; i < Pairs; ++i) {
+         robin.Insert(i * 7, i);
+         swiss.Insert(i * 7, i);
+         mapStd.insert({i * 7, i});
+      }
+
+      BENCHMARK_ADVANCED("Engine::RobinHood::ContainsKey (hits)") (timer meter) {
+         meter.measure([&](int i) {
+            return robin.ContainsKey((i * 7919 % Pairs) * 7);
+         });
+      };
+
+      BENCHMARK_ADVANCED("Engine::Swiss::ContainsKey (hits)") (timer meter) {
+         meter.measure([&](int i) {
+            return swiss.ContainsKey((i * 7919 % Pairs) * 7);
+         });
+      };
+
+      BENCHMARK_ADVANCED("std::unordered_map::contains (hits)") (timer meter) {
+         meter.measure([&](int i) {
+            return mapStd.contains((i * 7919 % Pairs) * 7);
+         });
+      };
+
+      BENCHMARK_ADVANCED("Engine::RobinHood::ContainsKey (misses)") (timer meter) {
+         meter.measure([&](int i) {
+            return robin.ContainsKey((i * 7919 % Pairs) * 7 + 1);
+         });
+      };
+
+      BENCHMARK_ADVANCED("Engine::Swiss::ContainsKey (misses)") (timer meter) {
+         meter.measure([&](int i) {
+            return swiss.ContainsKey((i * 7919 % Pairs) * 7 + 1);
+         });
+      };
+
+      BENCHMARK_ADVANCED("std::unordered_map::contains (misses)") (timer meter) {
+         meter.measure([&](int i) {
+            return mapStd.contains((i * 7919 % Pairs) * 7 + 1);
+         });
+      };
+   }
+
+   REQUIRE(memoryState.Assert());
+}
+#endif
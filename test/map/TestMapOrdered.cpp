@@ -0,0 +1,135 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestMapCommon.hpp"
+#include <vector>
+
+
+/// Get all keys of a map, in the order they're iterated                      
+template<bool REVERSE = false>
+std::vector<int> Map_Helper_Keys(const auto& map) {
+   std::vector<int> keys;
+   map.template ForEachKey<REVERSE>([&](const int& key) {
+      keys.push_back(key);
+   });
+   return keys;
+}
+
+/// Ordered maps iterate pairs in the order they were inserted, regardless    
+/// of where robin-hood hashing puts them, so these make sure that order      
+/// survives insertion, removal, growth and copying                           
+TEMPLATE_TEST_CASE("Ordered maps", "[map][ordered]",
+   (MapTest<TOrderedMap<int, int>, int, int>),
+   (MapTest<OrderedMap, int, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   using U = Conditional<CT::Typed<T>, TUnorderedMap<int, int>, UnorderedMap>;
+   constexpr int Pairs = 1000;
+
+   GIVEN("A map filled with many scrambled keys") {
+      T map;
+      std::vector<int> order;
+      for (int i = 0; i < Pairs; ++i) {
+         const int key = (i * 7919) % 10007;
+         map.Insert(key, i);
+         order.push_back(key);
+      }
+
+      REQUIRE(map.GetCount() == static_cast<Count>(Pairs));
+      REQUIRE(Map_Helper_Keys(map) == order);
+
+      WHEN("Iterated in reverse") {
+         REQUIRE(Map_Helper_Keys<true>(map)
+            == std::vector<int>(order.rbegin(), order.rend()));
+      }
+
+      WHEN("Every third key is removed, and then inserted again") {
+         std::vector<int> remaining, removed;
+         for (int i = 0; i < Pairs; ++i) {
+            if (i % 3 == 0) {
+               REQUIRE(map.RemoveKey(order[i]) == 1);
+               removed.push_back(order[i]);
+            }
+            else remaining.push_back(order[i]);
+         }
+
+         REQUIRE(Map_Helper_Keys(map) == remaining);
+
+         for (auto key : removed) {
+            map.Insert(key, 0);
+            remaining.push_back(key);
+         }
+
+         REQUIRE(Map_Helper_Keys(map) == remaining);
+      }
+
+      WHEN("Pairs are discarded while iterating") {
+         std::vector<int> remaining;
+         int i = 0;
+         map.ForEachKey([&](const int& key) -> LoopControl {
+            if (i++ % 2)
+               return Loop::Discard;
+            remaining.push_back(key);
+            return Loop::Continue;
+         });
+
+         REQUIRE(map.GetCount() == static_cast<Count>(remaining.size()));
+         REQUIRE(Map_Helper_Keys(map) == remaining);
+      }
+
+      WHEN("Inserting existing keys") {
+         for (int i = Pairs - 1; i >= 0; --i)
+            map.Insert(order[i], i);
+
+         REQUIRE(Map_Helper_Keys(map) == order);
+      }
+
+      WHEN("The map is copied, cloned, or moved") {
+         T copied = Copy(map);
+         T cloned = Clone(map);
+         T moved  = ::std::move(map);
+
+         REQUIRE(Map_Helper_Keys(copied) == order);
+         REQUIRE(Map_Helper_Keys(cloned) == order);
+         REQUIRE(Map_Helper_Keys(moved)  == order);
+      }
+
+      WHEN("The map is cleared and refilled") {
+         map.Clear();
+         REQUIRE(Map_Helper_Keys(map).empty());
+
+         std::vector<int> refilled(order.rbegin(), order.rend());
+         for (auto key : refilled)
+            map.Insert(key, 0);
+
+         REQUIRE(Map_Helper_Keys(map) == refilled);
+      }
+   }
+
+   GIVEN("An unordered map") {
+      U unordered;
+      for (int i = 0; i < Pairs; ++i)
+         unordered.Insert((i * 7919) % 10007, i);
+
+      WHEN("An ordered map is made from it") {
+         T map {unordered};
+
+         THEN("The ordered map retains the order pairs were stored in") {
+            REQUIRE(map.GetCount() == unordered.GetCount());
+            REQUIRE(Map_Helper_Keys(map) == Map_Helper_Keys(unordered));
+
+            map.Insert(10007, 0);
+            REQUIRE(Map_Helper_Keys(map).back() == 10007);
+            REQUIRE(unordered.GetCount() == static_cast<Count>(Pairs));
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}
@@ -0,0 +1,90 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestSetCommon.hpp"
+#include <vector>
+
+
+/// Inserting blocks and sets reserves only once, and places elements in      
+/// batches, so these make sure the results match inserting one by one        
+TEMPLATE_TEST_CASE("Set insertion of blocks and sets", "[set][insert]",
+   (SetTest<TUnorderedSet<int>, int>),
+   (SetTest<TOrderedSet<int>, int>),
+   (SetTest<UnorderedSet, int>),
+   (SetTest<OrderedSet, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   constexpr int Keys = 10000;
+
+   GIVEN("A block of elements, where elements repeat") {
+      TMany<int> keys;
+      std::unordered_set<int> setStd;
+      std::vector<int> order;
+      for (int i = 0; i < Keys; ++i) {
+         const int key = (i * 7919) % 5003;
+         keys << key;
+         if (setStd.insert(key).second)
+            order.push_back(key);
+      }
+
+      WHEN("Inserted into an empty set") {
+         T set;
+         REQUIRE(set.InsertBlock(keys) == static_cast<Count>(Keys));
+         REQUIRE(set.GetCount() == static_cast<Count>(setStd.size()));
+
+         for (auto key : setStd)
+            REQUIRE(set.Contains(key));
+
+         if constexpr (T::Ordered) {
+            std::vector<int> iterated;
+            set.ForEach([&](const int& key) {
+               iterated.push_back(key);
+            });
+            REQUIRE(iterated == order);
+         }
+
+         THEN("The set can be merged into another one") {
+            T other;
+            for (int i = 0; i < 100; ++i)
+               other << i * 3;
+
+            other.InsertBlock(set);
+            for (int i = 0; i < 100; ++i)
+               setStd.insert(i * 3);
+
+            REQUIRE(other.GetCount() == static_cast<Count>(setStd.size()));
+            for (auto key : setStd)
+               REQUIRE(other.Contains(key));
+         }
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("Anyness::set::InsertBlock") (timer meter) {
+            some<T> storage(meter.runs());
+
+            meter.measure([&](int i) {
+               return storage[i].InsertBlock(keys);
+            });
+         };
+
+         BENCHMARK_ADVANCED("Anyness::set::operator << (one by one)") (timer meter) {
+            some<T> storage(meter.runs());
+
+            meter.measure([&](int i) {
+               auto& s = storage[i];
+               for (int j = 0; j < Keys; ++j)
+                  s << keys[j];
+               return s.GetCount();
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
@@ -0,0 +1,76 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestSetCommon.hpp"
+
+
+/// Lookups terminate early, based on robin-hood probe sequence lengths, so   
+/// these make sure the invariant survives insertion, removal and growth      
+TEMPLATE_TEST_CASE("Set lookups", "[set][lookup]",
+   (SetTest<TUnorderedSet<int>, int>),
+   (SetTest<UnorderedSet, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   constexpr int Keys = 5000;
+
+   GIVEN("A set filled with many keys") {
+      T set;
+      std::unordered_set<int> setStd;
+      for (int i = 0; i < Keys; ++i) {
+         set << i * 7;
+         setStd.insert(i * 7);
+      }
+
+      REQUIRE(set.GetCount() == static_cast<Count>(Keys));
+
+      WHEN("Searching for contained and missing keys") {
+         for (int i = 0; i < Keys; ++i) {
+            REQUIRE(set.Contains(i * 7));
+            REQUIRE_FALSE(set.Contains(i * 7 + 1));
+            REQUIRE(set.Find(i * 7 + 3) == IndexNone);
+         }
+      }
+
+      WHEN("Every third key is removed") {
+         for (int i = 0; i < Keys; i += 3)
+            REQUIRE(set.Remove(i * 7) == 1);
+
+         for (int i = 0; i < Keys; ++i)
+            REQUIRE(set.Contains(i * 7) == (i % 3 != 0));
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("Anyness::set::Contains (hits)") (timer meter) {
+            meter.measure([&](int i) {
+               return set.Contains((i % Keys) * 7);
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_set::contains (hits)") (timer meter) {
+            meter.measure([&](int i) {
+               return setStd.contains((i % Keys) * 7);
+            });
+         };
+
+         BENCHMARK_ADVANCED("Anyness::set::Contains (misses)") (timer meter) {
+            meter.measure([&](int i) {
+               return set.Contains((i % Keys) * 7 + 1);
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_set::contains (misses)") (timer meter) {
+            meter.measure([&](int i) {
+               return setStd.contains((i % Keys) * 7 + 1);
+            });
+         };
+      #endif
+   }
+
+   REQUIRE(memoryState.Assert());
+}
@@ -0,0 +1,120 @@
+///                                                                           
+/// Langulus::Anyness                                                         
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include "TestSetCommon.hpp"
+#include <vector>
+
+
+/// Get all elements of a set, in the order they're iterated                  
+template<bool REVERSE = false>
+std::vector<int> Set_Helper_Keys(const auto& set) {
+   std::vector<int> keys;
+   set.template ForEach<REVERSE>([&](const int& key) {
+      keys.push_back(key);
+   });
+   return keys;
+}
+
+/// Ordered sets iterate elements in the order they were inserted,            
+/// regardless of where robin-hood hashing puts them, so these make sure      
+/// that order survives insertion, removal, growth and copying                
+TEMPLATE_TEST_CASE("Ordered sets", "[set][ordered]",
+   (SetTest<TOrderedSet<int>, int>),
+   (SetTest<OrderedSet, int>)
+) {
+   static Allocator::State memoryState;
+
+   using T = typename TestType::Container;
+   using U = Conditional<CT::Typed<T>, TUnorderedSet<int>, UnorderedSet>;
+   constexpr int Keys = 1000;
+
+   GIVEN("A set filled with many scrambled keys") {
+      T set;
+      std::vector<int> order;
+      for (int i = 0; i < Keys; ++i) {
+         const int key = (i * 7919) % 10007;
+         set << key;
+         order.push_back(key);
+      }
+
+      REQUIRE(set.GetCount() == static_cast<Count>(Keys));
+      REQUIRE(Set_Helper_Keys(set) == order);
+
+      WHEN("Iterated in reverse") {
+         REQUIRE(Set_Helper_Keys<true>(set)
+            == std::vector<int>(order.rbegin(), order.rend()));
+      }
+
+      if constexpr (CT::Typed<T>) {
+         WHEN("Iterated using ranged-for") {
+            std::vector<int> keys;
+            for (auto& key : set)
+               keys.push_back(key);
+
+            REQUIRE(keys == order);
+         }
+      }
+
+      WHEN("Every third key is removed, and then inserted again") {
+         std::vector<int> remaining, removed;
+         for (int i = 0; i < Keys; ++i) {
+            if (i % 3 == 0) {
+               REQUIRE(set.Remove(order[i]) == 1);
+               removed.push_back(order[i]);
+            }
+            else remaining.push_back(order[i]);
+         }
+
+         REQUIRE(Set_Helper_Keys(set) == remaining);
+
+         for (auto key : removed) {
+            set << key;
+            remaining.push_back(key);
+         }
+
+         REQUIRE(Set_Helper_Keys(set) == remaining);
+      }
+
+      WHEN("Inserting existing keys") {
+         for (int i = Keys - 1; i >= 0; --i)
+            set << order[i];
+
+         REQUIRE(Set_Helper_Keys(set) == order);
+      }
+
+      WHEN("The set is copied, cloned, or moved") {
+         T copied = Copy(set);
+         T cloned = Clone(set);
+         T moved  = ::std::move(set);
+
+         REQUIRE(Set_Helper_Keys(copied) == order);
+         REQUIRE(Set_Helper_Keys(cloned) == order);
+         REQUIRE(Set_Helper_Keys(moved)  == order);
+      }
+   }
+
+   GIVEN("An unordered set") {
+      U unordered;
+      for (int i = 0; i < Keys; ++i)
+         unordered << (i * 7919) % 10007;
+
+      WHEN("An ordered set is made from it") {
+         T set {unordered};
+
+         THEN("The ordered set retains the order elements were stored in") {
+            REQUIRE(set.GetCount() == unordered.GetCount());
+            REQUIRE(Set_Helper_Keys(set) == Set_Helper_Keys(unordered));
+
+            set << 10007;
+            REQUIRE(Set_Helper_Keys(set).back() == 10007);
+            REQUIRE(unordered.GetCount() == static_cast<Count>(Keys));
+         }
+      }
+   }
+
+   REQUIRE(memoryState.Assert());
+}